@@ -0,0 +1,228 @@
+/**
+ * \file Benchmark.h
+ *
+ * \brief This  file contains the  definition of a  class that times a
+ * piece of  code and reports its  cost as nanoseconds per  operation
+ * and items per second.
+ *
+ * \author
+ * Adelino Afonso e Irene Ginani \n
+ * Universidade Federal do Rio Grande do Norte, \n
+ * Instituto Metr&oacute;pole Digital, \n
+ * Adelino Afonso at imd (dot) ufrn (dot) br, \n
+ * Irene Ginani at imd (dot) ufrn (dot) br
+ *
+ * \version 1.0
+ * \date October 2026
+ *
+ * \attention This program is distributed WITHOUT ANY WARRANTY, and it
+ *            may be freely redistributed under the condition that the
+ *            copyright notices  are not removed,  and no compensation
+ *            is received. Private, research, and institutional use is
+ *            free. Distribution of this  code as part of a commercial
+ *            system  is permissible ONLY  BY DIRECT  ARRANGEMENT WITH
+ *            THE AUTHOR.
+ */
+
+#pragma once
+
+#include <chrono>              // std::chrono::steady_clock
+#include <string>              // std::string
+#include <cstdio>              // std::printf
+#include <functional>          // std::function
+
+
+/**
+ * \defgroup MAT309NameSpace Namespace MAT309.
+ * @{
+ */
+
+/**
+ * \namespace MAT309
+ *
+ * \brief Global namespace for MAT309 software.
+ *
+ */
+
+namespace MAT309
+{
+
+	/**
+	 * \class Benchmark
+	 *
+	 * \brief This class runs a benchmark body with a growing number of
+	 * iterations until it takes  at least a minimum amount of time, and
+	 * prints one line with the cost per operation and the throughput.
+	 *
+	 * A body  receives the number of  operations it must  perform and
+	 * returns the  number of items  processed by those operations, so
+	 * that a single operation may handle many items (e.g., building a
+	 * CDT of \c n points is one operation on \c n items).
+	 *
+	 */
+	class Benchmark
+	{
+	public:
+
+		// -----------------------------------------------------------
+		//
+		// Type definitions
+		//
+		// -----------------------------------------------------------
+
+		/**
+		 * \typedef Body
+		 *
+		 * \brief Alias for the code being timed.
+		 *
+		 */
+		typedef std::function<size_t (size_t)> Body;
+
+
+		/**
+		 * \typedef Clock
+		 *
+		 * \brief Alias for the clock used to measure wall time.
+		 *
+		 */
+		typedef std::chrono::steady_clock Clock;
+
+
+	private:
+
+		// -----------------------------------------------------------
+		//
+		// Private data members
+		//
+		// -----------------------------------------------------------
+
+		double _minimumTime;     ///< Minimum time (in seconds) a measurement must take.
+		std::string _filter;     ///< Only benchmarks whose name contains this string are run.
+
+
+	public:
+
+		// -----------------------------------------------------------
+		//
+		// Public methods
+		//
+		// -----------------------------------------------------------
+
+		/**
+		 * \fn Benchmark(double minimumTime, const std::string& filter)
+		 *
+		 * \brief Creates an instance of this class.
+		 *
+		 * \param minimumTime Minimum time  (in seconds) a measurement
+		 * must take.
+		 * \param filter Only  benchmarks whose name contains this
+		 * string are run (an empty string runs all of them).
+		 *
+		 */
+		Benchmark(double minimumTime, const std::string& filter)
+			:
+			_minimumTime(minimumTime),
+			_filter(filter)
+		{
+		}
+
+
+		/**
+		 * \fn bool IsEnabled(const std::string& name) const
+		 *
+		 * \brief Determines whether a benchmark passes the filter.
+		 *
+		 * \param name The name of the benchmark.
+		 *
+		 * \return The logic value true if the benchmark must be run.
+		 *
+		 */
+		bool IsEnabled(const std::string& name) const
+		{
+			return _filter.empty() || (name.find(_filter) != std::string::npos);
+		}
+
+
+		/**
+		 * \fn void PrintHeader() const
+		 *
+		 * \brief Prints the header of the result table.
+		 *
+		 */
+		void PrintHeader() const
+		{
+			std::printf("%-48s %14s %16s %12s  %s\n", "benchmark", "ns/op", "items/s", "ops", "notes");
+			std::fflush(stdout);
+		}
+
+
+		/**
+		 * \fn void Run(const std::string& name, Body body, const std::string& notes = "", size_t maximumOperations = 0)
+		 *
+		 * \brief Runs a benchmark and prints its results.  The number of
+		 * operations grows until a run takes the minimum time.
+		 *
+		 * \param name The name of the benchmark.
+		 * \param body The code being timed.
+		 * \param notes A free-form note printed after the results.
+		 * \param maximumOperations Largest number of operations of a
+		 * run (0 means no limit), for bodies whose operations are
+		 * expensive or cannot be repeated indefinitely.
+		 *
+		 */
+		void
+			Run(
+				const std::string& name,
+				Body body,
+				const std::string& notes = "",
+				size_t maximumOperations = 0
+			)
+			const
+		{
+			if (!IsEnabled(name))
+			{
+				return;
+			}
+
+			size_t operations = 1;
+
+			while (true)
+			{
+				Clock::time_point start = Clock::now();
+				size_t items = body(operations);
+				double elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+
+				bool limited = (maximumOperations != 0) && (operations >= maximumOperations);
+
+				if ((elapsed >= _minimumTime) || limited)
+				{
+					std::printf(
+						"%-48s %14.1f %16.4g %12zu  %s\n",
+						name.c_str(),
+						1e9 * elapsed / double(operations),
+						(elapsed > 0) ? double(items) / elapsed : 0.0,
+						operations,
+						notes.c_str()
+					);
+					std::fflush(stdout);
+
+					return;
+				}
+
+				// Grow the run towards the minimum time, at most 100x
+				// at a time.
+				double factor = (elapsed > 0) ? 1.5 * _minimumTime / elapsed : 100;
+				factor = (factor > 100) ? 100 : ((factor < 2) ? 2 : factor);
+				operations = size_t(double(operations) * factor);
+
+				if ((maximumOperations != 0) && (operations > maximumOperations))
+				{
+					operations = maximumOperations;
+				}
+			}
+		}
+	};
+
+}
+
+/** @} */ //end of group class.
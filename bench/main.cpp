@@ -0,0 +1,627 @@
+/**
+ * \file main.cpp
+ *
+ * \brief Microbenchmarks for the  geometric predicates, point location,
+ * point insertion,  CDT construction,  face extraction, and  Poisson
+ * disk sampling.  Every result is reported as  nanoseconds per operation
+ * and items per second.
+ *
+ * \author
+ * Adelino Afonso e Irene Ginani \n
+ * Universidade Federal do Rio Grande do Norte, \n
+ * Instituto Metr&oacute;pole Digital, \n
+ * Adelino Afonso at imd (dot) ufrn (dot) br, \n
+ * Irene Ginani at imd (dot) ufrn (dot) br
+ *
+ * \version 1.0
+ * \date October 2026
+ *
+ * \attention This program is distributed WITHOUT ANY WARRANTY, and it
+ *            may be freely redistributed under the condition that the
+ *            copyright notices  are not removed,  and no compensation
+ *            is received. Private, research, and institutional use is
+ *            free. Distribution of this  code as part of a commercial
+ *            system  is permissible ONLY  BY DIRECT  ARRANGEMENT WITH
+ *            THE AUTHOR.
+ */
+
+#include <iostream>                 // std::cerr, std::endl
+#include <string>                   // std::string
+#include <cstdlib>                  // atof, strtod, strtoul, EXIT_SUCCESS, EXIT_FAILURE
+#include <algorithm>                // std::min, std::max
+#include <cmath>                    // cos, sin, sqrt, ceil
+#include <random>                   // std::mt19937
+#include <vector>                   // std::vector
+#include <memory>                   // std::shared_ptr
+#include <exception>                // std::exception
+
+#include "Cdt.h"                    // cdt::CDT
+#include "DtPoint.h"                // cdt::DtPoint
+#include "FaceVisitor.h"            // cdt::FaceVisitor
+#include "PointLocator.h"           // cdt::PointLocator
+#include "Predicates.h"             // cdt::Predicates
+
+#include "PDSampler.h"              // MAT309::PDSampler
+#include "MyCylinder.h"             // MAT309::MyCylinder
+#include "Esfera.h"                 // MAT309::Esfera
+#include "Cone.h"                   // MAT309::Cone
+
+#include "Benchmark.h"              // MAT309::Benchmark
+
+using MAT309::cdt::CDT;
+using MAT309::cdt::DtPoint;
+using MAT309::cdt::FaceVisitor;
+using MAT309::cdt::PointLocator;
+using MAT309::cdt::Predicates;
+using MAT309::PDSampler;
+using MAT309::MyCylinder;
+using MAT309::Esfera;
+using MAT309::Cone;
+using MAT309::Benchmark;
+
+
+/**
+ * \typedef spPoint
+ *
+ * \brief Alias for a shared pointer to DtPoint objects.
+ *
+ */
+typedef DtPoint::spPoint spPoint;
+
+
+/**
+ * \class BenchCDT
+ *
+ * \brief This class exposes the protected point location and insertion
+ * methods of the CDT, so that they can be timed on their own.
+ *
+ */
+class BenchCDT : public CDT
+{
+public:
+
+	/**
+	 * \fn BenchCDT(double max)
+	 *
+	 * \brief Creates a triangulation holding only an enclosing triangle.
+	 *
+	 * \param max Maximum absolute value among the coordinates of a vertex
+	 * of the enclosing triangle.
+	 *
+	 */
+	BenchCDT(double max) : CDT(max)
+	{
+	}
+
+	using CDT::InsertPoint;
+	using CDT::Locate;
+};
+
+
+/**
+ * \fn void GeneratePoints(const std::string& distribution, size_t n, std::mt19937& rng, std::vector<spPoint>& points)
+ *
+ * \brief Generates a point set in the unit square.
+ *
+ * \param distribution One of "uniform", "clustered" (Gaussian clusters),
+ * or "grid" (a regular grid, in which every cell is cocircular).
+ * \param n The number of points.
+ * \param rng A pseudo-random number generator.
+ * \param points A reference to the array of points generated.
+ *
+ */
+void GeneratePoints(
+	const std::string& distribution,
+	size_t n,
+	std::mt19937& rng,
+	std::vector<spPoint>& points
+)
+{
+	std::uniform_real_distribution<double> uniform(0, 1);
+
+	points.clear();
+	points.reserve(n);
+
+	if (distribution == "grid")
+	{
+		size_t side = size_t(ceil(sqrt(double(n))));
+
+		for (size_t i = 0; points.size() < n; i++)
+		{
+			points.push_back(std::make_shared<DtPoint>(double(i % side) / side, double(i / side) / side));
+		}
+	}
+	else if (distribution == "clustered")
+	{
+		std::vector<double> centers(2 * 32);
+
+		for (size_t i = 0; i < centers.size(); i++)
+		{
+			centers[i] = uniform(rng);
+		}
+
+		std::normal_distribution<double> normal(0, 0.01);
+
+		for (size_t i = 0; i < n; i++)
+		{
+			size_t c = i % 32;
+			double u = std::min(1.0, std::max(0.0, centers[2 * c] + normal(rng)));
+			double v = std::min(1.0, std::max(0.0, centers[2 * c + 1] + normal(rng)));
+
+			points.push_back(std::make_shared<DtPoint>(u, v));
+		}
+	}
+	else
+	{
+		for (size_t i = 0; i < n; i++)
+		{
+			points.push_back(std::make_shared<DtPoint>(uniform(rng), uniform(rng)));
+		}
+	}
+
+	return;
+}
+
+
+/**
+ * \fn void BenchmarkPredicates(const Benchmark& bench, std::mt19937& rng)
+ *
+ * \brief Times the orientation and incircle tests on random and on
+ * nearly degenerate inputs (which force the exact, adaptive stages).
+ *
+ * \param bench The benchmark runner.
+ * \param rng A pseudo-random number generator.
+ *
+ */
+void BenchmarkPredicates(
+	const Benchmark& bench,
+	std::mt19937& rng
+)
+{
+	const size_t n = 4096;   // Number of precomputed inputs (a power of two)
+
+	std::uniform_real_distribution<double> uniform(0, 1);
+	std::uniform_real_distribution<double> tiny(-1e-15, 1e-15);
+
+	// Ten coordinates per input: a, b, c, d, and e.  The orientation
+	// test is given a, b, and c, and the incircle test a, b, d, and e.
+	std::vector<double> random(10 * n);
+	std::vector<double> degenerate(10 * n);
+
+	for (size_t i = 0; i < random.size(); i++)
+	{
+		random[i] = uniform(rng);
+	}
+
+	for (size_t i = 0; i < n; i++)
+	{
+		double* q = &degenerate[10 * i];
+
+		// Five points on the unit circle, perturbed by a few ulps, so
+		// a, b, d, and e are nearly cocircular.
+		for (size_t k = 0; k < 5; k++)
+		{
+			double angle = 2 * acos(-1) * uniform(rng);
+			q[2 * k] = cos(angle) + tiny(rng);
+			q[2 * k + 1] = sin(angle) + tiny(rng);
+		}
+
+		// Move c onto the line through a and b, so a, b, and c are
+		// nearly collinear.
+		double t = uniform(rng);
+		q[4] = q[0] + t * (q[2] - q[0]) + tiny(rng);
+		q[5] = q[1] + t * (q[3] - q[1]) + tiny(rng);
+	}
+
+	Predicates<double> preds;
+
+	const std::vector<double>* inputs[2] = { &random, &degenerate };
+	const char* names[2] = { "random", "degenerate" };
+
+	for (size_t k = 0; k < 2; k++)
+	{
+		const std::vector<double>& in = *inputs[k];
+
+		bench.Run(
+			std::string("predicates/orient2d/") + names[k],
+			[&](size_t ops)
+			{
+				double sink = 0;
+
+				for (size_t i = 0; i < ops; i++)
+				{
+					const double* q = &in[10 * (i & (n - 1))];
+					sink += preds.Orient2D(q[0], q[1], q[2], q[3], q[4], q[5]);
+				}
+
+				// Keep the compiler from dropping the loop.
+				volatile double keep = sink;
+				(void) keep;
+
+				return ops;
+			}
+		);
+
+		bench.Run(
+			std::string("predicates/incircle/") + names[k],
+			[&](size_t ops)
+			{
+				size_t sink = 0;
+
+				for (size_t i = 0; i < ops; i++)
+				{
+					const double* q = &in[10 * (i & (n - 1))];
+					sink += preds.InCircle(q[0], q[1], q[2], q[3], q[6], q[7], q[8], q[9]) ? 1 : 0;
+				}
+
+				volatile size_t keep = sink;
+				(void) keep;
+
+				return ops;
+			}
+		);
+	}
+
+	return;
+}
+
+
+/**
+ * \fn void BenchmarkLocation(const Benchmark& bench, size_t maxPoints, std::mt19937& rng)
+ *
+ * \brief Times point location (by a walk from the last inserted point,
+ * and by the grid of a point locator) and point insertion in
+ * triangulations of growing size.
+ *
+ * \param bench The benchmark runner.
+ * \param maxPoints Largest number of points of a triangulation.
+ * \param rng A pseudo-random number generator.
+ *
+ */
+void BenchmarkLocation(
+	const Benchmark& bench,
+	size_t maxPoints,
+	std::mt19937& rng
+)
+{
+	for (size_t n = 1000; n <= maxPoints; n *= 10)
+	{
+		std::vector<spPoint> points;
+		GeneratePoints("uniform", n, rng, points);
+
+		// The enclosing triangle of the constructors: three times the
+		// largest coordinate.
+		double max = 3;
+
+		std::string name = "locate/uniform/" + std::to_string(n);
+
+		if (bench.IsEnabled(name))
+		{
+			BenchCDT cdt(max);
+
+			for (size_t i = 0; i < n; i++)
+			{
+				cdt.InsertPoint(points[i]);
+			}
+
+			std::vector<spPoint> queries;
+			GeneratePoints("uniform", 4096, rng, queries);
+
+			// Measure the average walk length once, outside the timed
+			// runs.
+			size_t steps = cdt.GetNumberOfLocateSteps();
+
+			for (size_t i = 0; i < queries.size(); i++)
+			{
+				cdt.Locate(queries[i]);
+			}
+
+			double walk = double(cdt.GetNumberOfLocateSteps() - steps) / double(queries.size());
+
+			bench.Run(
+				name,
+				[&](size_t ops)
+				{
+					for (size_t i = 0; i < ops; i++)
+					{
+						cdt.Locate(queries[i & 4095]);
+					}
+
+					return ops;
+				},
+				"walk=" + std::to_string(walk) + " edges/query"
+			);
+		}
+
+		name = "query/uniform/" + std::to_string(n);
+
+		if (bench.IsEnabled(name))
+		{
+			CDT cdt(n, points);
+			PointLocator locator(cdt);
+
+			std::vector<spPoint> queries;
+			GeneratePoints("uniform", 4096, rng, queries);
+
+			PointLocator::Location location;
+
+			bench.Run(
+				name,
+				[&](size_t ops)
+				{
+					for (size_t i = 0; i < ops; i++)
+					{
+						const spPoint& q = queries[i & 4095];
+						locator.Locate(q->GetU(), q->GetV(), location);
+					}
+
+					return ops;
+				}
+			);
+		}
+
+		bench.Run(
+			"insert/uniform/" + std::to_string(n),
+			[&](size_t ops)
+			{
+				for (size_t k = 0; k < ops; k++)
+				{
+					BenchCDT cdt(max);
+
+					for (size_t i = 0; i < n; i++)
+					{
+						cdt.InsertPoint(points[i]);
+					}
+				}
+
+				return ops * n;
+			}
+		);
+	}
+
+	return;
+}
+
+
+/**
+ * \fn void BenchmarkConstruction(const Benchmark& bench, size_t maxPoints, std::mt19937& rng)
+ *
+ * \brief Times the construction of a CDT and the extraction of its
+ * faces for several point distributions and sizes.
+ *
+ * \param bench The benchmark runner.
+ * \param maxPoints Largest number of points of a triangulation.
+ * \param rng A pseudo-random number generator.
+ *
+ */
+void BenchmarkConstruction(
+	const Benchmark& bench,
+	size_t maxPoints,
+	std::mt19937& rng
+)
+{
+	const char* distributions[3] = { "uniform", "clustered", "grid" };
+
+	for (size_t d = 0; d < 3; d++)
+	{
+		for (size_t n = 1000; n <= maxPoints; n *= 10)
+		{
+			std::string suffix = std::string(distributions[d]) + "/" + std::to_string(n);
+
+			if (!bench.IsEnabled("cdt/" + suffix) && !bench.IsEnabled("visit/" + suffix))
+			{
+				continue;
+			}
+
+			std::vector<spPoint> points;
+			GeneratePoints(distributions[d], n, rng, points);
+
+			bench.Run(
+				"cdt/" + suffix,
+				[&](size_t ops)
+				{
+					for (size_t k = 0; k < ops; k++)
+					{
+						CDT cdt(n, points);
+					}
+
+					return ops * n;
+				},
+				"",
+				(n >= 1000000) ? 1 : 0
+			);
+
+			if (bench.IsEnabled("visit/" + suffix))
+			{
+				CDT cdt(n, points);
+
+				size_t numberOfVertices;
+				std::vector<spPoint> vertices;
+				size_t numberOfEdges;
+				std::vector<size_t> edges;
+				size_t numberOfTriangles = 0;
+				std::vector<size_t> triangles;
+				std::vector<FaceVisitor::EdgeType> edgeType;
+
+				bench.Run(
+					"visit/" + suffix,
+					[&](size_t ops)
+					{
+						for (size_t k = 0; k < ops; k++)
+						{
+							FaceVisitor visitor;
+							visitor.Visit(
+								cdt,
+								numberOfTriangles,
+								triangles,
+								numberOfEdges,
+								edges,
+								edgeType,
+								numberOfVertices,
+								vertices
+							);
+						}
+
+						return ops * numberOfTriangles;
+					},
+					"flips=" + std::to_string(cdt.GetNumberOfSwaps())
+				);
+			}
+		}
+	}
+
+	return;
+}
+
+
+/**
+ * \fn void BenchmarkSampling(const Benchmark& bench, const std::vector<double>& alphas)
+ *
+ * \brief Times Poisson disk sampling of each surface for several radii.
+ *
+ * \param bench The benchmark runner.
+ * \param alphas The sampling radii.
+ *
+ */
+void BenchmarkSampling(
+	const Benchmark& bench,
+	const std::vector<double>& alphas
+)
+{
+	std::vector<PDSampler::spSurface> surfaces;
+	surfaces.push_back(std::make_shared<MyCylinder>());
+	surfaces.push_back(std::make_shared<Esfera>());
+	surfaces.push_back(std::make_shared<Cone>());
+
+	const char* names[3] = { "cylinder", "esfera", "cone" };
+
+	for (size_t s = 0; s < surfaces.size(); s++)
+	{
+		for (size_t a = 0; a < alphas.size(); a++)
+		{
+			PDSampler sampler;
+			sampler.setAlpha(alphas[a]);
+
+			size_t numberOfPoints = 0;
+			std::vector<spPoint> points;
+
+			bench.Run(
+				std::string("sample/") + names[s] + "/alpha=" + std::to_string(alphas[a]),
+				[&](size_t ops)
+				{
+					size_t items = 0;
+
+					for (size_t k = 0; k < ops; k++)
+					{
+						sampler.sample(surfaces[s], numberOfPoints, points);
+						items += numberOfPoints;
+					}
+
+					return items;
+				},
+				"",
+				8
+			);
+		}
+	}
+
+	return;
+}
+
+
+/**
+ * \fn int main( int argc , char* argv[]  )
+ *
+ * \brief Runs the benchmarks selected on the command line.
+ *
+ * \param argc The number of command-line arguments.
+ * \param argv An array with the command-line arguments.
+ *
+ * \return An integer number.
+ */
+int main(int argc, char* argv[])
+{
+	std::string filter;              // Only benchmarks whose name contains this string are run
+	double minimumTime = 0.25;       // Minimum time (in seconds) of a measurement
+	size_t maxPoints = 100000;       // Largest triangulation size
+	std::vector<double> alphas;      // Sampling radii
+
+	for (int i = 1; i < argc; i++)
+	{
+		std::string arg(argv[i]);
+
+		if ((arg == "--filter") && (i + 1 < argc))
+		{
+			filter = argv[++i];
+		}
+		else if ((arg == "--min-time") && (i + 1 < argc))
+		{
+			minimumTime = atof(argv[++i]);
+		}
+		else if ((arg == "--max-points") && (i + 1 < argc))
+		{
+			char* end = nullptr;
+			double value = strtod(argv[++i], &end);
+
+			if ((end == argv[i]) || (*end != '\0') || !(value >= 1) || (value > 1e7))
+			{
+				std::cerr << "The value of --max-points must be a number from 1 to 1e7." << std::endl;
+				return EXIT_FAILURE;
+			}
+
+			maxPoints = size_t(value);
+		}
+		else if ((arg == "--alpha") && (i + 1 < argc))
+		{
+			alphas.push_back(atof(argv[++i]));
+		}
+		else
+		{
+			std::cerr << "Usage: "
+					<< std::endl
+					<< "\t\t cdtbench [--filter name] [--min-time seconds] [--max-points n] [--alpha a]..."
+					<< std::endl
+					<< "\t\t --filter: run only benchmarks whose name contains the given string."
+					<< std::endl
+					<< "\t\t --min-time: minimum duration of a measurement (default 0.25 s)."
+					<< std::endl
+					<< "\t\t --max-points: largest triangulation size, up to 1e7 (default 1e5)."
+					<< std::endl
+					<< "\t\t --alpha: sampling radius (may be repeated; default 0.5 and 0.25)."
+					<< std::endl
+					<< std::endl;
+			return EXIT_FAILURE;
+		}
+	}
+
+	if (alphas.empty())
+	{
+		alphas.push_back(0.5);
+		alphas.push_back(0.25);
+	}
+
+	// A fixed seed, so runs of different builds see the same inputs.
+	std::mt19937 rng(309);
+
+	Benchmark bench(minimumTime, filter);
+	bench.PrintHeader();
+
+	try
+	{
+		BenchmarkPredicates(bench, rng);
+		BenchmarkLocation(bench, maxPoints, rng);
+		BenchmarkConstruction(bench, maxPoints, rng);
+		BenchmarkSampling(bench, alphas);
+	}
+	catch (const std::exception& xpt)
+	{
+		std::cerr << std::endl
+			<< "ERROR: "
+			<< xpt.what()
+			<< std::endl
+			<< std::endl;
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
@@ -47,6 +47,8 @@
 #include <cmath>           // fabs
 #include <queue>           // std::queue
 #include <list>            // std::list
+#include <algorithm>       // std::max
+#include <limits>          // std::numeric_limits
 #include <stdexcept>       // std::runtime_error
 
 
@@ -81,7 +83,7 @@ namespace MAT309
 	namespace cdt {
 
 	  	/**
-		 * \fn CDT::CDT(size_t numberOfPoints, const std::vector<spPoint>& points)
+		 * \fn CDT::CDT(size_t numberOfPoints, const std::vector<spPoint>& points, const MetricField& metric, BoundaryMode mode)
 		 *
 		 * \brief Creates a instance of this class, which represents a
 		 * CDT  of a  set of  points  and segments  defining a  Planar
@@ -89,12 +91,31 @@ namespace MAT309
 		 *
 		 * \param numberOfPoints The number of points.
 		 * \param points An array with the point coordinates.
+		 * \param metric The metric of the incircle test.
+		 * \param mode How the region outside the convex hull of the
+		 * points is handled during the construction.
 		 *
 		 */
 		CDT::CDT(
 			size_t numberOfPoints,
-			const std::vector<spPoint>& points
+			const std::vector<spPoint>& points,
+			const MetricField& metric,
+			BoundaryMode mode
 		)
+			:
+			_sedge(nullptr),
+			_numberOfSwaps(0),
+			_numberOfLocateSteps(0),
+			_numberOfStreamedPoints(0),
+			_umin(0),
+			_umax(0),
+			_vmin(0),
+			_vmax(0),
+			_isCollinear(true),
+			_isFinished(false),
+			_changedFaces(nullptr),
+			_metric(metric),
+			_mode(mode)
 		{
 			// Determine whether the input data is consistent.
 			if (numberOfPoints < 3)
@@ -146,15 +167,20 @@ namespace MAT309
 			max *= 3;
 			SetLargestAbsoluteValueOfCoordinate(max);
 
-			// Creates the three vertices of the enclosing triangle.
-			spPoint pa = std::make_shared<DtPoint>( max,    0);
-			spPoint pb = std::make_shared<DtPoint>(   0,  max);
-			spPoint pc = std::make_shared<DtPoint>(-max, -max);
+			if (_mode == BoundaryMode::EnclosingTriangle)
+			{
+				// Creates the three vertices of the enclosing triangle.
+				spPoint pa = std::make_shared<DtPoint>( max,    0);
+				spPoint pb = std::make_shared<DtPoint>(   0,  max);
+				spPoint pc = std::make_shared<DtPoint>(-max, -max);
 
-			// Creates the enclosing triangle.
-			CreateEnclosingTriangle(pa, pb, pc);
+				// Creates the enclosing triangle.
+				CreateEnclosingTriangle(pa, pb, pc);
+			}
 
-			// Insert the given points into the triangulation.
+			// Insert the given points into the triangulation.  In
+			// ghost vertex mode, the first triangle is created from
+			// the first three non-collinear points.
 			for (size_t i = 0; i < numberOfPoints; i++)
 			{
 				InsertPoint(points[i]);
@@ -163,14 +189,23 @@ namespace MAT309
 			// Remove  the enclosing  triangle of  the current  CDT as
 			// well as the triangles lying  outside the convex hull of
 			// the given point set.
-			RemoveEnclosingTriangle();
+			if (_mode == BoundaryMode::EnclosingTriangle)
+			{
+				RemoveEnclosingTriangle();
+			}
+			else
+			{
+				RemoveGhostVertex();
+			}
+
+			_isFinished = true;
 
 			return;
 		}
 
 
 		/**
-		 * \fn CDT::CDT(size_t numberOfPoints, size_t numberOfSegments, const std::vector<spPoint>& points, const std::vector<size_t>& segments)
+		 * \fn CDT::CDT(size_t numberOfPoints, size_t numberOfSegments, const std::vector<spPoint>& points, const std::vector<size_t>& segments, BoundaryMode mode)
 		 *
 		 * \brief Creates a instance of this class, which represents a
 		 * CDT  of a  set of  points  and segments  defining a  Planar
@@ -181,14 +216,30 @@ namespace MAT309
 		 * \param points An array with the point coordinates.
 		 * \param segments An array with  the ID's of the two vertices
 		 * of each segment.
+		 * \param mode How the region outside the convex hull of the
+		 * points is handled during the construction.
 		 *
 		 */
 		CDT::CDT(
 			size_t numberOfPoints,
 			size_t numberOfSegments,
 			const std::vector<spPoint>& points,
-			const std::vector<size_t>& segments
+			const std::vector<size_t>& segments,
+			BoundaryMode mode
 		)
+			:
+			_sedge(nullptr),
+			_numberOfSwaps(0),
+			_numberOfLocateSteps(0),
+			_numberOfStreamedPoints(0),
+			_umin(0),
+			_umax(0),
+			_vmin(0),
+			_vmax(0),
+			_isCollinear(true),
+			_isFinished(false),
+			_changedFaces(nullptr),
+			_mode(mode)
 		{
 		  	// Determine whether the input data is consistent.
 			if (numberOfPoints < 3)
@@ -215,148 +266,978 @@ namespace MAT309
 				segments
 			);
 
-			if (!isConsistent)
+			if (!isConsistent)
+			{
+				throw std::runtime_error("Either the given points are all collinear or a given line segment intersect the interior of another.");
+			}
+
+			// First, create the Delaunay  triangulation of the set of
+			// points.  Later,  we  insert   the  given  segments  and
+			// generate the CDT.
+
+			// Find  the  largest  absolute coordinate  of  the  given
+			// points.
+			double max = 0;
+
+			for (size_t i = 0; i < numberOfPoints; i++)
+			{
+				double u = fabs(points[i]->GetU());
+				double v = fabs(points[i]->GetV());
+
+				if (u > max)
+				{
+					max = u;
+				}
+
+				if (v > max)
+				{
+					max = v;
+				}
+			}
+
+			// Keep the value of the largest coordinate of a vertex of
+			// the enclosing triangle.  This value will be used in the
+			// incircle test.
+			max *= 3;
+			SetLargestAbsoluteValueOfCoordinate(max);
+
+			if (_mode == BoundaryMode::EnclosingTriangle)
+			{
+				// Creates the three vertices of the enclosing triangle.
+				spPoint pa = std::make_shared<DtPoint>( max,    0);
+				spPoint pb = std::make_shared<DtPoint>(   0,  max);
+				spPoint pc = std::make_shared<DtPoint>(-max, -max);
+
+				// Creates the enclosing triangle.
+				CreateEnclosingTriangle(pa, pb, pc);
+			}
+
+			// Insert the given points into the triangulation.  In
+			// ghost vertex mode, the first triangle is created from
+			// the first three non-collinear points.
+			for (size_t i = 0; i < numberOfPoints; i++)
+			{
+				InsertPoint(points[i]);
+			}
+
+			// The segments are inserted into the finished Delaunay
+			// triangulation when there is no enclosing triangle.
+			if (_mode == BoundaryMode::GhostVertex)
+			{
+				RemoveGhostVertex();
+			}
+
+			// Insert the segments and generate the CDT.
+			for (size_t i = 0; i < numberOfSegments; i++)
+			{
+				size_t j1 = segments[2 * i];
+				size_t j2 = segments[2 * i + 1];
+
+				InsertSegment(
+					points[j1],
+					points[j2]
+				);
+			}
+
+			// Remove  the enclosing  triangle of  the current  CDT as
+			// well as the triangles lying  outside the convex hull of
+			// the given point set.
+			if (_mode == BoundaryMode::EnclosingTriangle)
+			{
+				RemoveEnclosingTriangle();
+			}
+
+			_isFinished = true;
+
+			return;
+		}
+
+
+		/**
+		 * \fn CDT::CDT(double max, BoundaryMode mode)
+		 *
+		 * \brief Creates an instance of this class holding only an
+		 * enclosing triangle.
+		 *
+		 * \param max Maximum absolute value among the coordinates of
+		 * a vertex of the enclosing triangle.
+		 * \param mode How the region outside the convex hull of the
+		 * points is handled (in ghost vertex mode, no triangle is
+		 * created).
+		 *
+		 */
+		CDT::CDT(
+			double max,
+			BoundaryMode mode
+		)
+			:
+			_sedge(nullptr),
+			_numberOfSwaps(0),
+			_numberOfLocateSteps(0),
+			_numberOfStreamedPoints(0),
+			_umin(0),
+			_umax(0),
+			_vmin(0),
+			_vmax(0),
+			_isCollinear(true),
+			_isFinished(false),
+			_changedFaces(nullptr),
+			_mode(mode)
+		{
+			if (max <= 0)
+			{
+				throw std::runtime_error("The enclosing triangle must have a positive size.");
+			}
+
+			SetLargestAbsoluteValueOfCoordinate(max);
+
+			// The vertices of the enclosing triangle are three times as
+			// far from the origin as the farthest coordinate of a point.
+			_umin = _vmin = -max / 3;
+			_umax = _vmax = max / 3;
+
+			if (_mode == BoundaryMode::GhostVertex)
+			{
+				return;
+			}
+
+			// Creates the three vertices of the enclosing triangle.
+			spPoint pa = std::make_shared<DtPoint>( max,    0);
+			spPoint pb = std::make_shared<DtPoint>(   0,  max);
+			spPoint pc = std::make_shared<DtPoint>(-max, -max);
+
+			// Creates the enclosing triangle.
+			CreateEnclosingTriangle(pa, pb, pc);
+
+			return;
+		}
+
+
+		/**
+		 * \fn CDT::CDT(double umin, double umax, double vmin, double vmax, BoundaryMode mode)
+		 *
+		 * \brief Creates an instance of this class holding only an
+		 * enclosing triangle large enough for all points of the domain
+		 * [umin,umax] x [vmin,vmax].
+		 *
+		 * \param umin Lower bound for the first coordinate.
+		 * \param umax Upper bound for the first coordinate.
+		 * \param vmin Lower bound for the second coordinate.
+		 * \param vmax Upper bound for the second coordinate.
+		 * \param mode How the region outside the convex hull of the
+		 * points is handled during the construction.
+		 *
+		 */
+		CDT::CDT(
+			double umin,
+			double umax,
+			double vmin,
+			double vmax,
+			BoundaryMode mode
+		)
+			:
+			// As in the other constructors, the vertices of the enclosing
+			// triangle are three times as far from the origin as the
+			// farthest coordinate of a point.
+			CDT(
+				3 * std::max(
+						std::max(fabs(umin), fabs(umax)),
+						std::max(fabs(vmin), fabs(vmax))
+					),
+				mode
+			)
+		{
+			if ((umin >= umax) || (vmin >= vmax))
+			{
+				throw std::runtime_error("The domain of the triangulation must have a positive area.");
+			}
+
+			_umin = umin;
+			_umax = umax;
+			_vmin = vmin;
+			_vmax = vmax;
+
+			return;
+		}
+
+
+		/**
+		 * \fn CDT::~CDT()
+		 *
+		 * \brief  Releases the  memory held  by an  instance of  this
+		 * class.
+		 *
+		 */
+		CDT::~CDT()
+		{
+			FaceIterator fit = FacesBegin();
+
+			while (fit != FacesEnd())
+			{
+				Face* f = *fit;
+				++fit;
+				DeleteFace(f);
+			}
+
+			// Create a queue for storing edges.
+			std::queue<Edge*> q;
+
+			// Initialize it with the starting edge.  A ghost vertex CDT
+			// has no edges until it is given three non-collinear points.
+			Edge* efirst = GetStartingEdge();
+
+			if (efirst == nullptr)
+			{
+				return;
+			}
+
+			q.push(efirst);
+
+			// Mark the quad-edge of the starting edge as visited.
+			efirst->GetOwner()->SetMark(true);
+
+			// Visit all quad-edges.
+			while (!q.empty())
+			{
+				// Get the first edge of the queue.
+				Edge* e = q.front();
+				q.pop();
+
+				// Insert adjacent edges into the queue.
+				Edge* eaux;
+
+				eaux = e->OriginNext();
+				if (!eaux->GetOwner()->IsMarked())
+				{
+					q.push(eaux);
+					eaux->GetOwner()->SetMark(true);
+				}
+
+				eaux = e->OriginPrev();
+				if (!eaux->GetOwner()->IsMarked())
+				{
+					q.push(eaux);
+					eaux->GetOwner()->SetMark(true);
+				}
+
+				eaux = e->DestinationNext();
+				if (!eaux->GetOwner()->IsMarked())
+				{
+					q.push(eaux);
+					eaux->GetOwner()->SetMark(true);
+				}
+
+				eaux = e->DestinationPrev();
+				if (!eaux->GetOwner()->IsMarked())
+				{
+					q.push(eaux);
+					eaux->GetOwner()->SetMark(true);
+				}
+
+				// Remove the first quad-edge of the queue.
+				DeleteEdge(e);
+			}
+
+			return;
+		}
+
+
+		/**
+		 * \fn void CDT::InsertPoints(size_t numberOfPoints, const std::vector<spPoint>& points)
+		 *
+		 * \brief Inserts a batch of points into this triangulation.
+		 *
+		 * \param numberOfPoints The number of points.
+		 * \param points An array with the point coordinates.
+		 *
+		 */
+		void
+			CDT::InsertPoints(
+				size_t numberOfPoints,
+				const std::vector<spPoint>& points
+			)
+		{
+			if (_isFinished)
+			{
+				throw std::runtime_error("Points cannot be inserted after the triangulation is finished.");
+			}
+
+#ifdef DEBUGMODE
+			if (numberOfPoints > points.size())
+			{
+				throw std::runtime_error("The number of points informed is larger than the number of points in the array.");
+			}
+#endif
+
+			for (size_t i = 0; i < numberOfPoints; i++)
+			{
+				const spPoint& p = points[i];
+
+				// The points must lie in the domain the enclosing
+				// triangle was sized for.
+				if ((p->GetU() < _umin) || (p->GetU() > _umax) || (p->GetV() < _vmin) || (p->GetV() > _vmax))
+				{
+					throw std::runtime_error("A given point lies outside the domain of the triangulation.");
+				}
+
+				// Keep track of whether all points so far are collinear,
+				// as CheckInputConsistency() does for a complete set.
+				// The line is given by the first point and the first
+				// point at a different location.
+				if (_numberOfStreamedPoints == 0)
+				{
+					_streamAnchors[0] = p;
+				}
+				else if (_streamAnchors[1] == nullptr)
+				{
+					if (!HaveSameLocation(p, _streamAnchors[0]))
+					{
+						_streamAnchors[1] = p;
+					}
+				}
+				else if (_isCollinear)
+				{
+					_isCollinear = _preds.Collinear(
+						_streamAnchors[0]->GetU(),
+						_streamAnchors[0]->GetV(),
+						_streamAnchors[1]->GetU(),
+						_streamAnchors[1]->GetV(),
+						p->GetU(),
+						p->GetV()
+					);
+				}
+
+				++_numberOfStreamedPoints;
+
+				InsertPoint(p);
+			}
+
+			return;
+		}
+
+
+		/**
+		 * \fn void CDT::Finish()
+		 *
+		 * \brief Removes the enclosing triangle once all points have
+		 * been inserted with InsertPoints().
+		 *
+		 */
+		void CDT::Finish()
+		{
+			if (_isFinished)
+			{
+				throw std::runtime_error("The triangulation is already finished.");
+			}
+
+			if (_numberOfStreamedPoints < 3)
+			{
+				throw std::runtime_error("The number of points must be at least 3.");
+			}
+
+			if (_isCollinear)
+			{
+				throw std::runtime_error("The given points are all collinear.");
+			}
+
+			// Remove  the enclosing  triangle of  the current  CDT as
+			// well as the triangles lying  outside the convex hull of
+			// the given point set.
+			if (_mode == BoundaryMode::EnclosingTriangle)
+			{
+				RemoveEnclosingTriangle();
+			}
+			else
+			{
+				RemoveGhostVertex();
+			}
+
+			_isFinished = true;
+
+			return;
+		}
+
+
+		/**
+		 * \fn std::vector<Face*> CDT::Insert(spPoint p)
+		 *
+		 * \brief Inserts a point into this triangulation.
+		 *
+		 * \param p A pointer to the point.
+		 *
+		 * \return The faces incident to the new vertex.
+		 *
+		 */
+		std::vector<Face*>
+			CDT::Insert(
+				spPoint p
+			)
+		{
+			std::vector<Face*> faces;
+
+			// Locate the point in the current CDT.
+			Edge* e = Locate(p);
+
+			// If the point is already in the triangulation, there is
+			// nothing to do.
+			if (
+				HaveSameLocation(p, e->GetOrigin()->GetPoint())
+				||
+				HaveSameLocation(p, e->GetDestination()->GetPoint())
+				)
+			{
+				return faces;
+			}
+
+			// A point on a constrained edge splits it into two
+			// constrained halves, so the constraint is kept.
+			if (OnEdge(p, e) && e->IsConstrained())
+			{
+				Edge* first = SplitEdge(e, p);
+				Edge* eIter = first;
+
+				do
+				{
+					if (eIter->GetFace()->IsBounded())
+					{
+						faces.push_back(eIter->GetFace());
+					}
+
+					eIter = eIter->OriginNext();
+				} while (eIter != first);
+
+				return faces;
+			}
+
+			if (
+				OnEdge(p, e)
+				&&
+				(!e->GetFace()->IsBounded() || !e->Symmetric()->GetFace()->IsBounded())
+			   )
+			{
+				throw std::runtime_error("Attempt to insert a point on the boundary of the triangulation.");
+			}
+
+			// Insert the point as InsertPoint() does.
+			SplitEdgeOrTriangle(p, e);
+			RestoreDelaunayProperty(p, e);
+
+			// Every face created or changed  has the new vertex as a
+			// corner.  The  starting edge  still ends at  the new
+			// vertex, as the swaps only involve edges opposite to it.
+			Edge* first = GetStartingEdge()->Symmetric();
+
+#ifdef DEBUGMODE
+			if (!HaveSameLocation(p, first->GetOrigin()->GetPoint()))
+			{
+				throw std::runtime_error("Failed to find the vertex of an inserted point.");
+			}
+#endif
+
+			Edge* eIter = first;
+
+			do
+			{
+				faces.push_back(eIter->GetFace());
+				eIter = eIter->OriginNext();
+			} while (eIter != first);
+
+			return faces;
+		}
+
+
+		/**
+		 * \fn std::vector<Face*> CDT::Insert(spPoint p1, spPoint p2)
+		 *
+		 * \brief Inserts a constrained segment into this triangulation.
+		 *
+		 * \param p1 A pointer to an endpoint of the segment.
+		 * \param p2 A pointer to the other endpoint of the segment.
+		 *
+		 * \return The bounded faces created or changed by the insertion.
+		 *
+		 */
+		std::vector<Face*>
+			CDT::Insert(
+				spPoint p1,
+				spPoint p2
+			)
+		{
+			if (HaveSameLocation(p1, p2))
+			{
+				throw std::runtime_error("The endpoints of a segment must be distinct.");
+			}
+
+			// Insert the endpoints that are not vertices yet.
+			std::vector<Face*> faces = Insert(p1);
+			std::vector<Face*> faces2 = Insert(p2);
+
+			faces.insert(faces.end(), faces2.begin(), faces2.end());
+
+			// Collect the faces changed by the swaps that make room for
+			// the segment, and the faces on both sides of it.
+			_changedFaces = &faces;
+
+			try
+			{
+				InsertSegment(p1, p2);
+			}
+			catch (...)
+			{
+				_changedFaces = nullptr;
+				throw;
+			}
+
+			_changedFaces = nullptr;
+
+			// Drop the unbounded face and the repeated faces.
+			std::vector<Face*>::iterator last = std::remove_if(
+				faces.begin(),
+				faces.end(),
+				[](Face* f) { return (f == nullptr) || !f->IsBounded(); }
+			);
+
+			faces.erase(last, faces.end());
+
+			std::sort(faces.begin(), faces.end());
+			faces.erase(std::unique(faces.begin(), faces.end()), faces.end());
+
+			return faces;
+		}
+
+
+		/**
+		 * \fn std::vector<Face*> CDT::Remove(spPoint p)
+		 *
+		 * \brief Removes the vertex at the location of a point and
+		 * re-triangulates the hole it leaves.
+		 *
+		 * \param p A pointer to a point at the location of the vertex.
+		 *
+		 * \return The faces filling the hole.
+		 *
+		 */
+		std::vector<Face*>
+			CDT::Remove(
+				spPoint p
+			)
+		{
+			// Find an edge whose origin vertex is the one to be removed.
+			Edge* e = Locate(p);
+
+			if (!HaveSameLocation(p, e->GetOrigin()->GetPoint()))
+			{
+				e = e->Symmetric();
+
+				if (!HaveSameLocation(p, e->GetOrigin()->GetPoint()))
+				{
+					throw std::runtime_error("There is no vertex at the location of the given point.");
+				}
+			}
+
+			// Collect the edges incident to the vertex in CCW order.
+			// The destination vertices of these edges define the hole
+			// left by the vertex.
+			std::vector<Edge*> spokes;
+
+			Edge* eIter = e;
+
+			do
+			{
+				spokes.push_back(eIter);
+				eIter = eIter->OriginNext();
+			} while (eIter != e);
+
+			// A vertex on the boundary is reported as such, even if its
+			// boundary edges are constrained too.
+			for (Edge* s : spokes)
+			{
+				if ((s->GetFace() == nullptr) || !s->GetFace()->IsBounded())
+				{
+					throw std::runtime_error("Attempt to remove a vertex on the boundary of the triangulation.");
+				}
+			}
+
+			for (Edge* s : spokes)
+			{
+				if (s->IsConstrained())
+				{
+					throw std::runtime_error("Attempt to remove a vertex incident to a constrained edge.");
+				}
+			}
+
+			spPoint pv = e->GetOrigin()->GetPoint();
+
+			std::vector<Face*> faces;
+
+			// Cut ears off the hole until only a triangle is left.  An
+			// ear (a, b, c) at the destination b of a spoke is cut by
+			// swapping the spoke, which then connects a to c.  The
+			// ear must be convex, hold no other vertex of the hole in
+			// its circumcircle, and leave the vertex on the other
+			// side of ac (or, failing that, on ac itself).  Under a
+			// metric that varies over the domain, the circumcircle
+			// test may reject every ear; any other ear is then cut.
+			while (spokes.size() > 3)
+			{
+				const size_t k = spokes.size();
+
+				size_t ear = k;
+
+				for (int pass = 0; (pass < 4) && (ear == k); pass++)
+				{
+					const bool strict = ((pass % 2) == 0);
+					const bool delaunay = (pass < 2);
+
+					for (size_t i = 0; (i < k) && (ear == k); i++)
+					{
+						spPoint pa = spokes[(i + k - 1) % k]->GetDestination()->GetPoint();
+						spPoint pb = spokes[i]->GetDestination()->GetPoint();
+						spPoint pc = spokes[(i + 1) % k]->GetDestination()->GetPoint();
+
+						if (!_preds.Left(pa->GetU(), pa->GetV(), pb->GetU(), pb->GetV(), pc->GetU(), pc->GetV()))
+						{
+							continue;
+						}
+
+						bool separated = strict ?
+							_preds.Left(pa->GetU(), pa->GetV(), pc->GetU(), pc->GetV(), pv->GetU(), pv->GetV()) :
+							_preds.LeftOn(pa->GetU(), pa->GetV(), pc->GetU(), pc->GetV(), pv->GetU(), pv->GetV());
+
+						if (!separated)
+						{
+							continue;
+						}
+
+						bool empty = true;
+
+						for (size_t j = 2; (j + 1 < k) && empty && delaunay; j++)
+						{
+							empty = !InCircle(pa, pb, pc, spokes[(i + j) % k]->GetDestination()->GetPoint());
+						}
+
+						if (empty)
+						{
+							ear = i;
+						}
+					}
+				}
+
+				if (ear == k)
+				{
+					throw std::runtime_error("Failed to re-triangulate the hole left by a removed vertex.");
+				}
+
+				// Swap the spoke, as RestoreDelaunayProperty() does.
+				Edge* s = spokes[ear];
+
+				Swap(s);
+
+				s->GetFace()->SetEdge(s);
+				s->LeftPrev()->SetFace(s->GetFace());
+
+				s->Symmetric()->GetFace()->SetEdge(s->Symmetric());
+				s->Symmetric()->LeftPrev()->SetFace(s->Symmetric()->GetFace());
+
+				// The ear lies on the right of the swapped edge, which
+				// now goes from a to c.
+				faces.push_back(s->Symmetric()->GetFace());
+
+				spokes.erase(spokes.begin() + ear);
+			}
+
+			// The vertex now has three incident edges.  Remove them and
+			// their faces, and create a face for the triangle left.
+			Edge* link = spokes[0]->LeftNext();
+
+			for (size_t i = 0; i < 3; i++)
+			{
+				DeleteFace(spokes[i]->GetFace());
+			}
+
+			for (size_t i = 0; i < 3; i++)
+			{
+				if ((GetStartingEdge() == spokes[i]) || (GetStartingEdge() == spokes[i]->Symmetric()))
+				{
+					SetStartingEdge(link);
+				}
+
+				// Deleting the last edge releases the vertex as well.
+				DeleteEdge(spokes[i]);
+			}
+
+			Face* f = new Face();
+
+			f->SetEdge(link);
+			f->SetBounded(true);
+
+			link->SetFace(f);
+			link->LeftNext()->SetFace(f);
+			link->LeftPrev()->SetFace(f);
+
+			AddFace(f);
+
+			faces.push_back(f);
+
+			return faces;
+		}
+
+
+		/**
+		 * \fn size_t CDT::Refine(double minAngle, double maxArea, size_t maxNumberOfSteinerPoints, const PointFactory& factory)
+		 *
+		 * \brief Inserts Steiner vertices until every triangle meets
+		 * the given angle and area bounds.
+		 *
+		 * \param minAngle Minimum angle, in degrees, of a triangle.
+		 * \param maxArea Maximum area of a triangle.
+		 * \param maxNumberOfSteinerPoints Maximum number of vertices
+		 * to insert.
+		 * \param factory A function creating the points of the
+		 * inserted vertices.
+		 *
+		 * \return The number of inserted vertices.
+		 *
+		 */
+		size_t
+			CDT::Refine(
+				double minAngle,
+				double maxArea,
+				size_t maxNumberOfSteinerPoints,
+				const PointFactory& factory
+			)
+		{
+			if (!_isFinished)
+			{
+				throw std::runtime_error("Attempt to refine a triangulation before removing the enclosing triangle.");
+			}
+
+			if ((minAngle < 0) || (minAngle >= 60))
 			{
-				throw std::runtime_error("Either the given points are all collinear or a given line segment intersect the interior of another.");
+				throw std::runtime_error("The minimum angle of a triangle must be in [0, 60) degrees.");
 			}
 
-			// First, create the Delaunay  triangulation of the set of
-			// points.  Later,  we  insert   the  given  segments  and
-			// generate the CDT.
+			// A triangle has an angle smaller than \c minAngle if and
+			// only if the ratio of its circumradius to its shortest edge
+			// is larger than 1 / (2 sin(minAngle)).
+			const double maxRatio = (minAngle > 0) ?
+				0.5 / sin(minAngle * acos(-1) / 180) :
+				std::numeric_limits<double>::infinity();
 
-			// Find  the  largest  absolute coordinate  of  the  given
-			// points.
-			double max = 0;
+			const double areaBound = (maxArea > 0) ? maxArea : std::numeric_limits<double>::infinity();
 
-			for (size_t i = 0; i < numberOfPoints; i++)
+			// Segments that may be encroached upon, and bad triangles.
+			// Segments are never deleted and faces are never released
+			// while refining, so the queues hold no dangling pointers;
+			// entries that no longer apply are skipped when dequeued.
+			std::vector<Edge*> segments;
+			std::priority_queue<BadFace> faces;
+
+			auto enqueue = [&](Face* f)
 			{
-				double u = fabs(points[i]->GetU());
-				double v = fabs(points[i]->GetV());
+				double ratio;
+				double area;
 
-				if (u > max)
+				GetQuality(f, ratio, area);
+
+				if ((ratio > maxRatio) || (area > areaBound))
 				{
-					max = u;
+					Edge* e = f->GetEdge();
+
+					BadFace bad;
+
+					bad._ratio = ratio;
+					bad._face = f;
+					bad._corners[0] = e->GetOrigin()->GetPoint();
+					bad._corners[1] = e->GetDestination()->GetPoint();
+					bad._corners[2] = e->LeftPrev()->GetOrigin()->GetPoint();
+
+					faces.push(bad);
 				}
+			};
 
-				if (v > max)
+			for (EdgeIterator eit = _ledges.begin(); eit != _ledges.end(); ++eit)
+			{
+				if (IsSegment(*eit))
 				{
-					max = v;
+					segments.push_back(*eit);
 				}
 			}
 
-			// Keep the value of the largest coordinate of a vertex of
-			// the enclosing triangle.  This value will be used in the
-			// incircle test.
-			max *= 3;
-			SetLargestAbsoluteValueOfCoordinate(max);
-
-			// Creates the three vertices of the enclosing triangle.
-			spPoint pa = std::make_shared<DtPoint>( max,    0);
-			spPoint pb = std::make_shared<DtPoint>(   0,  max);
-			spPoint pc = std::make_shared<DtPoint>(-max, -max);
-
-			// Creates the enclosing triangle.
-			CreateEnclosingTriangle(pa, pb, pc);
-
-			// Insert the given points into the triangulation.
-			for (size_t i = 0; i < numberOfPoints; i++)
+			for (FaceIterator fit = _lfaces.begin(); fit != _lfaces.end(); ++fit)
 			{
-				InsertPoint(points[i]);
+				if ((*fit)->IsBounded())
+				{
+					enqueue(*fit);
+				}
 			}
 
-			// Insert the segments and generate the CDT.
-			for (size_t i = 0; i < numberOfSegments; i++)
+			size_t numberOfSteinerPoints = 0;
+
+			while ((maxNumberOfSteinerPoints == 0) || (numberOfSteinerPoints < maxNumberOfSteinerPoints))
 			{
-				size_t j1 = segments[2 * i];
-				size_t j2 = segments[2 * i + 1];
+				// Either a segment to split at its midpoint, or a point
+				// to insert into the left face of an edge.
+				Edge* segment = nullptr;
+				Edge* e = nullptr;
+				double u = 0;
+				double v = 0;
+
+				if (!segments.empty())
+				{
+					segment = segments.back();
+					segments.pop_back();
 
-				InsertSegment(
-					points[j1],
-					points[j2]
-				);
-			}
+					if (!IsEncroached(segment))
+					{
+						continue;
+					}
+				}
+				else if (!faces.empty())
+				{
+					BadFace bad = faces.top();
+					faces.pop();
 
-			// Remove  the enclosing  triangle of  the current  CDT as
-			// well as the triangles lying  outside the convex hull of
-			// the given point set.
-			RemoveEnclosingTriangle();
+					// Skip the triangle if its face has been reused.
+					Edge* fe = bad._face->GetEdge();
 
-			return;
-		}
+					size_t first = 0;
 
+					while ((first < 3) && (bad._corners[first] != fe->GetOrigin()->GetPoint()))
+					{
+						++first;
+					}
 
-		/**
-		 * \fn CDT::~CDT()
-		 *
-		 * \brief  Releases the  memory held  by an  instance of  this
-		 * class.
-		 *
-		 */
-		CDT::~CDT()
-		{
-			FaceIterator fit = FacesBegin();
+					if (
+						(first == 3)
+						||
+						(bad._corners[(first + 1) % 3] != fe->GetDestination()->GetPoint())
+						||
+						(bad._corners[(first + 2) % 3] != fe->LeftPrev()->GetOrigin()->GetPoint())
+					   )
+					{
+						continue;
+					}
 
-			while (fit != FacesEnd())
-			{
-				Face* f = *fit;
-				++fit;
-				DeleteFace(f);
-			}
+					// Compute the circumcenter of the triangle, relative
+					// to its first corner.
+					spPoint a = bad._corners[0];
+					spPoint b = bad._corners[1];
+					spPoint c = bad._corners[2];
 
-			// Create a queue for storing edges.
-			std::queue<Edge*> q;
+					double bu = b->GetU() - a->GetU();
+					double bv = b->GetV() - a->GetV();
+					double cu = c->GetU() - a->GetU();
+					double cv = c->GetV() - a->GetV();
 
-			// Initialize it with the starting edge.
-			Edge* efirst = GetStartingEdge();
+					double d = 2 * (bu * cv - bv * cu);
+					double b2 = bu * bu + bv * bv;
+					double c2 = cu * cu + cv * cv;
 
-			q.push(efirst);
+					u = a->GetU() + (cv * b2 - bv * c2) / d;
+					v = a->GetV() + (bu * c2 - cu * b2) / d;
 
-			// Mark the quad-edge of the starting edge as visited.
-			efirst->GetOwner()->SetMark(true);
+					spPoint p = std::make_shared<DtPoint>(u, v);
 
-			// Visit all quad-edges.
-			while (!q.empty())
-			{
-				// Get the first edge of the queue.
-				Edge* e = q.front();
-				q.pop();
+					bool blocked;
 
-				// Insert adjacent edges into the queue.
-				Edge* eaux;
+					e = WalkToward(p, fe, blocked);
 
-				eaux = e->OriginNext();
-				if (!eaux->GetOwner()->IsMarked())
+					if (blocked)
+					{
+						segment = e;
+					}
+					else
+					{
+						segment = FindEncroachedSegment(p, e);
+					}
+
+					if (segment != nullptr)
+					{
+						// Try the triangle again once the segment is split.
+						faces.push(bad);
+					}
+				}
+				else
 				{
-					q.push(eaux);
-					eaux->GetOwner()->SetMark(true);
+					break;
 				}
 
-				eaux = e->OriginPrev();
-				if (!eaux->GetOwner()->IsMarked())
+				Edge* star;
+
+				if (segment != nullptr)
 				{
-					q.push(eaux);
-					eaux->GetOwner()->SetMark(true);
-				}
+					spPoint a = segment->GetOrigin()->GetPoint();
+					spPoint b = segment->GetDestination()->GetPoint();
 
-				eaux = e->DestinationNext();
-				if (!eaux->GetOwner()->IsMarked())
+					u = 0.5 * (a->GetU() + b->GetU());
+					v = 0.5 * (a->GetV() + b->GetV());
+
+					star = SplitEdge(segment, factory ? factory(u, v) : std::make_shared<DtPoint>(u, v));
+				}
+				else
 				{
-					q.push(eaux);
-					eaux->GetOwner()->SetMark(true);
+					spPoint p = factory ? factory(u, v) : std::make_shared<DtPoint>(u, v);
+
+					// The circumcenter may lie on an (unconstrained) edge.
+					Edge* on = nullptr;
+					Edge* eIter = e;
+
+					for (unsigned i = 0; (i < 3) && (on == nullptr); i++)
+					{
+						if (OnEdge(p, eIter))
+						{
+							on = eIter;
+						}
+
+						eIter = eIter->LeftNext();
+					}
+
+					if (on != nullptr)
+					{
+						star = SplitEdge(on, p);
+					}
+					else
+					{
+						SplitEdgeOrTriangle(p, e);
+						RestoreDelaunayProperty(p, e);
+
+						star = GetStartingEdge()->Symmetric();
+					}
 				}
 
-				eaux = e->DestinationPrev();
-				if (!eaux->GetOwner()->IsMarked())
+				++numberOfSteinerPoints;
+
+				// Every face changed by the insertion is incident to the
+				// new vertex.  Check them and their segments again.
+				Edge* eIter = star;
+
+				do
 				{
-					q.push(eaux);
-					eaux->GetOwner()->SetMark(true);
-				}
+					Face* f = eIter->GetFace();
 
-				// Remove the first quad-edge of the queue.
-				DeleteEdge(e);
+					if (f->IsBounded())
+					{
+						enqueue(f);
+
+						Edge* t = eIter->LeftNext();
+
+						if (IsSegment(eIter))
+						{
+							segments.push_back(eIter);
+						}
+
+						if (IsSegment(t))
+						{
+							segments.push_back(t);
+						}
+					}
+
+					eIter = eIter->OriginNext();
+				} while (eIter != star);
 			}
 
-			return;
+			return numberOfSteinerPoints;
 		}
 
 
@@ -790,6 +1671,14 @@ namespace MAT309
 				spPoint p
 			)
 		{
+			// A ghost vertex CDT keeps the points until it can create
+			// its first triangle.
+			if (GetStartingEdge() == nullptr)
+			{
+				InsertPendingPoint(p);
+				return;
+			}
+
 			// Locate the point in the current CDT.
 			Edge* e = Locate(p);
 
@@ -974,51 +1863,258 @@ namespace MAT309
 					RestoreDelaunayProperty(slist);
 				}
 
-				if (HaveSameLocation(e->GetOrigin()->GetPoint(), p2))
-				{
-					done = true;
-				}
-				else {
-					e1 = e;
-				}
+				if (HaveSameLocation(e->GetOrigin()->GetPoint(), p2))
+				{
+					done = true;
+				}
+				else {
+					e1 = e;
+				}
+
+			} while (!done);
+
+			return;
+		}
+
+
+		/**
+		 * \fn void CDT::RemoveEnclosingTriangle()
+		 *
+		 * \brief  Remove the  enclosing  triangle  and all  triangles
+		 * adjacent to each one of its vertices (as these triangles do
+		 * not belong to the Delaunay triangulation of the given input
+		 * set of points).
+		 *
+		 */
+		void CDT::RemoveEnclosingTriangle()
+		{
+			// Find an edge of the enclosing triangle.
+			Edge* eNext = FindEnclosingTriangleEdge();
+
+			for (unsigned int i = 0; i < 3; i++)
+			{
+				// Set a  pointer to a  boundary edge incident  to the
+				// vertex  of the  enclosing  triangle  to be  removed
+				// along with its adjacent triangles.
+				Edge* eIter = eNext;
+
+				// Get the another boundary  edge of the triangulation
+				// before removing a vertex  of the enclosing triangle
+				// and its adjacent triangles.
+				eNext = eNext->Symmetric()->OriginNext();
+
+				// Remove a vertex of  the enclosing triangles and its
+				// adjacent triangles.
+				RemoveBoundaryVertex(eIter);
+			}
+
+			return;
+		}
+
+
+		/**
+		 * \fn void CDT::CreateGhostTriangle(spPoint pa, spPoint pb, spPoint pc)
+		 *
+		 * \brief Creates the first triangle of this CDT from three
+		 * of its points, and a ghost vertex connected to each of them,
+		 * so that every edge of the convex hull has a ghost triangle
+		 * on its outer side.
+		 *
+		 * \param pa First vertex of the triangle in a CCW traverse.
+		 * \param pb Second vertex of the triangle in a CCW traverse.
+		 * \param pc Third vertex of the triangle in a CCW traverse.
+		 *
+		 */
+		void
+			CDT::CreateGhostTriangle(
+				spPoint pa,
+				spPoint pb,
+				spPoint pc
+			)
+		{
+			// Create the triangle and the face outside it, as for an
+			// enclosing triangle.
+			CreateEnclosingTriangle(pa, pb, pc);
+
+			Edge* ea = GetStartingEdge();
+
+			// The ghost vertex is inserted into the face outside the
+			// triangle, which becomes one of the three ghost triangles.
+			// Its point has no coordinates:  the predicates recognize
+			// it by its address.
+			_ghostPoint = std::make_shared<DtPoint>(
+				std::numeric_limits<double>::quiet_NaN(),
+				std::numeric_limits<double>::quiet_NaN()
+			);
+
+			Edge* e = ea->Symmetric();
+			e->GetFace()->SetBounded(true);
+
+			SplitEdgeOrTriangle(_ghostPoint, e);
+
+			// Point location starts from the triangle.
+			SetStartingEdge(ea);
+
+			return;
+		}
+
+
+		/**
+		 * \fn void CDT::InsertPendingPoint(spPoint p)
+		 *
+		 * \brief Keeps a point given before the first triangle of a
+		 * ghost vertex CDT exists.  As soon as the points kept so far
+		 * include three non-collinear ones, the first triangle is
+		 * created and all of them are inserted.
+		 *
+		 * \param p A given point.
+		 *
+		 */
+		void
+			CDT::InsertPendingPoint(
+				spPoint p
+			)
+		{
+			_pending.push_back(p);
+
+			// Find a point distinct from the first one, and a third
+			// point not collinear with both.
+			const spPoint& pa = _pending[0];
+
+			size_t j = 1;
+			while ((j < _pending.size()) && HaveSameLocation(pa, _pending[j]))
+			{
+				++j;
+			}
+
+			size_t k = j + 1;
+			while (
+				   (k < _pending.size())
+				   &&
+				   _preds.Collinear(
+					   pa->GetU(),
+					   pa->GetV(),
+					   _pending[j]->GetU(),
+					   _pending[j]->GetV(),
+					   _pending[k]->GetU(),
+					   _pending[k]->GetV()
+				   )
+				  )
+			{
+				++k;
+			}
+
+			if (k >= _pending.size())
+			{
+				return;
+			}
+
+			// Create the first triangle with its vertices in CCW order.
+			if (
+				_preds.Left(
+					pa->GetU(),
+					pa->GetV(),
+					_pending[j]->GetU(),
+					_pending[j]->GetV(),
+					_pending[k]->GetU(),
+					_pending[k]->GetV()
+				)
+			   )
+			{
+				CreateGhostTriangle(pa, _pending[j], _pending[k]);
+			}
+			else
+			{
+				CreateGhostTriangle(pa, _pending[k], _pending[j]);
+			}
 
-			} while (!done);
+			// Insert all points kept so far.  The vertices of the
+			// triangle are discarded as duplicates.
+			std::vector<spPoint> pending;
+			pending.swap(_pending);
+
+			for (const spPoint& q : pending)
+			{
+				InsertPoint(q);
+			}
 
 			return;
 		}
 
 
 		/**
-		 * \fn void CDT::RemoveEnclosingTriangle()
+		 * \fn void CDT::RemoveGhostVertex()
 		 *
-		 * \brief  Remove the  enclosing  triangle  and all  triangles
-		 * adjacent to each one of its vertices (as these triangles do
-		 * not belong to the Delaunay triangulation of the given input
-		 * set of points).
+		 * \brief Removes the ghost vertex and its triangles, and turns
+		 * the cycle of edges of the convex hull into the unbounded
+		 * face.
 		 *
 		 */
-		void CDT::RemoveEnclosingTriangle()
+		void CDT::RemoveGhostVertex()
 		{
-			// Find an edge of the enclosing triangle.
-			Edge* eNext = FindEnclosingTriangleEdge();
+			// Find the ghost vertex.
+			Vertex* ghost = nullptr;
 
-			for (unsigned int i = 0; i < 3; i++)
+			for (VertexIterator vit = VertsBegin(); vit != VertsEnd(); ++vit)
 			{
-				// Set a  pointer to a  boundary edge incident  to the
-				// vertex  of the  enclosing  triangle  to be  removed
-				// along with its adjacent triangles.
-				Edge* eIter = eNext;
+				if (IsGhost((*vit)->GetPoint()))
+				{
+					ghost = *vit;
+					break;
+				}
+			}
 
-				// Get the another boundary  edge of the triangulation
-				// before removing a vertex  of the enclosing triangle
-				// and its adjacent triangles.
-				eNext = eNext->Symmetric()->OriginNext();
+#ifdef DEBUGMODE
+			if (ghost == nullptr)
+			{
+				throw std::runtime_error("The triangulation has no ghost vertex.");
+			}
+#endif
 
-				// Remove a vertex of  the enclosing triangles and its
-				// adjacent triangles.
-				RemoveBoundaryVertex(eIter);
+			// Collect the edges incident to the ghost vertex, and
+			// remove the ghost triangles.
+			std::vector<Edge*> spokes;
+
+			Edge* efirst = ghost->GetEdge();
+			Edge* e = efirst;
+
+			do
+			{
+				spokes.push_back(e);
+				DeleteFace(e->GetFace());
+				e = e->OriginNext();
+			} while (e != efirst);
+
+			// An edge of the convex hull, whose left face was a ghost
+			// triangle.
+			Edge* hull = efirst->LeftNext();
+
+			// Make sure the starting edge survives the removal.
+			SetStartingEdge(hull->Symmetric());
+
+			for (Edge* spoke : spokes)
+			{
+				DeleteEdge(spoke);
 			}
 
+			_ghostPoint = nullptr;
+
+			// Create the unbounded face from the cycle of edges of the
+			// convex hull.
+			Face* f = new Face();
+
+			f->SetEdge(hull);
+			f->SetBounded(false);
+
+			e = hull;
+			do
+			{
+				e->SetFace(f);
+				e = e->LeftNext();
+			} while (e != hull);
+
+			AddFace(f);
+
 			return;
 		}
 
@@ -1044,6 +2140,29 @@ namespace MAT309
 			// Starts the search from the starting edge of the CDT.
 			Edge* e = GetStartingEdge();
 
+			// With a ghost vertex, start from an edge of a triangle of
+			// the triangulation proper.  The walk only enters a ghost
+			// triangle if the point is outside the convex hull or on
+			// the line of one of its edges, and then stops in a ghost
+			// triangle strictly seeing the point, or on an edge of the
+			// convex hull holding it.
+			if (_ghostPoint != nullptr)
+			{
+				if (IsGhost(e->GetOrigin()->GetPoint()))
+				{
+					e = e->LeftNext();
+				}
+				else if (IsGhost(e->GetDestination()->GetPoint()))
+				{
+					e = e->LeftPrev();
+				}
+
+				if (IsGhost(e->LeftNext()->GetDestination()->GetPoint()))
+				{
+					e = e->Symmetric();
+				}
+			}
+
 			// Loop   over  the   triangles   of  this   triangulation
 			// (indirectly)  until  a  triangle containing  the  given
 			// point is found. Note that all points are supposed to be
@@ -1052,8 +2171,24 @@ namespace MAT309
 			// occurs).
 			bool end = false;
 
+#ifdef DEBUGMODE
+			// Each step  depends only on the current  edge, so a walk
+			// with more steps than there are edges repeats itself and
+			// never ends.
+			size_t steps = 0;
+#endif
+
 			while (!end)
 			{
+				++_numberOfLocateSteps;
+
+#ifdef DEBUGMODE
+				if (++steps > _ledges.size())
+				{
+					throw std::runtime_error("Point location does not terminate.");
+				}
+#endif
+
 				// If  the given  point coincides  with the  origin or
 				// destination vertex of edge \c e, then we return the
 				// edge itself.
@@ -1068,6 +2203,67 @@ namespace MAT309
 					// test for this symmetric edge.
 					e = e->Symmetric();
 				}
+				else if (
+					((e->GetFace() != nullptr) && !e->GetFace()->IsBounded())
+					||
+					IsGhost(e->LeftNext()->GetDestination()->GetPoint())
+					)
+				{
+					// The point is not on the right face of \c e, but
+					// the left face of \c e is outside the convex hull:
+					// the unbounded face, or a ghost triangle.  If the
+					// point is strictly on the left of \c e, it lies
+					// outside the triangulation, and  with a ghost vertex
+					// it lies in the ghost triangle.   Otherwise, it is
+					// on the supporting line of \c e, which is a side
+					// of the convex hull when the hull has collinear
+					// edges.  If  it is on \c  e itself, we  are done.
+					// If it is beyond either end of \c e, we follow the
+					// boundary toward it, and  find either the edge of
+					// the side holding it, or  a corner past which the
+					// point is strictly outside.  The ghost triangle of
+					// a collinear point  is never returned, as splitting
+					// it would create a triangle with no area.
+					spPoint po = e->GetOrigin()->GetPoint();
+					spPoint pd = e->GetDestination()->GetPoint();
+
+					bool ghost = (_ghostPoint != nullptr);
+
+					Predicates< double >::Orientation orient =
+						_preds.Classify(
+							po->GetU(),
+							po->GetV(),
+							pd->GetU(),
+							pd->GetV(),
+							p->GetU(),
+							p->GetV()
+						);
+
+					if (orient == Predicates<double>::Orientation::Between)
+					{
+						return e;
+					}
+					else if (orient == Predicates<double>::Orientation::Beyond)
+					{
+						// The next edge of the convex hull follows the
+						// ghost edge of the destination of \c e.
+						e = ghost ? e->LeftNext()->Symmetric()->LeftNext() : e->LeftNext();
+					}
+					else if (orient == Predicates<double>::Orientation::Behind)
+					{
+						// The previous edge of the convex hull precedes
+						// the ghost edge of the origin of \c e.
+						e = ghost ? e->LeftPrev()->Symmetric()->LeftPrev() : e->LeftPrev();
+					}
+					else if (ghost)
+					{
+						return e;
+					}
+					else
+					{
+						throw std::runtime_error("The given point lies outside the triangulation.");
+					}
+				}
 				else if (!RightOf(p, e->OriginNext()))
 				{
 					// The point  is not  on the right  face of  \c e.
@@ -1183,6 +2379,25 @@ namespace MAT309
 				// Update edge \c e.
 				e = eb->OriginPrev();
 
+#ifdef DEBUGMODE
+				// Make sure the new triangle has a positive area, unless
+				// it is a ghost triangle.
+				{
+					spPoint pa = eb->GetOrigin()->GetPoint();
+					spPoint pb = eb->GetDestination()->GetPoint();
+					spPoint pc = eb->LeftNext()->GetDestination()->GetPoint();
+
+					if (
+						!IsGhost(pa) && !IsGhost(pb) && !IsGhost(pc)
+						&&
+						!_preds.Left(pa->GetU(), pa->GetV(), pb->GetU(), pb->GetV(), pc->GetU(), pc->GetV())
+					   )
+					{
+						throw std::runtime_error("Attempt to create a triangle with no area.");
+					}
+				}
+#endif
+
 				// Create a new bounded face of this CDT.
 				Face* f = new Face();
 
@@ -1381,6 +2596,16 @@ namespace MAT309
 			// edge.
 			e->SetEndpoints(ea->GetDestination(), eb->GetDestination());
 
+			++_numberOfSwaps;
+
+			// The two faces incident to the edge are reused by the
+			// callers, so their addresses stay valid.
+			if (_changedFaces != nullptr)
+			{
+				_changedFaces->push_back(e->GetFace());
+				_changedFaces->push_back(e->Symmetric()->GetFace());
+			}
+
 			return;
 		}
 
@@ -1469,6 +2694,15 @@ namespace MAT309
 			spPoint po = e->GetOrigin()->GetPoint();
 			spPoint pd = e->GetDestination()->GetPoint();
 
+			// Nothing is to the right of an edge incident to the ghost
+			// vertex, and the ghost vertex is to the right of every
+			// edge, so the faces across edges of the convex hull are
+			// always given to the incircle test.
+			if (IsGhost(p) || IsGhost(po) || IsGhost(pd))
+			{
+				return true;
+			}
+
 			bool res = _preds.LeftOn(
 				po->GetU(),
 				po->GetV(),
@@ -1504,6 +2738,11 @@ namespace MAT309
 			spPoint po = e->GetOrigin()->GetPoint();
 			spPoint pd = e->GetDestination()->GetPoint();
 
+			if (IsGhost(p) || IsGhost(po) || IsGhost(pd))
+			{
+				return false;
+			}
+
 			Predicates< double >::Orientation orient =
 				_preds.Classify(
 					po->GetU(),
@@ -1548,6 +2787,13 @@ namespace MAT309
 				spPoint d
 			)
 		{
+			// The ghost vertex has no coordinates, and is dealt with
+			// symbolically.
+			if (IsGhost(a) || IsGhost(b) || IsGhost(c) || IsGhost(d))
+			{
+				return InCircleWithGhost(a, b, c, d);
+			}
+
 			// To  make  sure that  the  enclosing  triangle does  not
 			// interfere  with the  Delaunay triangulation,  we use  a
 			// slight modification  of the  strategy suggested  in the
@@ -1591,6 +2837,11 @@ namespace MAT309
 			{
 				// None of  \c a, \c  b, and \c c  is a vertex  of the
 				// enclosing triangle.
+				if (_metric)
+				{
+					return InCircleUnderMetric(a, b, c, d);
+				}
+
 				bool res = _preds.InCircle(
 					a->GetU(),
 					a->GetV(),
@@ -1601,57 +2852,202 @@ namespace MAT309
 					d->GetU(),
 					d->GetV()
 				);
-				return res;
-			}
-
-			if ((rankPointB > rankPointC) && (rankPointB > rankPointA))
-			{
-				// Point \c b  is a vertex of  the enclosing triangle,
-				// and  maybe one  of  \c a  and \c  c  is special  as
-				// well.   However,   either  the   quadrilateral   \c
-				// [a,b,c,d] is  not strictly convex or  edge \c [b,d]
-				// intersects edge  \c [a,c].  In the  former case, we
-				// cannot flip \c  [a,c].  In the latter  case, we can
-				// conclude that  \c [a,c] belongs to  the convex hull
-				// of  the original  input point  set.  So,  in either
-				// case, edge \c [a,c] should  never be flipped and we
-				// return false.
-
-				return false;
+				return res;
+			}
+
+			if ((rankPointB > rankPointC) && (rankPointB > rankPointA))
+			{
+				// Point \c b  is a vertex of  the enclosing triangle,
+				// and  maybe one  of  \c a  and \c  c  is special  as
+				// well.   However,   either  the   quadrilateral   \c
+				// [a,b,c,d] is  not strictly convex or  edge \c [b,d]
+				// intersects edge  \c [a,c].  In the  former case, we
+				// cannot flip \c  [a,c].  In the latter  case, we can
+				// conclude that  \c [a,c] belongs to  the convex hull
+				// of  the original  input point  set.  So,  in either
+				// case, edge \c [a,c] should  never be flipped and we
+				// return false.
+
+				return false;
+			}
+
+			// If we reach  this point, then we know for  sure that at
+			// least one of \c  a, \c b, and \c c  is a special point,
+			// but \c b is not special  or it is not the special point
+			// with the  largest rank. So,  we should always  flip the
+			// edge, except  for case in  which \c [a,b,c,d] is  not a
+			// strictly convex quadrilateral. That is, if \c [a,b,c,d]
+			// is strictly convex, then we should always keep the edge
+			// that is incident  to the vertex of  least rank (between
+			// \c  b  and the  one  of  \c a  and  \c  c with  largest
+			// rank). This  arbitrary rule ensures that  the algorithm
+			// does not loop forever swapping the same edges.
+			bool res1 = _preds.Left(
+				b->GetU(),
+				b->GetV(),
+				c->GetU(),
+				c->GetV(),
+				d->GetU(),
+				d->GetV()
+			);
+
+			bool res2 = _preds.LeftOn(
+				b->GetU(),
+				b->GetV(),
+				a->GetU(),
+				a->GetV(),
+				d->GetU(),
+				d->GetV()
+			);
+
+			// Return  true  if  and  only if  [a,b,c,d]  is  strictly
+			// convex.
+			return res1 && !res2;
+		}
+
+
+		/**
+		 * \fn bool CDT::InCircleWithGhost(spPoint a, spPoint b, spPoint c, spPoint d)
+		 *
+		 * \brief Applies the incircle test to four points at least one
+		 * of which is the ghost vertex.
+		 *
+		 * \param a First point defining a circle.
+		 * \param b Second point defining a circle.
+		 * \param c Third point defining a circle.
+		 * \param d A point to be tested against the incircle test.
+		 *
+		 * \return The Boolean value true if  the test point is in the
+		 * interior of the  circle defined by the  other three points,
+		 * and false otherwise.
+		 *
+		 */
+		bool
+			CDT::InCircleWithGhost(
+				spPoint a,
+				spPoint b,
+				spPoint c,
+				spPoint d
+			)
+		{
+			// The ghost vertex is outside every circle.
+			if (IsGhost(d))
+			{
+				return false;
+			}
+
+			// Rotate the CCW triangle [a,b,c] so that the ghost vertex
+			// is its last vertex.  The "circle" through \c a, \c b, and
+			// the ghost vertex is then the open half-plane to the left
+			// of the line through \c a and \c b, together with the open
+			// segment [a,b].  A point on that line but outside the
+			// segment is not inside, so a point collinear with an edge
+			// of the convex hull is never joined to it by a triangle
+			// with no area.
+			if (IsGhost(a))
+			{
+				a = b;
+				b = c;
+			}
+			else if (IsGhost(b))
+			{
+				b = a;
+				a = c;
+			}
+
+			Predicates< double >::Orientation orient =
+				_preds.Classify(
+					a->GetU(),
+					a->GetV(),
+					b->GetU(),
+					b->GetV(),
+					d->GetU(),
+					d->GetV()
+				);
+
+			return
+				(orient == Predicates<double>::Orientation::Left   )
+				||
+				(orient == Predicates<double>::Orientation::Between);
+		}
+
+
+		/**
+		 * \fn bool CDT::InCircleUnderMetric(spPoint a, spPoint b, spPoint c, spPoint d)
+		 *
+		 * \brief Applies the incircle test to four points using the
+		 * metric tensor at their centroid.
+		 *
+		 * \param a First point defining a circle.
+		 * \param b Second point defining a circle.
+		 * \param c Third point defining a circle.
+		 * \param d A point to be tested against the incircle test.
+		 *
+		 * \return The Boolean value true if the test point is in the
+		 * interior of the circle defined by the other three points
+		 * under the metric, and false otherwise.
+		 *
+		 */
+		bool
+			CDT::InCircleUnderMetric(
+				spPoint a,
+				spPoint b,
+				spPoint c,
+				spPoint d
+			)
+		{
+			double cu = 0.25 * (a->GetU() + b->GetU() + c->GetU() + d->GetU());
+			double cv = 0.25 * (a->GetV() + b->GetV() + c->GetV() + d->GetV());
+
+			double e;
+			double f;
+			double g;
+
+			_metric(cu, cv, e, f, g);
+
+			// Factor the tensor [e f; f g] as L L^T, with L lower
+			// triangular.  The squared length of a vector x under the
+			// metric is the squared Euclidean length of L^T x.
+			double l11 = (e > 0) ? sqrt(e) : 0;
+			double l21 = (l11 > 0) ? (f / l11) : 0;
+			double l22 = g - l21 * l21;
+
+			if ((l11 == 0) || !(l22 > 1e-12 * (e + g)))
+			{
+				return _preds.InCircle(
+					a->GetU(),
+					a->GetV(),
+					b->GetU(),
+					b->GetV(),
+					c->GetU(),
+					c->GetV(),
+					d->GetU(),
+					d->GetV()
+				);
 			}
 
-			// If we reach  this point, then we know for  sure that at
-			// least one of \c  a, \c b, and \c c  is a special point,
-			// but \c b is not special  or it is not the special point
-			// with the  largest rank. So,  we should always  flip the
-			// edge, except  for case in  which \c [a,b,c,d] is  not a
-			// strictly convex quadrilateral. That is, if \c [a,b,c,d]
-			// is strictly convex, then we should always keep the edge
-			// that is incident  to the vertex of  least rank (between
-			// \c  b  and the  one  of  \c a  and  \c  c with  largest
-			// rank). This  arbitrary rule ensures that  the algorithm
-			// does not loop forever swapping the same edges.
-			bool res1 = _preds.Left(
-				b->GetU(),
-				b->GetV(),
-				c->GetU(),
-				c->GetV(),
-				d->GetU(),
-				d->GetV()
-			);
-
-			bool res2 = _preds.LeftOn(
-				b->GetU(),
-				b->GetV(),
-				a->GetU(),
-				a->GetV(),
-				d->GetU(),
-				d->GetV()
+			l22 = sqrt(l22);
+
+			// Map the points, relative to their centroid, by L^T.
+			double au = a->GetU() - cu;
+			double av = a->GetV() - cv;
+			double bu = b->GetU() - cu;
+			double bv = b->GetV() - cv;
+			double ccu = c->GetU() - cu;
+			double ccv = c->GetV() - cv;
+			double du = d->GetU() - cu;
+			double dv = d->GetV() - cv;
+
+			return _preds.InCircle(
+				l11 * au + l21 * av,
+				l22 * av,
+				l11 * bu + l21 * bv,
+				l22 * bv,
+				l11 * ccu + l21 * ccv,
+				l22 * ccv,
+				l11 * du + l21 * dv,
+				l22 * dv
 			);
-
-			// Return  true  if  and  only if  [a,b,c,d]  is  strictly
-			// convex.
-			return res1 && !res2;
 		}
 
 
@@ -1756,6 +3152,17 @@ namespace MAT309
 				// triangulation.  Otherwise, only one is.
 				if (eNext == eLast)
 				{
+					// The last edge is removed as well, so it cannot
+					// be the starting edge either.  The edge opposite
+					// to the vertex in the last triangle survives.
+					if (
+						(eLast == GetStartingEdge()) ||
+						(eLast->Symmetric() == GetStartingEdge())
+						)
+					{
+						SetStartingEdge(eIter->LeftNext());
+					}
+
 					RemoveBoundaryTriangleAndVertex(eIter, eLast);
 					done = true;
 				}
@@ -2786,6 +4193,392 @@ namespace MAT309
 			return;
 		}
 
+
+		/**
+		 * \fn void CDT::GetQuality(Face* f, double& ratio, double& area) const
+		 *
+		 * \brief Computes the shape and size of a bounded face.
+		 *
+		 * \param f A pointer to a bounded face.
+		 * \param ratio A reference to the ratio of circumradius to
+		 * shortest edge of the face.
+		 * \param area A reference to the area of the face.
+		 *
+		 */
+		void
+			CDT::GetQuality(
+				Face* f,
+				double& ratio,
+				double& area
+			)
+			const
+		{
+			Edge* e = f->GetEdge();
+
+			spPoint a = e->GetOrigin()->GetPoint();
+			spPoint b = e->GetDestination()->GetPoint();
+			spPoint c = e->LeftPrev()->GetOrigin()->GetPoint();
+
+			double ab = hypot(b->GetU() - a->GetU(), b->GetV() - a->GetV());
+			double bc = hypot(c->GetU() - b->GetU(), c->GetV() - b->GetV());
+			double ca = hypot(a->GetU() - c->GetU(), a->GetV() - c->GetV());
+
+			area = 0.5 * (
+				(b->GetU() - a->GetU()) * (c->GetV() - a->GetV()) -
+				(b->GetV() - a->GetV()) * (c->GetU() - a->GetU())
+			);
+
+			// The circumradius is (ab * bc * ca) / (4 * area).
+			double shortest = std::min(ab, std::min(bc, ca));
+
+			if (area <= 0)
+			{
+				ratio = std::numeric_limits<double>::infinity();
+			}
+			else
+			{
+				ratio = (ab * bc * ca) / (4 * area * shortest);
+			}
+
+			return;
+		}
+
+
+		/**
+		 * \fn Edge* CDT::WalkToward(spPoint p, Edge* e, bool& blocked)
+		 *
+		 * \brief Walks along the line segment from the centroid of
+		 * the left face of a given edge to a given point, until the
+		 * face containing the point or a segment is reached.
+		 *
+		 * \param p A pointer to a point.
+		 * \param e A pointer to an edge of the starting face.
+		 * \param blocked A reference to a flag set to true if a
+		 * segment was reached first.
+		 *
+		 * \return A pointer to the segment reached, or to an edge
+		 * whose left face contains the point.
+		 *
+		 */
+		Edge*
+			CDT::WalkToward(
+				spPoint p,
+				Edge* e,
+				bool& blocked
+			)
+		{
+			spPoint a = e->GetOrigin()->GetPoint();
+			spPoint b = e->GetDestination()->GetPoint();
+			spPoint c = e->LeftPrev()->GetOrigin()->GetPoint();
+
+			double gu = (a->GetU() + b->GetU() + c->GetU()) / 3;
+			double gv = (a->GetV() + b->GetV() + c->GetV()) / 3;
+
+			blocked = false;
+
+			for (size_t steps = 0; steps <= _lfaces.size(); steps++)
+			{
+				++_numberOfLocateSteps;
+
+				// Leave the current face through an edge having the
+				// point on its right side, preferring the edge crossed
+				// by the line segment.
+				Edge* exit = nullptr;
+				bool crossed = false;
+				Edge* eIter = e;
+
+				for (unsigned i = 0; i < 3; i++)
+				{
+					if (RightOf(p, eIter))
+					{
+						spPoint o = eIter->GetOrigin()->GetPoint();
+						spPoint d = eIter->GetDestination()->GetPoint();
+
+						bool crosses = (
+							_preds.LeftOn(gu, gv, p->GetU(), p->GetV(), o->GetU(), o->GetV())
+							!=
+							_preds.LeftOn(gu, gv, p->GetU(), p->GetV(), d->GetU(), d->GetV())
+						);
+
+						if ((exit == nullptr) || (crosses && !crossed))
+						{
+							exit = eIter;
+							crossed = crosses;
+						}
+					}
+
+					eIter = eIter->LeftNext();
+				}
+
+				if (exit == nullptr)
+				{
+					return e;
+				}
+
+				if (IsSegment(exit))
+				{
+					blocked = true;
+					return exit;
+				}
+
+				e = exit->Symmetric();
+			}
+
+			throw std::runtime_error("Failed to locate a point in the triangulation.");
+		}
+
+
+		/**
+		 * \fn Edge* CDT::FindEncroachedSegment(spPoint p, Edge* e)
+		 *
+		 * \brief Searches the faces whose circumcircles contain a
+		 * given point for a segment encroached upon by the point.
+		 *
+		 * \param p A pointer to a point.
+		 * \param e A pointer to an edge whose left face contains
+		 * the point.
+		 *
+		 * \return A pointer to an encroached segment, or nullptr if
+		 * there is none.
+		 *
+		 */
+		Edge*
+			CDT::FindEncroachedSegment(
+				spPoint p,
+				Edge* e
+			)
+		{
+			std::vector<Face*> visited(1, e->GetFace());
+			std::vector<Edge*> elist = { e, e->LeftNext(), e->LeftPrev() };
+
+			while (!elist.empty())
+			{
+				Edge* eIter = elist.back();
+				elist.pop_back();
+
+				if (IsSegment(eIter))
+				{
+					if (Encroaches(p, eIter))
+					{
+						return eIter;
+					}
+
+					continue;
+				}
+
+				// Cross the edge if the circumcircle of the face on the
+				// other side contains the point.
+				Edge* q = eIter->Symmetric();
+
+				if (std::find(visited.begin(), visited.end(), q->GetFace()) != visited.end())
+				{
+					continue;
+				}
+
+				if (
+					InCircle(
+						q->GetOrigin()->GetPoint(),
+						q->GetDestination()->GetPoint(),
+						q->LeftPrev()->GetOrigin()->GetPoint(),
+						p
+					)
+				   )
+				{
+					visited.push_back(q->GetFace());
+					elist.push_back(q->LeftNext());
+					elist.push_back(q->LeftPrev());
+				}
+			}
+
+			return nullptr;
+		}
+
+
+		/**
+		 * \fn Edge* CDT::SplitEdge(Edge* e, spPoint p)
+		 *
+		 * \brief Inserts a vertex in the interior of a given edge,
+		 * and swaps edges to restore the property of being a CDT.
+		 *
+		 * \param e A pointer to an edge.
+		 * \param p A pointer to a point in the interior of \c e.
+		 *
+		 * \return A pointer to an edge whose origin is the new vertex.
+		 *
+		 */
+		Edge*
+			CDT::SplitEdge(
+				Edge* e,
+				spPoint p
+			)
+		{
+			// Make sure the left face of \c e is bounded.
+			if (!e->GetFace()->IsBounded())
+			{
+				e = e->Symmetric();
+			}
+
+			//
+			// Edge \c e goes from  a to b, its left face is [a, b, c],
+			// and its right face is either [b, a, d] or unbounded.
+			//
+			Vertex* va = e->GetOrigin();
+			Vertex* vb = e->GetDestination();
+
+			Face* fl = e->GetFace();
+			Face* fr = e->Symmetric()->GetFace();
+
+			Edge* eca = e->LeftPrev();
+			Edge* edb = e->Symmetric()->LeftPrev();
+
+			// Create the new vertex, and an edge from it to b.
+			Vertex* vm = new Vertex(p, nullptr);
+			AddVertex(vm);
+
+			QuadEdge* qe = new QuadEdge();
+			Edge* em = qe->GetEdge(0);
+
+			AddEdge(em);
+			AddEdge(em->Symmetric());
+
+			em->SetConstrained(e->IsConstrained());
+
+			// Replace the symmetric of \c e by the symmetric of the new
+			// edge in the star of b, and make \c e end at the new
+			// vertex.
+			Edge* ebPrev = e->Symmetric()->OriginPrev();
+
+			e->Symmetric()->Splice(ebPrev);
+			em->Symmetric()->Splice(ebPrev);
+
+			em->Splice(e->Symmetric());
+
+			e->SetEndpoints(va, vm);
+			em->SetEndpoints(vm, vb);
+
+			vm->SetEdge(em);
+			vb->SetEdge(em->Symmetric());
+
+			std::vector<Edge*> elist;
+
+			// Split [a, m, b, c] into [a, m, c], which keeps the face
+			// of \c e, and [m, b, c].
+			Connect(e, eca);
+
+			fl->SetEdge(e);
+			e->SetFace(fl);
+			e->LeftNext()->SetFace(fl);
+			e->LeftPrev()->SetFace(fl);
+
+			Face* f = new Face();
+
+			f->SetEdge(em);
+			f->SetBounded(true);
+
+			em->SetFace(f);
+			em->LeftNext()->SetFace(f);
+			em->LeftPrev()->SetFace(f);
+
+			AddFace(f);
+
+			elist.push_back(eca);
+			elist.push_back(em->LeftNext());
+
+			if (fr->IsBounded())
+			{
+				// Split [b, m, a, d] into [m, d, b], which keeps the
+				// right face of \c e, and [m, a, d].
+				Edge* emd = Connect(em->Symmetric(), edb);
+
+				fr->SetEdge(emd);
+				emd->SetFace(fr);
+				emd->LeftNext()->SetFace(fr);
+				emd->LeftPrev()->SetFace(fr);
+
+				f = new Face();
+
+				f->SetEdge(e->Symmetric());
+				f->SetBounded(true);
+
+				e->Symmetric()->SetFace(f);
+				e->Symmetric()->LeftNext()->SetFace(f);
+				e->Symmetric()->LeftPrev()->SetFace(f);
+
+				AddFace(f);
+
+				elist.push_back(e->Symmetric()->LeftNext());
+				elist.push_back(edb);
+			}
+			else
+			{
+				// The new edge is a boundary edge.
+				em->Symmetric()->SetFace(fr);
+			}
+
+			LegalizeEdges(elist);
+
+			return em;
+		}
+
+
+		/**
+		 * \fn void CDT::LegalizeEdges(std::vector<Edge*>& elist)
+		 *
+		 * \brief Swaps edges until the edges opposite to a new
+		 * vertex pass the incircle test.
+		 *
+		 * \param elist A reference to a list of edges having the new
+		 * vertex as the opposite vertex in their left faces.
+		 *
+		 */
+		void
+			CDT::LegalizeEdges(
+				std::vector<Edge*>& elist
+			)
+		{
+			while (!elist.empty())
+			{
+				Edge* e = elist.back();
+				elist.pop_back();
+
+				// Constrained and boundary edges are never swapped.
+				if (e->IsConstrained() || !e->Symmetric()->GetFace()->IsBounded())
+				{
+					continue;
+				}
+
+				Edge* ea = e->OriginPrev();
+				Edge* eb = e->Symmetric()->OriginPrev();
+
+				bool res = InCircle(
+					e->GetOrigin()->GetPoint(),
+					ea->GetDestination()->GetPoint(),
+					e->GetDestination()->GetPoint(),
+					e->LeftPrev()->GetOrigin()->GetPoint()
+				);
+
+				if (res)
+				{
+					// Swap edge \c e.
+					Swap(e);
+
+					// Update face pointers.
+					e->GetFace()->SetEdge(e);
+					e->LeftPrev()->SetFace(e->GetFace());
+
+					e->Symmetric()->GetFace()->SetEdge(e->Symmetric());
+					e->Symmetric()->LeftPrev()->SetFace(e->Symmetric()->GetFace());
+
+					// The two edges of the quadrilateral opposite to the
+					// new vertex are suspicious now.
+					elist.push_back(ea);
+					elist.push_back(eb->LeftPrev());
+				}
+			}
+
+			return;
+		}
+
 	}
 
 }
@@ -54,6 +54,7 @@
 #include <vector>          // std::vector
 #include <list>            // std::list
 #include <memory>          // std::shared_ptr
+#include <functional>      // std::function
 
 
 /**
@@ -170,6 +171,40 @@ namespace MAT309
 			typedef Vertex::spPoint spPoint;
 
 
+			/**
+			 * \typedef PointFactory
+			 *
+			 * \brief Alias for a function creating the point of a
+			 * Steiner vertex from its coordinates.
+			 *
+			 */
+			typedef std::function<spPoint (double u, double v)> PointFactory;
+
+
+			/**
+			 * \typedef MetricField
+			 *
+			 * \brief Alias for a function computing the coefficients
+			 * [e f; f g] of a metric tensor at a point.
+			 *
+			 */
+			typedef std::function<void (double u, double v, double& e, double& f, double& g)> MetricField;
+
+
+			/**
+			 * \enum BoundaryMode
+			 *
+			 * \brief Ways of  starting a triangulation before its points
+			 * are inserted.
+			 *
+			 */
+			enum class BoundaryMode
+			{
+				EnclosingTriangle,  ///< A large triangle enclosing all points, removed along with its incident triangles at the end.
+				GhostVertex         ///< A vertex at infinity connected to every hull vertex, handled symbolically by the predicates.
+			};
+
+
 		protected:
 
 			// -------------------------------------------------------
@@ -184,6 +219,21 @@ namespace MAT309
 			EdgeList _ledges;             ///< List of edges of this CDT.
 			FaceList _lfaces;             ///< List of faces of this CDT.
 			Predicates< double > _preds;  ///< A set of robust geometric predicates.
+			size_t _numberOfSwaps;        ///< Number of edge swaps (flips) performed so far.
+			size_t _numberOfLocateSteps;  ///< Number of edges visited by point location walks so far.
+			size_t _numberOfStreamedPoints;  ///< Number of points given to InsertPoints() so far.
+			spPoint _streamAnchors[2];    ///< The first point given to InsertPoints(), and the first one at a different location.
+			double _umin;                 ///< Lower bound for the first coordinate of a point given to InsertPoints().
+			double _umax;                 ///< Upper bound for the first coordinate of a point given to InsertPoints().
+			double _vmin;                 ///< Lower bound for the second coordinate of a point given to InsertPoints().
+			double _vmax;                 ///< Upper bound for the second coordinate of a point given to InsertPoints().
+			bool _isCollinear;            ///< A flag to indicate whether all points given to InsertPoints() are collinear.
+			bool _isFinished;             ///< A flag to indicate whether the enclosing triangle has been removed.
+			std::vector<Face*>* _changedFaces;  ///< If not null, collects the faces changed by edge swaps and constraints.
+			MetricField _metric;          ///< The metric of the incircle test (if empty, the Euclidean metric).
+			BoundaryMode _mode;           ///< How this triangulation handles the region outside the convex hull of its points.
+			spPoint _ghostPoint;          ///< The point of the ghost vertex (null unless the ghost vertex is in the triangulation).
+			std::vector<spPoint> _pending;  ///< Points waiting for the first three non-collinear points (ghost mode only).
 
 
 		public:
@@ -196,23 +246,29 @@ namespace MAT309
 
 
 		    /**
-			 * \fn CDT(size_t numberOfPoints, const std::vector<spPoint>& points)
+			 * \fn CDT(size_t numberOfPoints, const std::vector<spPoint>& points, const MetricField& metric = MetricField(), BoundaryMode mode = BoundaryMode::EnclosingTriangle)
 			 *
 			 * \brief  Creates   a  instance  of  this   class,  which
 			 * represents a Delaunay triangulation of a set of points.
 			 *
 			 * \param numberOfPoints The number of points.
 			 * \param points An array with the point coordinates.
+			 * \param metric The metric of the incircle test (see
+			 * SetMetric()).
+			 * \param mode How the region outside the convex hull of
+			 * the points is handled during the construction.
 			 *
 			 */
 			CDT(
 				size_t numberOfPoints,
-				const std::vector<spPoint>& points
+				const std::vector<spPoint>& points,
+				const MetricField& metric = MetricField(),
+				BoundaryMode mode = BoundaryMode::EnclosingTriangle
 			);
 			
 
 			/**
-			 * \fn CDT(size_t numberOfPoints, size_t numberOfSegments, const std::vector<spPoint>& points, const std::vector<size_t>& segments)
+			 * \fn CDT(size_t numberOfPoints, size_t numberOfSegments, const std::vector<spPoint>& points, const std::vector<size_t>& segments, BoundaryMode mode = BoundaryMode::EnclosingTriangle)
 			 *
 			 * \brief  Creates   a  instance  of  this   class,  which
 			 * represents  a  CDT of  a  set  of points  and  segments
@@ -223,13 +279,45 @@ namespace MAT309
 			 * \param points An array with the point coordinates.
 			 * \param  segments An  array  with the  ID's  of the  two
 			 * vertices of each segment.
+			 * \param mode How the region outside the convex hull of
+			 * the points is handled during the construction.
 			 *
 			 */
 			CDT(
 				size_t numberOfPoints,
 				size_t numberOfSegments,
 				const std::vector<spPoint>& points,
-				const std::vector<size_t>& segments
+				const std::vector<size_t>& segments,
+				BoundaryMode mode = BoundaryMode::EnclosingTriangle
+			);
+
+
+			/**
+			 * \fn CDT(double umin, double umax, double vmin, double vmax, BoundaryMode mode = BoundaryMode::EnclosingTriangle)
+			 *
+			 * \brief  Creates  an  instance  of  this  class  holding
+			 * only  an  enclosing triangle  large  enough  for all
+			 * points of  the domain [umin,umax] x [vmin,vmax].  Points
+			 * are  then  added  in  batches  with  InsertPoints(), as
+			 * they become available, and Finish() removes the
+			 * enclosing triangle.  In ghost vertex mode,  the
+			 * triangulation  stays empty until InsertPoints() has
+			 * been given three non-collinear points.
+			 *
+			 * \param umin Lower bound for the first coordinate.
+			 * \param umax Upper bound for the first coordinate.
+			 * \param vmin Lower bound for the second coordinate.
+			 * \param vmax Upper bound for the second coordinate.
+			 * \param mode How the region outside the convex hull of
+			 * the points is handled during the construction.
+			 *
+			 */
+			CDT(
+				double umin,
+				double umax,
+				double vmin,
+				double vmax,
+				BoundaryMode mode = BoundaryMode::EnclosingTriangle
 			);
 
 
@@ -321,6 +409,239 @@ namespace MAT309
 			}
 
 
+			/**
+			 * \fn void InsertPoints(size_t numberOfPoints, const std::vector<spPoint>& points)
+			 *
+			 * \brief Inserts a batch of points into this triangulation,
+			 * which must not be finished yet.  Points  already in the
+			 * triangulation are discarded.
+			 *
+			 * \param numberOfPoints The number of points.
+			 * \param points An array with the point coordinates.
+			 *
+			 */
+			void
+				InsertPoints(
+					size_t numberOfPoints,
+					const std::vector<spPoint>& points
+				);
+
+
+			/**
+			 * \fn void Finish()
+			 *
+			 * \brief  Removes  the  enclosing  triangle  once  all
+			 * points have been inserted with InsertPoints().
+			 *
+			 */
+			void Finish();
+
+
+			/**
+			 * \fn bool IsFinished() const
+			 *
+			 * \brief  Returns true  if and  only if  the enclosing
+			 * triangle has been removed.
+			 *
+			 * \return  The logic value  true if the  enclosing triangle
+			 * has been removed, and the logic value false otherwise.
+			 *
+			 */
+			bool IsFinished() const
+			{
+				return _isFinished;
+			}
+
+
+			/**
+			 * \fn BoundaryMode GetBoundaryMode() const
+			 *
+			 * \brief Returns how the region outside the convex hull of
+			 * the points is handled during the construction.
+			 *
+			 * \return The boundary mode of this triangulation.
+			 *
+			 */
+			BoundaryMode GetBoundaryMode() const
+			{
+				return _mode;
+			}
+
+
+			/**
+			 * \fn void SetMetric(const MetricField& metric)
+			 *
+			 * \brief Makes the incircle test measure distances with a
+			 * metric tensor field, such as the first fundamental form
+			 * of a surface parametrized over the domain, instead of the
+			 * Euclidean distance.  Each test evaluates the tensor at
+			 * the centroid of the four points involved and applies the
+			 * Euclidean test to the points mapped by the transpose of
+			 * its Cholesky factor, so the triangles are Delaunay (and
+			 * well shaped) as measured on the surface.  Only edges
+			 * tested afterwards are affected, so the metric should be
+			 * set before any point is inserted.  Refine() still bounds
+			 * angles and areas in the Euclidean metric.
+			 *
+			 * \param metric A function computing the coefficients of
+			 * the metric tensor at a point (if empty, the Euclidean
+			 * metric is used).
+			 *
+			 */
+			void
+				SetMetric(
+					const MetricField& metric
+				)
+			{
+				_metric = metric;
+			}
+
+
+			/**
+			 * \fn std::vector<Face*> Insert(spPoint p)
+			 *
+			 * \brief Inserts a point into this triangulation and
+			 * restores the Delaunay property locally.  The point must
+			 * lie in the interior of the triangulation (or, before
+			 * Finish() is called, of the enclosing triangle), or on a
+			 * constrained edge, which is then split into two
+			 * constrained edges.
+			 *
+			 * \param p A pointer to the point.
+			 *
+			 * \return The  faces created or  changed by the insertion,
+			 * which are the faces incident to the new vertex.  If a
+			 * vertex already exists at the location of \c p, nothing
+			 * changes and the returned array is empty.
+			 *
+			 */
+			std::vector<Face*>
+				Insert(
+					spPoint p
+				);
+
+
+			/**
+			 * \fn std::vector<Face*> Insert(spPoint p1, spPoint p2)
+			 *
+			 * \brief Inserts a constrained segment into this
+			 * triangulation.  Endpoints that are not vertices yet are
+			 * inserted first.  The segment must not cross the interior
+			 * of another constrained edge.
+			 *
+			 * \param p1 A pointer to an endpoint of the segment.
+			 * \param p2 A pointer to the other endpoint of the segment.
+			 *
+			 * \return The bounded faces created or changed by the
+			 * insertion.
+			 *
+			 */
+			std::vector<Face*>
+				Insert(
+					spPoint p1,
+					spPoint p2
+				);
+
+
+			/**
+			 * \fn std::vector<Face*> Remove(spPoint p)
+			 *
+			 * \brief Removes the vertex at the location of a point and
+			 * re-triangulates the hole it leaves.  The hole is filled
+			 * by cutting Delaunay ears (ears whose circumcircle holds
+			 * no other vertex of the hole), each cut being a swap of
+			 * an edge incident to the vertex, until the vertex has
+			 * three incident edges and can be removed.  Under a metric
+			 * that varies over the domain, where no ear may pass the
+			 * circumcircle test, the hole is filled with any ears.  The
+			 * vertex must be an interior vertex with no incident
+			 * constrained edge.
+			 *
+			 * \param p A pointer to a point at the location of the
+			 * vertex.
+			 *
+			 * \return The faces filling the hole.
+			 *
+			 */
+			std::vector<Face*>
+				Remove(
+					spPoint p
+				);
+
+
+			/**
+			 * \fn size_t Refine(double minAngle, double maxArea, size_t maxNumberOfSteinerPoints = 0, const PointFactory& factory = PointFactory())
+			 *
+			 * \brief Inserts Steiner vertices until every triangle has
+			 * no angle smaller than a given bound and no area larger
+			 * than another (Ruppert's Delaunay refinement).  Bad
+			 * triangles are handled worst first, the worst being the
+			 * one with the largest ratio of circumradius to shortest
+			 * edge.  A bad triangle gets a vertex at its circumcenter,
+			 * unless the circumcenter encroaches upon a segment (lies
+			 * in the diametral circle of a constrained or boundary
+			 * edge) or is hidden from the triangle by a segment, in
+			 * which case the segment is split at its midpoint.
+			 * Segments encroached upon by a vertex are always split
+			 * first.  Refinement always terminates for angle bounds up
+			 * to about 20.7 degrees, and usually does up to about 33.
+			 * Angles and areas are those of the domain, so on a
+			 * surface parametrized over the domain the triangles may
+			 * have smaller angles.  With a metric set (see
+			 * SetMetric()), a circumcenter need not remove its
+			 * triangle, and refinement may not terminate.
+			 *
+			 * \param minAngle Minimum angle, in degrees, of a triangle
+			 * (0 means no bound).
+			 * \param maxArea Maximum area of a triangle (0 means no
+			 * bound).
+			 * \param maxNumberOfSteinerPoints Maximum number of vertices
+			 * to insert (0 means no limit).
+			 * \param factory A function creating the points of the
+			 * inserted vertices (by default, plain DtPoint objects).
+			 *
+			 * \return The number of inserted vertices.
+			 *
+			 */
+			size_t
+				Refine(
+					double minAngle,
+					double maxArea,
+					size_t maxNumberOfSteinerPoints = 0,
+					const PointFactory& factory = PointFactory()
+				);
+
+
+			/**
+			 * \fn size_t GetNumberOfSwaps() const
+			 *
+			 * \brief Returns  the number  of edge swaps  (flips) performed
+			 * while building this CDT.
+			 *
+			 * \return The number of edge swaps performed so far.
+			 *
+			 */
+			size_t GetNumberOfSwaps() const
+			{
+				return _numberOfSwaps;
+			}
+
+
+			/**
+			 * \fn size_t GetNumberOfLocateSteps() const
+			 *
+			 * \brief Returns the number of  edges visited by the point
+			 * location walks performed so far.
+			 *
+			 * \return The number of edges visited by point location.
+			 *
+			 */
+			size_t GetNumberOfLocateSteps() const
+			{
+				return _numberOfLocateSteps;
+			}
+
+
 			/**
 			 * \fn size_t GetNumberOfVertices() const
 			 *
@@ -463,12 +784,55 @@ namespace MAT309
 
 		protected:
 
+			/**
+			 * \struct BadFace
+			 *
+			 * \brief This struct holds a triangle waiting to be
+			 * refined.  The corners are kept to tell whether the face
+			 * still holds the same triangle when it is dequeued.
+			 *
+			 */
+			struct BadFace
+			{
+				double _ratio;          ///< Ratio of circumradius to shortest edge of the triangle.
+				Face* _face;            ///< The face of the triangle.
+				spPoint _corners[3];    ///< The corners of the triangle.
+
+				bool operator<(const BadFace& f) const
+				{
+					return _ratio < f._ratio;
+				}
+			};
+
+
 			// -------------------------------------------------------
 			//
 			// Protected methods
 			//
 			// -------------------------------------------------------
 
+			/**
+			 * \fn CDT(double max, BoundaryMode mode = BoundaryMode::EnclosingTriangle)
+			 *
+			 * \brief  Creates  an  instance  of  this  class  holding
+			 * only  an  enclosing triangle  whose  vertices have  no
+			 * coordinate larger than \c max in absolute value.  It is
+			 * up to  derived classes to  insert points and  remove the
+			 * enclosing triangle.
+			 *
+			 * \param max Maximum absolute value among the coordinates
+			 * of a vertex of the enclosing triangle.
+			 * \param mode How the region outside the convex hull of
+			 * the points is handled (in ghost vertex mode, no
+			 * triangle is created).
+			 *
+			 */
+			CDT(
+				double max,
+				BoundaryMode mode = BoundaryMode::EnclosingTriangle
+			);
+
+
 			/**
 			 * \fn void SetStartingEdge(Edge* e)
 			 *
@@ -573,6 +937,77 @@ namespace MAT309
 			void RemoveEnclosingTriangle();
 
 
+			/**
+			 * \fn void CreateGhostTriangle(spPoint pa, spPoint pb, spPoint pc)
+			 *
+			 * \brief Creates the first triangle of this CDT from three
+			 * of its points, and a ghost vertex connected to each of
+			 * them,  so  that every edge of the convex hull has a
+			 * ghost triangle on its outer side.
+			 *
+			 * \param pa First vertex of the triangle in a CCW traverse.
+			 * \param pb Second vertex of the triangle in a CCW traverse.
+			 * \param pc Third vertex of the triangle in a CCW traverse.
+			 *
+			 */
+			void
+				CreateGhostTriangle(
+					spPoint pa,
+					spPoint pb,
+					spPoint pc
+				);
+
+
+			/**
+			 * \fn void InsertPendingPoint(spPoint p)
+			 *
+			 * \brief Keeps a point  given before the first triangle of
+			 * a ghost vertex CDT  exists.  As soon as the points kept
+			 * so far include three non-collinear ones, the first
+			 * triangle is created and all of them are inserted.
+			 *
+			 * \param p A given point.
+			 *
+			 */
+			void
+				InsertPendingPoint(
+					spPoint p
+				);
+
+
+			/**
+			 * \fn void RemoveGhostVertex()
+			 *
+			 * \brief Removes the ghost vertex and its triangles, and
+			 * turns the cycle of edges of the convex hull into the
+			 * unbounded face.
+			 *
+			 */
+			void RemoveGhostVertex();
+
+
+			/**
+			 * \fn bool IsGhost(const spPoint& p) const
+			 *
+			 * \brief Returns true if and only if a point is the point
+			 * of the ghost vertex.
+			 *
+			 * \param p A pointer to a point.
+			 *
+			 * \return The logic value true if the point is the point of
+			 * the ghost vertex, and the logic value false otherwise.
+			 *
+			 */
+			bool
+				IsGhost(
+					const spPoint& p
+				)
+				const
+			{
+				return (_ghostPoint != nullptr) && (p == _ghostPoint);
+			}
+
+
 			/**
 			 * \fn Edge* Locate(spPoint p)
 			 *
@@ -894,6 +1329,12 @@ namespace MAT309
 			{
 				e->SetConstrained(true);
 
+				if (_changedFaces != nullptr)
+				{
+					_changedFaces->push_back(e->GetFace());
+					_changedFaces->push_back(e->Symmetric()->GetFace());
+				}
+
 				return;
 			}
 
@@ -1099,6 +1540,241 @@ namespace MAT309
 
 
 
+			/**
+			 * \fn bool InCircleWithGhost(spPoint a, spPoint b, spPoint c, spPoint d)
+			 *
+			 * \brief Applies the incircle test to four points at least
+			 * one of which is the ghost vertex.  The circle through two
+			 * points and the ghost vertex is the open half-plane to the
+			 * left of the two points,  plus the open segment between
+			 * them,  and the ghost vertex is never inside a circle.
+			 *
+			 * \param a First point defining a circle.
+			 * \param b Second point defining a circle.
+			 * \param c Third point defining a circle.
+			 * \param d A point to be tested against the incircle test.
+			 *
+			 * \return The Boolean value true if  the test point is in
+			 * the interior of the circle defined by the other three
+			 * points, and false otherwise.
+			 *
+			 */
+			bool
+				InCircleWithGhost(
+					spPoint a,
+					spPoint b,
+					spPoint c,
+					spPoint d
+				);
+
+
+			/**
+			 * \fn bool InCircleUnderMetric(spPoint a, spPoint b, spPoint c, spPoint d)
+			 *
+			 * \brief Applies the incircle test to four points using the
+			 * metric tensor at their centroid.  If the tensor is not
+			 * positive definite, the Euclidean test is used.
+			 *
+			 * \param a First point defining a circle.
+			 * \param b Second point defining a circle.
+			 * \param c Third point defining a circle.
+			 * \param d A point to be tested against the incircle test.
+			 *
+			 * \return The Boolean value true if the test point is in the
+			 * interior of the circle (an ellipse in the parameter plane)
+			 * defined by the other three points, and false otherwise.
+			 *
+			 */
+			bool
+				InCircleUnderMetric(
+					spPoint a,
+					spPoint b,
+					spPoint c,
+					spPoint d
+				);
+
+
+			/**
+			 * \fn bool IsSegment(Edge* e) const
+			 *
+			 * \brief Returns true if and only if a given edge is a
+			 * constrained edge or a boundary edge.  Refinement never
+			 * swaps these edges, but splits them.
+			 *
+			 * \param e A pointer to an edge.
+			 *
+			 */
+			bool
+				IsSegment(
+					Edge* e
+				)
+				const
+			{
+				return e->IsConstrained() || !e->GetFace()->IsBounded() || !e->Symmetric()->GetFace()->IsBounded();
+			}
+
+
+			/**
+			 * \fn bool Encroaches(spPoint p, Edge* e) const
+			 *
+			 * \brief Returns true if and only if a given point lies in
+			 * the interior of the diametral circle of a given edge.
+			 *
+			 * \param p A pointer to a point.
+			 * \param e A pointer to an edge.
+			 *
+			 */
+			bool
+				Encroaches(
+					spPoint p,
+					Edge* e
+				)
+				const
+			{
+				spPoint a = e->GetOrigin()->GetPoint();
+				spPoint b = e->GetDestination()->GetPoint();
+
+				return (
+					(a->GetU() - p->GetU()) * (b->GetU() - p->GetU()) +
+					(a->GetV() - p->GetV()) * (b->GetV() - p->GetV())
+				) < 0;
+			}
+
+
+			/**
+			 * \fn bool IsEncroached(Edge* e) const
+			 *
+			 * \brief Returns true if and only if the vertex opposite to
+			 * a given edge in one of its bounded faces lies in the
+			 * interior of the diametral circle of the edge.
+			 *
+			 * \param e A pointer to an edge.
+			 *
+			 */
+			bool
+				IsEncroached(
+					Edge* e
+				)
+				const
+			{
+				return (
+					(e->GetFace()->IsBounded() && Encroaches(e->LeftPrev()->GetOrigin()->GetPoint(), e))
+					||
+					(e->Symmetric()->GetFace()->IsBounded() && Encroaches(e->Symmetric()->LeftPrev()->GetOrigin()->GetPoint(), e))
+				);
+			}
+
+
+			/**
+			 * \fn void GetQuality(Face* f, double& ratio, double& area) const
+			 *
+			 * \brief Computes the shape and size of a bounded face.
+			 *
+			 * \param f A pointer to a bounded face.
+			 * \param ratio A reference to the ratio of circumradius to
+			 * shortest edge of the face.
+			 * \param area A reference to the area of the face.
+			 *
+			 */
+			void
+				GetQuality(
+					Face* f,
+					double& ratio,
+					double& area
+				)
+				const;
+
+
+			/**
+			 * \fn Edge* WalkToward(spPoint p, Edge* e, bool& blocked)
+			 *
+			 * \brief Walks along the line segment from the centroid of
+			 * the left face of a given edge to a given point, until the
+			 * face containing the point or a segment is reached.
+			 *
+			 * \param p A pointer to a point.
+			 * \param e A pointer to an edge of the starting face.
+			 * \param blocked A reference to a flag set to true if a
+			 * segment was reached first.
+			 *
+			 * \return A pointer to the segment reached, or to an edge
+			 * whose left face contains the point (possibly on its
+			 * boundary).
+			 *
+			 */
+			Edge*
+				WalkToward(
+					spPoint p,
+					Edge* e,
+					bool& blocked
+				);
+
+
+			/**
+			 * \fn Edge* FindEncroachedSegment(spPoint p, Edge* e)
+			 *
+			 * \brief Searches the faces whose circumcircles contain a
+			 * given point, starting at the left face of a given edge,
+			 * for a segment encroached upon by the point.  These are
+			 * the segments that would be edges of the star of the point
+			 * if it were inserted.
+			 *
+			 * \param p A pointer to a point.
+			 * \param e A pointer to an edge whose left face contains
+			 * the point.
+			 *
+			 * \return A pointer to an encroached segment, or nullptr if
+			 * there is none.
+			 *
+			 */
+			Edge*
+				FindEncroachedSegment(
+					spPoint p,
+					Edge* e
+				);
+
+
+			/**
+			 * \fn Edge* SplitEdge(Edge* e, spPoint p)
+			 *
+			 * \brief Inserts a vertex in the interior of a given edge,
+			 * which may be a constrained or a boundary edge, and swaps
+			 * edges to restore the property of being a CDT.  The two
+			 * halves of the edge inherit its constrained flag.  Unlike
+			 * SplitEdgeOrTriangle(), no edge or face is deleted.
+			 *
+			 * \param e A pointer to an edge.
+			 * \param p A pointer to a point in the interior of \c e.
+			 *
+			 * \return A pointer to an edge whose origin is the new
+			 * vertex.
+			 *
+			 */
+			Edge*
+				SplitEdge(
+					Edge* e,
+					spPoint p
+				);
+
+
+			/**
+			 * \fn void LegalizeEdges(std::vector<Edge*>& elist)
+			 *
+			 * \brief Swaps  edges  until  the  edges  opposite  to  a
+			 * new vertex pass the incircle test.  Each edge  in the
+			 * given list has the new vertex as the opposite vertex in
+			 * its left face.
+			 *
+			 * \param elist A reference to a list of edges (emptied on
+			 * return).
+			 *
+			 */
+			void
+				LegalizeEdges(
+					std::vector<Edge*>& elist
+				);
+
+
 			/**
 			 * \fn bool HaveSameLocation(spPoint p, spPoint q) const
 			 *
@@ -259,6 +259,83 @@ namespace MAT309
 			return;
 		}
 
+
+		/**
+		 * \fn void FaceVisitor::Visit(CDT& cdt, const std::function<void (const spPoint&)>& vertex, const std::function<void (size_t, size_t, size_t)>& triangle)
+		 *
+		 * \brief Enumerates the vertices and then the triangles of a
+		 * CDT, handing each one to a callback instead of storing them.
+		 * The vertices are numbered exactly as by the other Visit()
+		 * method.
+		 *
+		 * \param  cdt A  CDT  represented by  the quad-edge  data
+		 * structure.
+		 * \param vertex A function called with the point attribute of
+		 * each vertex, in the order of the vertex indices.
+		 * \param triangle A function called with the indices of the
+		 * three vertices of each triangle.
+		 *
+		 */
+		void
+			FaceVisitor::Visit(
+				CDT& cdt,
+				const std::function<void (const spPoint&)>& vertex,
+				const std::function<void (size_t, size_t, size_t)>& triangle
+			)
+		{
+			_vertexList.clear();
+
+			// Number the vertices in the order they first appear in the
+			// bounded faces.  The other Visit() method reaches them in
+			// this same order through the unvisited edges of each face.
+			for (CDT::FaceIterator fit = cdt.FacesBegin(); fit != cdt.FacesEnd(); ++fit)
+			{
+				Face* f = *fit;
+
+				if (!f->IsBounded())
+				{
+					continue;
+				}
+
+				Edge* e = f->GetEdge();
+
+				for (int j = 0; j < 3; j++)
+				{
+					Vertex* v = e->GetOrigin();
+
+					if (_vertexList.find(v) == _vertexList.end())
+					{
+						_vertexList.insert(std::make_pair(v, _vertexList.size()));
+						vertex(v->GetPoint());
+					}
+
+					e = e->LeftNext();
+				}
+			}
+
+			// Get the index of the three vertices of each face.
+			for (CDT::FaceIterator fit = cdt.FacesBegin(); fit != cdt.FacesEnd(); ++fit)
+			{
+				Face* f = *fit;
+
+				if (!f->IsBounded())
+				{
+					continue;
+				}
+
+				size_t v1 = _vertexList[f->GetEdge()->GetOrigin()];
+				size_t v2 = _vertexList[f->GetEdge()->LeftNext()->GetOrigin()];
+				size_t v3 = _vertexList[f->GetEdge()->LeftPrev()->GetOrigin()];
+
+				triangle(v1, v2, v3);
+			}
+
+			// Clean up the temporary vertex list.
+			_vertexList.clear();
+
+			return;
+		}
+
 	}
 
 }
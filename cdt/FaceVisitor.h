@@ -50,7 +50,7 @@
 #include "Vertex.h"           // Vertex
 
 #include <map>                // map
-#include <functional>         // make_pair
+#include <functional>         // std::function, make_pair
 #include <vector>             // vector
 #include <list>               // list
 #include <stdexcept>          // std::runtime_error
@@ -209,6 +209,30 @@ namespace MAT309
 				);
 
 
+			/**
+			 * \fn void Visit(CDT& cdt, const std::function<void (const spPoint&)>& vertex, const std::function<void (size_t, size_t, size_t)>& triangle)
+			 *
+			 * \brief Enumerates the vertices and then the triangles of
+			 * a CDT, handing each one to a callback instead of storing
+			 * them.  The vertices are numbered  exactly as by the other
+			 * Visit() method.
+			 *
+			 * \param  cdt A  CDT  represented by  the quad-edge  data
+			 * structure.
+			 * \param vertex A function called with the point attribute
+			 * of each vertex, in the order of the vertex indices.
+			 * \param triangle A  function called with  the indices of
+			 * the three vertices of each triangle.
+			 *
+			 */
+			void
+				Visit(
+					CDT& cdt,
+					const std::function<void (const spPoint&)>& vertex,
+					const std::function<void (size_t, size_t, size_t)>& triangle
+				);
+
+
 			/**
 			 * \fn virtual void Visit( Face* f )
 			 *
@@ -0,0 +1,556 @@
+/**
+ * \file PointLocator.cpp
+ *
+ * \brief Implementation of class PointLocator, which answers point
+ * location and nearest vertex queries on a finished CDT.
+ *
+ * \author
+ * Marcelo Ferreira Siqueira \n
+ * Universidade Federal do Rio Grande do Norte, \n
+ * Departamento de Matem&aacute;tica, \n
+ * mfsiqueira at mat (dot) ufrn (dot) br
+ *
+ * \version 1.0
+ * \date October 2026
+ *
+ * \attention This program is distributed WITHOUT ANY WARRANTY, and it
+ *            may be freely redistributed under the condition that the
+ *            copyright notices  are not removed,  and no compensation
+ *            is received. Private, research, and institutional use is
+ *            free. Distribution of this  code as part of a commercial
+ *            system  is permissible ONLY  BY DIRECT  ARRANGEMENT WITH
+ *            THE AUTHOR.
+ */
+
+#include "PointLocator.h"        // PointLocator
+#include "../common/Parallel.h"  // ParallelFor
+
+#include <algorithm>             // std::min, std::max
+#include <cmath>                 // sqrt, ceil, floor
+#include <limits>                // std::numeric_limits
+#include <queue>                 // std::queue
+#include <stdexcept>             // std::runtime_error
+
+
+/**
+ * \defgroup MAT309NameSpace Namespace MAT309.
+ * @{
+ */
+
+/**
+ * \namespace MAT309
+ *
+ * \brief Global namespace for MAT309 software.
+ */
+
+namespace MAT309
+{
+
+	/**
+	 * \defgroup CDTNameSpace Namespace cdt.
+	 * @{
+	 */
+
+	 /**
+	  * \namespace cdt
+	  *
+	  * \brief   The  namespace   cdt  contains   the  definition   and
+	  * implementation of classes to build and manipulate a constrained
+	  * Delaunay  triangulation  (CDT)  using an  augmentation  of  the
+	  * quad-edge data structure.
+	  */
+
+	namespace cdt {
+
+		/**
+		 * \fn PointLocator::PointLocator(const CDT& cdt, double verticesPerCell)
+		 *
+		 * \brief Creates the grid of starting edges of a CDT.
+		 *
+		 * \param cdt A finished CDT.
+		 * \param verticesPerCell Average number of vertices of the CDT
+		 * per grid cell.
+		 *
+		 */
+		PointLocator::PointLocator(
+			const CDT& cdt,
+			double verticesPerCell
+		)
+		{
+			if (!cdt.IsFinished())
+			{
+				throw std::runtime_error("Points can only be located in a finished triangulation.");
+			}
+
+			if (verticesPerCell <= 0)
+			{
+				throw std::runtime_error("The number of vertices per cell must be positive.");
+			}
+
+			// Find the bounding box of the vertices.
+			_umin = std::numeric_limits<double>::max();
+			_vmin = std::numeric_limits<double>::max();
+
+			double umax = -std::numeric_limits<double>::max();
+			double vmax = -std::numeric_limits<double>::max();
+
+			for (CDT::VertexIterator vit = cdt.VertsBegin(); vit != cdt.VertsEnd(); ++vit)
+			{
+				spPoint p = (*vit)->GetPoint();
+
+				_umin = std::min(_umin, p->GetU());
+				_vmin = std::min(_vmin, p->GetV());
+				umax = std::max(umax, p->GetU());
+				vmax = std::max(vmax, p->GetV());
+			}
+
+			// Choose square-ish cells holding about \c verticesPerCell
+			// vertices each.  The vertices of a CDT are not collinear,
+			// so the box has a positive area.
+			double width = umax - _umin;
+			double height = vmax - _vmin;
+			double numberOfCells = std::max(1.0, double(cdt.GetNumberOfVertices()) / verticesPerCell);
+
+			_numberOfCellsU = size_t(std::max(1.0, std::ceil(sqrt(numberOfCells * width / height))));
+			_numberOfCellsV = size_t(std::max(1.0, std::ceil(numberOfCells / double(_numberOfCellsU))));
+
+			_cellWidth = width / double(_numberOfCellsU);
+			_cellHeight = height / double(_numberOfCellsV);
+
+			// The seed of a cell is an edge leaving the vertex nearest
+			// to the cell center among the vertices in the cell.
+			_seeds.assign(_numberOfCellsU * _numberOfCellsV, nullptr);
+			std::vector<double> distance(_seeds.size(), std::numeric_limits<double>::max());
+
+			for (CDT::VertexIterator vit = cdt.VertsBegin(); vit != cdt.VertsEnd(); ++vit)
+			{
+				spPoint p = (*vit)->GetPoint();
+
+				size_t i = std::min(_numberOfCellsU - 1, size_t((p->GetU() - _umin) / _cellWidth));
+				size_t j = std::min(_numberOfCellsV - 1, size_t((p->GetV() - _vmin) / _cellHeight));
+				size_t k = j * _numberOfCellsU + i;
+
+				double du = p->GetU() - (_umin + (i + 0.5) * _cellWidth);
+				double dv = p->GetV() - (_vmin + (j + 0.5) * _cellHeight);
+				double d = du * du + dv * dv;
+
+				if (d < distance[k])
+				{
+					distance[k] = d;
+					_seeds[k] = (*vit)->GetEdge();
+				}
+			}
+
+			// Empty cells take the seed of a nearby cell, found by a
+			// breadth-first search from the cells holding vertices.
+			std::queue<size_t> q;
+
+			for (size_t k = 0; k < _seeds.size(); k++)
+			{
+				if (_seeds[k] != nullptr)
+				{
+					q.push(k);
+				}
+			}
+
+			while (!q.empty())
+			{
+				size_t k = q.front();
+				q.pop();
+
+				size_t i = k % _numberOfCellsU;
+				size_t j = k / _numberOfCellsU;
+
+				size_t neighbours[4];
+				size_t numberOfNeighbours = 0;
+
+				if (i > 0) neighbours[numberOfNeighbours++] = k - 1;
+				if (i + 1 < _numberOfCellsU) neighbours[numberOfNeighbours++] = k + 1;
+				if (j > 0) neighbours[numberOfNeighbours++] = k - _numberOfCellsU;
+				if (j + 1 < _numberOfCellsV) neighbours[numberOfNeighbours++] = k + _numberOfCellsU;
+
+				for (size_t n = 0; n < numberOfNeighbours; n++)
+				{
+					if (_seeds[neighbours[n]] == nullptr)
+					{
+						_seeds[neighbours[n]] = _seeds[k];
+						q.push(neighbours[n]);
+					}
+				}
+			}
+
+			return;
+		}
+
+
+		/**
+		 * \fn bool PointLocator::Locate(double u, double v, Location& location) const
+		 *
+		 * \brief Finds the triangle containing a point.
+		 *
+		 * \param u First coordinate of the point.
+		 * \param v Second coordinate of the point.
+		 * \param location A reference to the triangle containing the
+		 * point and the barycentric coordinates of the point.
+		 *
+		 * \return The logic value true if the point lies in the CDT,
+		 * and the logic value false otherwise.
+		 *
+		 */
+		bool
+			PointLocator::Locate(
+				double u,
+				double v,
+				Location& location
+			)
+			const
+		{
+			Predicates<double>& preds = GetPredicates();
+
+			Edge* e = Walk(u, v, preds);
+
+			if (!e->GetFace()->IsBounded())
+			{
+				// The point is either on this boundary edge, and then
+				// in the triangle on the other side, or outside.
+				spPoint po = e->GetOrigin()->GetPoint();
+				spPoint pd = e->GetDestination()->GetPoint();
+
+				Predicates<double>::Orientation orient = preds.Classify(
+					po->GetU(),
+					po->GetV(),
+					pd->GetU(),
+					pd->GetV(),
+					u,
+					v
+				);
+
+				if (
+					(orient != Predicates<double>::Orientation::Origin)
+					&&
+					(orient != Predicates<double>::Orientation::Destination)
+					&&
+					(orient != Predicates<double>::Orientation::Between)
+				   )
+				{
+					location._face = nullptr;
+					return false;
+				}
+
+				e = e->Symmetric();
+			}
+
+			location._face = e->GetFace();
+			location._vertices[0] = e->GetOrigin();
+			location._vertices[1] = e->GetDestination();
+			location._vertices[2] = e->LeftNext()->GetDestination();
+
+			spPoint pa = location._vertices[0]->GetPoint();
+			spPoint pb = location._vertices[1]->GetPoint();
+			spPoint pc = location._vertices[2]->GetPoint();
+
+			// The barycentric coordinates are ratios of signed areas.
+			double area = preds.Orient2D(pa->GetU(), pa->GetV(), pb->GetU(), pb->GetV(), pc->GetU(), pc->GetV());
+
+			location._weights[0] = preds.Orient2D(u, v, pb->GetU(), pb->GetV(), pc->GetU(), pc->GetV()) / area;
+			location._weights[1] = preds.Orient2D(pa->GetU(), pa->GetV(), u, v, pc->GetU(), pc->GetV()) / area;
+			location._weights[2] = 1 - location._weights[0] - location._weights[1];
+
+			return true;
+		}
+
+
+		/**
+		 * \fn Vertex* PointLocator::FindNearestVertex(double u, double v) const
+		 *
+		 * \brief Finds the vertex nearest to a point.
+		 *
+		 * \param u First coordinate of the point.
+		 * \param v Second coordinate of the point.
+		 *
+		 * \return A pointer to the nearest vertex.
+		 *
+		 */
+		Vertex*
+			PointLocator::FindNearestVertex(
+				double u,
+				double v
+			)
+			const
+		{
+			Edge* e = Walk(u, v, GetPredicates());
+
+			auto distance = [u, v](const Vertex* w)
+			{
+				spPoint p = w->GetPoint();
+				double du = p->GetU() - u;
+				double dv = p->GetV() - v;
+				return du * du + dv * dv;
+			};
+
+			// Start from the nearest vertex of the triangle (or edge)
+			// where the walk stopped.
+			Vertex* best = e->GetOrigin();
+			double bestDistance = distance(best);
+
+			Vertex* candidates[2] = { e->GetDestination(), e->LeftNext()->GetDestination() };
+			size_t numberOfCandidates = e->GetFace()->IsBounded() ? 2 : 1;
+
+			for (size_t i = 0; i < numberOfCandidates; i++)
+			{
+				double d = distance(candidates[i]);
+
+				if (d < bestDistance)
+				{
+					best = candidates[i];
+					bestDistance = d;
+				}
+			}
+
+			// Move to a closer neighbour until there is none.
+			bool moved = true;
+
+			while (moved)
+			{
+				moved = false;
+
+				Edge* efirst = best->GetEdge();
+				Edge* eaux = efirst;
+
+				do
+				{
+					Vertex* w = eaux->GetDestination();
+					double d = distance(w);
+
+					if (d < bestDistance)
+					{
+						best = w;
+						bestDistance = d;
+						moved = true;
+					}
+
+					eaux = eaux->OriginNext();
+				} while (eaux != efirst);
+			}
+
+			return best;
+		}
+
+
+		/**
+		 * \fn void PointLocator::Locate(size_t numberOfPoints, const std::vector<spPoint>& points, std::vector<Location>& locations, size_t numberOfThreads) const
+		 *
+		 * \brief Finds the triangles containing a batch of points.
+		 *
+		 * \param numberOfPoints The number of points.
+		 * \param points An array with the point coordinates.
+		 * \param locations A reference to an array with the location
+		 * of each point.
+		 * \param numberOfThreads The number of threads (0 means one per
+		 * hardware thread).
+		 *
+		 */
+		void
+			PointLocator::Locate(
+				size_t numberOfPoints,
+				const std::vector<spPoint>& points,
+				std::vector<Location>& locations,
+				size_t numberOfThreads
+			)
+			const
+		{
+#ifdef DEBUGMODE
+			if (numberOfPoints > points.size())
+			{
+				throw std::runtime_error("The number of points informed is larger than the number of points in the array.");
+			}
+#endif
+
+			locations.resize(numberOfPoints);
+
+			ParallelFor(
+				0,
+				numberOfPoints,
+				numberOfThreads,
+				[&](size_t first, size_t last)
+				{
+					for (size_t i = first; i < last; i++)
+					{
+						Locate(points[i]->GetU(), points[i]->GetV(), locations[i]);
+					}
+				}
+			);
+
+			return;
+		}
+
+
+		/**
+		 * \fn void PointLocator::FindNearestVertices(size_t numberOfPoints, const std::vector<spPoint>& points, std::vector<Vertex*>& vertices, size_t numberOfThreads) const
+		 *
+		 * \brief Finds the vertices nearest to a batch of points.
+		 *
+		 * \param numberOfPoints The number of points.
+		 * \param points An array with the point coordinates.
+		 * \param vertices A reference to an array with the vertex
+		 * nearest to each point.
+		 * \param numberOfThreads The number of threads (0 means one per
+		 * hardware thread).
+		 *
+		 */
+		void
+			PointLocator::FindNearestVertices(
+				size_t numberOfPoints,
+				const std::vector<spPoint>& points,
+				std::vector<Vertex*>& vertices,
+				size_t numberOfThreads
+			)
+			const
+		{
+#ifdef DEBUGMODE
+			if (numberOfPoints > points.size())
+			{
+				throw std::runtime_error("The number of points informed is larger than the number of points in the array.");
+			}
+#endif
+
+			vertices.resize(numberOfPoints);
+
+			ParallelFor(
+				0,
+				numberOfPoints,
+				numberOfThreads,
+				[&](size_t first, size_t last)
+				{
+					for (size_t i = first; i < last; i++)
+					{
+						vertices[i] = FindNearestVertex(points[i]->GetU(), points[i]->GetV());
+					}
+				}
+			);
+
+			return;
+		}
+
+
+		/**
+		 * \fn Edge* PointLocator::Walk(double u, double v, Predicates<double>& preds) const
+		 *
+		 * \brief Walks from the starting edge of the cell of a point
+		 * towards the point.
+		 *
+		 * \param u First coordinate of the point.
+		 * \param v Second coordinate of the point.
+		 * \param preds The predicates of the calling thread.
+		 *
+		 * \return An edge such that the point is at one of its
+		 * vertices, or lies in its left face (or on its boundary).
+		 *
+		 */
+		Edge*
+			PointLocator::Walk(
+				double u,
+				double v,
+				Predicates<double>& preds
+			)
+			const
+		{
+			// Returns true if the point is on the right face of an edge.
+			auto rightOf = [&](const Edge* e)
+			{
+				spPoint po = e->GetOrigin()->GetPoint();
+				spPoint pd = e->GetDestination()->GetPoint();
+
+				return !preds.LeftOn(po->GetU(), po->GetV(), pd->GetU(), pd->GetV(), u, v);
+			};
+
+			Edge* e = GetSeed(u, v);
+
+			while (true)
+			{
+				spPoint po = e->GetOrigin()->GetPoint();
+				spPoint pd = e->GetDestination()->GetPoint();
+
+				if (
+					((po->GetU() == u) && (po->GetV() == v))
+					||
+					((pd->GetU() == u) && (pd->GetV() == v))
+				   )
+				{
+					// Report a vertex in a triangle whenever possible.
+					return e->GetFace()->IsBounded() ? e : e->Symmetric();
+				}
+				else if (rightOf(e))
+				{
+					e = e->Symmetric();
+				}
+				else if (!e->GetFace()->IsBounded())
+				{
+					// The point is outside the triangulation or on this
+					// boundary edge.
+					return e;
+				}
+				else if (!rightOf(e->OriginNext()))
+				{
+					e = e->OriginNext();
+				}
+				else if (!rightOf(e->DestinationPrev()))
+				{
+					e = e->DestinationPrev();
+				}
+				else
+				{
+					return e;
+				}
+			}
+		}
+
+
+		/**
+		 * \fn Edge* PointLocator::GetSeed(double u, double v) const
+		 *
+		 * \brief Returns the starting edge of the cell of a point.
+		 *
+		 * \param u First coordinate of the point.
+		 * \param v Second coordinate of the point.
+		 *
+		 * \return The starting edge of the cell of the point.
+		 *
+		 */
+		Edge*
+			PointLocator::GetSeed(
+				double u,
+				double v
+			)
+			const
+		{
+			double x = std::floor((u - _umin) / _cellWidth);
+			double y = std::floor((v - _vmin) / _cellHeight);
+
+			size_t i = (x <= 0) ? 0 : std::min(_numberOfCellsU - 1, size_t(x));
+			size_t j = (y <= 0) ? 0 : std::min(_numberOfCellsV - 1, size_t(y));
+
+			return _seeds[j * _numberOfCellsU + i];
+		}
+
+
+		/**
+		 * \fn Predicates<double>& PointLocator::GetPredicates()
+		 *
+		 * \brief Returns the predicates of the calling thread.
+		 *
+		 * \return The predicates of the calling thread.
+		 *
+		 */
+		Predicates<double>&
+			PointLocator::GetPredicates()
+		{
+			static thread_local Predicates<double> preds;
+			return preds;
+		}
+
+	}
+
+}
+
+/** @} */ //end of group class.
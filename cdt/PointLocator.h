@@ -0,0 +1,325 @@
+/**
+ * \file PointLocator.h
+ *
+ * \brief Definition of class PointLocator, which answers point location
+ * and nearest vertex queries on a finished CDT.
+ *
+ * \author
+ * Marcelo Ferreira Siqueira \n
+ * Universidade Federal do Rio Grande do Norte, \n
+ * Departamento de Matem&aacute;tica, \n
+ * mfsiqueira at mat (dot) ufrn (dot) br
+ *
+ * \version 1.0
+ * \date October 2026
+ *
+ * \attention This program is distributed WITHOUT ANY WARRANTY, and it
+ *            may be freely redistributed under the condition that the
+ *            copyright notices  are not removed,  and no compensation
+ *            is received. Private, research, and institutional use is
+ *            free. Distribution of this  code as part of a commercial
+ *            system  is permissible ONLY  BY DIRECT  ARRANGEMENT WITH
+ *            THE AUTHOR.
+ */
+
+#pragma once
+
+#include "Cdt.h"              // CDT
+#include "Face.h"             // Face
+#include "Edge.h"             // Edge
+#include "Vertex.h"           // Vertex
+#include "Predicates.h"       // Predicates<double>
+
+#include <cstddef>            // size_t
+#include <vector>             // std::vector
+
+
+/**
+ * \defgroup MAT309NameSpace Namespace MAT309.
+ * @{
+ */
+
+/**
+ * \namespace MAT309
+ *
+ * \brief Global namespace for MAT309 software.
+ */
+namespace MAT309
+{
+
+	/**
+	 * \defgroup CDTNameSpace Namespace cdt.
+	 * @{
+	 */
+
+	 /**
+	  * \namespace cdt
+	  *
+	  * \brief   The  namespace   cdt  contains   the  definition   and
+	  * implementation of classes to build and manipulate a constrained
+	  * Delaunay  triangulation  (CDT)  using an  augmentation  of  the
+	  * quad-edge data structure.
+	  */
+
+	namespace cdt {
+
+		/**
+		 * \class PointLocator
+		 *
+		 * \brief This class answers "which triangle contains a point"
+		 * and "which vertex is nearest to a point" queries on a finished
+		 * CDT.  A coarse uniform grid over the bounding box of the
+		 * vertices holds, for each cell, an edge leaving the vertex
+		 * nearest to the cell center.  A query walks from the edge of
+		 * its cell, so walks are short however large the CDT is.
+		 *
+		 * Queries only read the CDT, and each thread uses its own
+		 * predicates, so any number of threads may query the same
+		 * locator at once.  The CDT must not change while a locator of
+		 * it is in use.
+		 *
+		 */
+		class PointLocator
+		{
+		public:
+
+			// -------------------------------------------------------
+			//
+			// Type definitions
+			//
+			// -------------------------------------------------------
+
+			/**
+			 * \typedef spPoint
+			 *
+			 * \brief Alias for a shared pointer to vertex point attributes.
+			 *
+			 */
+			typedef Vertex::spPoint spPoint;
+
+
+			/**
+			 * \struct Location
+			 *
+			 * \brief This struct holds the triangle containing a point
+			 * and the barycentric coordinates of the point in it.
+			 *
+			 */
+			struct Location
+			{
+				Face* _face;             ///< The triangle containing the point (null if the point is outside the CDT).
+				Vertex* _vertices[3];    ///< The vertices of the triangle, in CCW order.
+				double _weights[3];      ///< The barycentric coordinates of the point w.r.t. the vertices.
+			};
+
+
+		private:
+
+			// -------------------------------------------------------
+			//
+			// Private data members
+			//
+			// -------------------------------------------------------
+
+			double _umin;                ///< Lower bound of the first coordinate of the grid.
+			double _vmin;                ///< Lower bound of the second coordinate of the grid.
+			double _cellWidth;           ///< Width of a grid cell.
+			double _cellHeight;          ///< Height of a grid cell.
+			size_t _numberOfCellsU;      ///< Number of grid cells along the first coordinate.
+			size_t _numberOfCellsV;      ///< Number of grid cells along the second coordinate.
+			std::vector<Edge*> _seeds;   ///< The starting edge of the walks of each cell, row by row.
+
+
+		public:
+
+			// -------------------------------------------------------
+			//
+			// Public methods
+			//
+			// -------------------------------------------------------
+
+			/**
+			 * \fn PointLocator(const CDT& cdt, double verticesPerCell = 4)
+			 *
+			 * \brief Creates the grid of starting edges of a CDT.
+			 *
+			 * \param cdt A finished CDT.
+			 * \param verticesPerCell Average number of vertices of the
+			 * CDT per grid cell.
+			 *
+			 */
+			PointLocator(
+				const CDT& cdt,
+				double verticesPerCell = 4
+			);
+
+
+			/**
+			 * \fn bool Locate(double u, double v, Location& location) const
+			 *
+			 * \brief Finds the triangle containing a point.  A point on
+			 * an edge or at a vertex is reported in one of the
+			 * triangles sharing it.
+			 *
+			 * \param u First coordinate of the point.
+			 * \param v Second coordinate of the point.
+			 * \param location A reference to the triangle containing
+			 * the point and the barycentric coordinates of the point.
+			 *
+			 * \return The logic value true if the point lies in the
+			 * CDT, and the logic value false otherwise (in which case
+			 * the face of the location is null).
+			 *
+			 */
+			bool
+				Locate(
+					double u,
+					double v,
+					Location& location
+				)
+				const;
+
+
+			/**
+			 * \fn Vertex* FindNearestVertex(double u, double v) const
+			 *
+			 * \brief Finds the vertex nearest to a point,  which may lie
+			 * outside the CDT.  The search walks from the triangle of
+			 * the point to ever closer neighbouring vertices, which
+			 * ends at the nearest vertex in a Delaunay triangulation
+			 * (constrained edges may stop it at a local minimum).
+			 *
+			 * \param u First coordinate of the point.
+			 * \param v Second coordinate of the point.
+			 *
+			 * \return A pointer to the nearest vertex.
+			 *
+			 */
+			Vertex*
+				FindNearestVertex(
+					double u,
+					double v
+				)
+				const;
+
+
+			/**
+			 * \fn void Locate(size_t numberOfPoints, const std::vector<spPoint>& points, std::vector<Location>& locations, size_t numberOfThreads = 0) const
+			 *
+			 * \brief Finds the triangles containing a batch of points,
+			 * splitting the batch among several threads.
+			 *
+			 * \param numberOfPoints The number of points.
+			 * \param points An array with the point coordinates.
+			 * \param locations A reference to an array with the
+			 * location of each point.
+			 * \param numberOfThreads The number of threads (0 means one
+			 * per hardware thread).
+			 *
+			 */
+			void
+				Locate(
+					size_t numberOfPoints,
+					const std::vector<spPoint>& points,
+					std::vector<Location>& locations,
+					size_t numberOfThreads = 0
+				)
+				const;
+
+
+			/**
+			 * \fn void FindNearestVertices(size_t numberOfPoints, const std::vector<spPoint>& points, std::vector<Vertex*>& vertices, size_t numberOfThreads = 0) const
+			 *
+			 * \brief Finds the vertices nearest to a batch of points,
+			 * splitting the batch among several threads.
+			 *
+			 * \param numberOfPoints The number of points.
+			 * \param points An array with the point coordinates.
+			 * \param vertices A reference to an array with the vertex
+			 * nearest to each point.
+			 * \param numberOfThreads The number of threads (0 means one
+			 * per hardware thread).
+			 *
+			 */
+			void
+				FindNearestVertices(
+					size_t numberOfPoints,
+					const std::vector<spPoint>& points,
+					std::vector<Vertex*>& vertices,
+					size_t numberOfThreads = 0
+				)
+				const;
+
+
+		private:
+
+			// -------------------------------------------------------
+			//
+			// Private methods
+			//
+			// -------------------------------------------------------
+
+			/**
+			 * \fn Edge* Walk(double u, double v, Predicates<double>& preds) const
+			 *
+			 * \brief Walks from the starting edge of the cell of a point
+			 * towards the point, as CDT::Locate() does.
+			 *
+			 * \param u First coordinate of the point.
+			 * \param v Second coordinate of the point.
+			 * \param preds The predicates of the calling thread.
+			 *
+			 * \return An edge such that the point is at one of its
+			 * vertices, or lies in its left face (or on the boundary of
+			 * that face).  If the left face is the unbounded face, the
+			 * point lies outside the CDT or on the edge.
+			 *
+			 */
+			Edge*
+				Walk(
+					double u,
+					double v,
+					Predicates<double>& preds
+				)
+				const;
+
+
+			/**
+			 * \fn Edge* GetSeed(double u, double v) const
+			 *
+			 * \brief Returns the starting edge of the cell of a point.
+			 * Points outside the grid use the nearest cell.
+			 *
+			 * \param u First coordinate of the point.
+			 * \param v Second coordinate of the point.
+			 *
+			 * \return The starting edge of the cell of the point.
+			 *
+			 */
+			Edge*
+				GetSeed(
+					double u,
+					double v
+				)
+				const;
+
+
+			/**
+			 * \fn static Predicates<double>& GetPredicates()
+			 *
+			 * \brief Returns the predicates of the calling thread, as
+			 * the predicates keep temporaries in data members.
+			 *
+			 * \return The predicates of the calling thread.
+			 *
+			 */
+			static
+			Predicates<double>&
+				GetPredicates();
+		};
+
+	}
+
+}
+
+/** @} */ //end of group class.
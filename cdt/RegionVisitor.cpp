@@ -558,7 +558,7 @@ namespace MAT309
 							std::pair<TRIANGLESET::iterator, bool> ret = reachedTriangles.insert(nextFace);
 							if (!ret.second)
 							{
-								std::pair<TRIANGLESET::iterator, bool> ret = reachedTriangles.insert(nextFace);
+								throw std::runtime_error("Attempt to visit the same face for the second time");
 							}
 #else
 							reachedTriangles.insert(nextFace);
@@ -0,0 +1,462 @@
+/**
+ * \file VoronoiExtractor.cpp
+ *
+ * \brief Implementation of class VoronoiExtractor, which computes the
+ * Voronoi cells of the vertices of a CDT from its dual.
+ *
+ * \author
+ * Marcelo Ferreira Siqueira \n
+ * Universidade Federal do Rio Grande do Norte, \n
+ * Departamento de Matem&aacute;tica, \n
+ * mfsiqueira at mat (dot) ufrn (dot) br
+ *
+ * \version 1.0
+ * \date October 2026
+ *
+ * \attention This program is distributed WITHOUT ANY WARRANTY, and it
+ *            may be freely redistributed under the condition that the
+ *            copyright notices  are not removed,  and no compensation
+ *            is received. Private, research, and institutional use is
+ *            free. Distribution of this  code as part of a commercial
+ *            system  is permissible ONLY  BY DIRECT  ARRANGEMENT WITH
+ *            THE AUTHOR.
+ */
+
+#include "VoronoiExtractor.h"    // VoronoiExtractor
+#include "../common/Parallel.h"  // ParallelFor, DefaultNumberOfThreads
+
+#include <algorithm>             // std::min, std::max
+#include <limits>                // std::numeric_limits
+#include <unordered_map>         // std::unordered_map
+#include <stdexcept>             // std::runtime_error
+
+
+/**
+ * \defgroup MAT309NameSpace Namespace MAT309.
+ * @{
+ */
+
+/**
+ * \namespace MAT309
+ *
+ * \brief Global namespace for MAT309 software.
+ */
+
+namespace MAT309
+{
+
+	/**
+	 * \defgroup CDTNameSpace Namespace cdt.
+	 * @{
+	 */
+
+	 /**
+	  * \namespace cdt
+	  *
+	  * \brief   The  namespace   cdt  contains   the  definition   and
+	  * implementation of classes to build and manipulate a constrained
+	  * Delaunay  triangulation  (CDT)  using an  augmentation  of  the
+	  * quad-edge data structure.
+	  */
+
+	namespace cdt {
+
+		/**
+		 * \fn VoronoiExtractor::VoronoiExtractor(double umin, double umax, double vmin, double vmax)
+		 *
+		 * \brief Creates an instance of this class that clips the cells
+		 * to the domain [umin,umax] x [vmin,vmax].
+		 *
+		 * \param umin Lower bound for the first coordinate.
+		 * \param umax Upper bound for the first coordinate.
+		 * \param vmin Lower bound for the second coordinate.
+		 * \param vmax Upper bound for the second coordinate.
+		 *
+		 */
+		VoronoiExtractor::VoronoiExtractor(
+			double umin,
+			double umax,
+			double vmin,
+			double vmax
+		)
+			:
+			_hasDomain(true),
+			_umin(umin),
+			_umax(umax),
+			_vmin(vmin),
+			_vmax(vmax)
+		{
+			if ((umin >= umax) || (vmin >= vmax))
+			{
+				throw std::runtime_error("The domain of the Voronoi cells must have a positive area.");
+			}
+		}
+
+
+		/**
+		 * \fn void VoronoiExtractor::Extract(const CDT& cdt, size_t& numberOfCells, PointList& sites, std::vector<size_t>& offsets, std::vector<double>& corners, std::vector<double>& centroids, std::vector<double>& areas, size_t numberOfThreads) const
+		 *
+		 * \brief Computes the Voronoi cells of all vertices of a CDT.
+		 *
+		 * \param cdt A finished CDT.
+		 * \param numberOfCells Total number of cells.
+		 * \param sites A reference to an array with the point of the
+		 * vertex of each cell.
+		 * \param offsets A reference to an array with the position of
+		 * the first corner of each cell in the array of corners,
+		 * followed by the total number of corners.
+		 * \param corners A reference to an array with the coordinates
+		 * of the corners of the cells.
+		 * \param centroids A reference to an array with the
+		 * coordinates of the centroid of each cell.
+		 * \param areas A reference to an array with the area of each
+		 * cell.
+		 * \param numberOfThreads The number of threads (0 means one per
+		 * hardware thread).
+		 *
+		 */
+		void
+			VoronoiExtractor::Extract(
+				const CDT& cdt,
+				size_t& numberOfCells,
+				PointList& sites,
+				std::vector<size_t>& offsets,
+				std::vector<double>& corners,
+				std::vector<double>& centroids,
+				std::vector<double>& areas,
+				size_t numberOfThreads
+			)
+			const
+		{
+			if (!cdt.IsFinished())
+			{
+				throw std::runtime_error("Voronoi cells can only be extracted from a finished triangulation.");
+			}
+
+			// Number the vertices and the bounded faces of the CDT.
+			std::vector<Vertex*> vertices;
+			vertices.reserve(cdt.GetNumberOfVertices());
+
+			for (CDT::VertexIterator vit = cdt.VertsBegin(); vit != cdt.VertsEnd(); ++vit)
+			{
+				vertices.push_back(*vit);
+			}
+
+			std::vector<Face*> faces;
+			faces.reserve(cdt.GetNumberOfFaces());
+
+			std::unordered_map<const Face*, size_t> faceIndex(2 * cdt.GetNumberOfFaces());
+
+			for (CDT::FaceIterator fit = cdt.FacesBegin(); fit != cdt.FacesEnd(); ++fit)
+			{
+				if ((*fit)->IsBounded())
+				{
+					faceIndex[*fit] = faces.size();
+					faces.push_back(*fit);
+				}
+			}
+
+			// Unless given, the domain is the bounding box of the
+			// vertices.
+			double umin = _umin;
+			double umax = _umax;
+			double vmin = _vmin;
+			double vmax = _vmax;
+
+			if (!_hasDomain)
+			{
+				umin = vmin = std::numeric_limits<double>::max();
+				umax = vmax = -std::numeric_limits<double>::max();
+
+				for (Vertex* v : vertices)
+				{
+					spPoint p = v->GetPoint();
+
+					umin = std::min(umin, p->GetU());
+					umax = std::max(umax, p->GetU());
+					vmin = std::min(vmin, p->GetV());
+					vmax = std::max(vmax, p->GetV());
+				}
+			}
+
+			// Compute the circumcenter of each triangle once, and
+			// whether it lies in the domain.
+			std::vector<double> centers(2 * faces.size());
+			std::vector<char> inside(faces.size());
+
+			ParallelFor(
+				0,
+				faces.size(),
+				numberOfThreads,
+				[&](size_t first, size_t last)
+				{
+					for (size_t k = first; k < last; k++)
+					{
+						Edge* e = faces[k]->GetEdge();
+
+						spPoint pa = e->GetOrigin()->GetPoint();
+						spPoint pb = e->GetDestination()->GetPoint();
+						spPoint pc = e->LeftNext()->GetDestination()->GetPoint();
+
+						// Coordinates relative to the first corner, for
+						// accuracy.
+						double bu = pb->GetU() - pa->GetU();
+						double bv = pb->GetV() - pa->GetV();
+						double cu = pc->GetU() - pa->GetU();
+						double cv = pc->GetV() - pa->GetV();
+
+						double b2 = bu * bu + bv * bv;
+						double c2 = cu * cu + cv * cv;
+						double d = 2 * (bu * cv - bv * cu);
+
+						double u = pa->GetU() + (cv * b2 - bv * c2) / d;
+						double v = pa->GetV() + (bu * c2 - cu * b2) / d;
+
+						centers[2 * k] = u;
+						centers[2 * k + 1] = v;
+
+						inside[k] = (u >= umin) && (u <= umax) && (v >= vmin) && (v <= vmax);
+					}
+				}
+			);
+
+			// Compute the cells in contiguous blocks of vertices,  one
+			// block per thread,  and gather the corners of the blocks
+			// afterwards.
+			numberOfCells = vertices.size();
+
+			sites.resize(numberOfCells);
+			offsets.resize(numberOfCells + 1);
+			centroids.resize(2 * numberOfCells);
+			areas.resize(numberOfCells);
+
+			if (numberOfThreads == 0)
+			{
+				numberOfThreads = DefaultNumberOfThreads();
+			}
+
+			size_t numberOfBlocks = std::max(size_t(1), std::min(numberOfThreads, numberOfCells));
+			std::vector< std::vector<double> > blockCorners(numberOfBlocks);
+
+			auto blockBegin = [&](size_t b) { return (b * numberOfCells) / numberOfBlocks; };
+
+			ParallelFor(
+				0,
+				numberOfBlocks,
+				numberOfBlocks,
+				[&](size_t firstBlock, size_t lastBlock)
+				{
+					std::vector<double> polygon;
+					std::vector<double> buffer;
+
+					for (size_t b = firstBlock; b < lastBlock; b++)
+					{
+						for (size_t i = blockBegin(b); i < blockBegin(b + 1); i++)
+						{
+							Vertex* vertex = vertices[i];
+							spPoint p = vertex->GetPoint();
+
+							sites[i] = p;
+
+							// Gather the circumcenters of the triangles
+							// around the vertex, in CCW order.
+							polygon.clear();
+
+							bool onHull = false;
+							bool needsClipping = false;
+
+							Edge* efirst = vertex->GetEdge();
+							Edge* e = efirst;
+
+							do
+							{
+								Face* f = e->GetFace();
+
+								if (!f->IsBounded())
+								{
+									onHull = true;
+									break;
+								}
+
+								size_t k = faceIndex.find(f)->second;
+
+								polygon.push_back(centers[2 * k]);
+								polygon.push_back(centers[2 * k + 1]);
+
+								needsClipping = needsClipping || !inside[k];
+
+								e = e->OriginNext();
+							} while (e != efirst);
+
+							if (onHull)
+							{
+								// The cell is unbounded: cut the domain
+								// with the bisector of the vertex and
+								// each neighbour.
+								polygon.assign({ umin, vmin, umax, vmin, umax, vmax, umin, vmax });
+
+								e = efirst;
+
+								do
+								{
+									spPoint q = e->GetDestination()->GetPoint();
+
+									double a = q->GetU() - p->GetU();
+									double c = q->GetV() - p->GetV();
+
+									ClipToHalfPlane(
+										polygon,
+										a,
+										c,
+										a * (q->GetU() + p->GetU()) / 2 + c * (q->GetV() + p->GetV()) / 2,
+										buffer
+									);
+
+									e = e->OriginNext();
+								} while ((e != efirst) && !polygon.empty());
+							}
+							else if (needsClipping)
+							{
+								ClipToHalfPlane(polygon,  1,  0,  umax, buffer);
+								ClipToHalfPlane(polygon, -1,  0, -umin, buffer);
+								ClipToHalfPlane(polygon,  0,  1,  vmax, buffer);
+								ClipToHalfPlane(polygon,  0, -1, -vmin, buffer);
+							}
+
+							// Area and centroid of the cell, with
+							// coordinates relative to the site.
+							size_t n = polygon.size() / 2;
+
+							double area = 0;
+							double cu = 0;
+							double cv = 0;
+
+							for (size_t j = 0; j < n; j++)
+							{
+								size_t l = (j + 1) % n;
+
+								double u0 = polygon[2 * j] - p->GetU();
+								double v0 = polygon[2 * j + 1] - p->GetV();
+								double u1 = polygon[2 * l] - p->GetU();
+								double v1 = polygon[2 * l + 1] - p->GetV();
+
+								double cross = u0 * v1 - u1 * v0;
+
+								area += cross;
+								cu += (u0 + u1) * cross;
+								cv += (v0 + v1) * cross;
+							}
+
+							area /= 2;
+
+							areas[i] = area;
+
+							if (area > 0)
+							{
+								centroids[2 * i] = p->GetU() + cu / (6 * area);
+								centroids[2 * i + 1] = p->GetV() + cv / (6 * area);
+							}
+							else
+							{
+								centroids[2 * i] = p->GetU();
+								centroids[2 * i + 1] = p->GetV();
+							}
+
+							offsets[i] = n;
+
+							blockCorners[b].insert(blockCorners[b].end(), polygon.begin(), polygon.end());
+						}
+					}
+				}
+			);
+
+			// Turn the number of corners of each cell into offsets, and
+			// gather the corners.
+			size_t total = 0;
+
+			for (size_t i = 0; i < numberOfCells; i++)
+			{
+				size_t n = offsets[i];
+				offsets[i] = total;
+				total += n;
+			}
+
+			offsets[numberOfCells] = total;
+
+			corners.clear();
+			corners.reserve(2 * total);
+
+			for (size_t b = 0; b < numberOfBlocks; b++)
+			{
+				corners.insert(corners.end(), blockCorners[b].begin(), blockCorners[b].end());
+			}
+
+			return;
+		}
+
+
+		/**
+		 * \fn void VoronoiExtractor::ClipToHalfPlane(std::vector<double>& polygon, double a, double b, double c, std::vector<double>& buffer)
+		 *
+		 * \brief Clips a polygon to the half-plane a u + b v <= c.
+		 *
+		 * \param polygon A reference to the coordinates of the corners
+		 * of the polygon, replaced by those of the clipped polygon.
+		 * \param a Coefficient of the first coordinate.
+		 * \param b Coefficient of the second coordinate.
+		 * \param c Right-hand side of the inequality.
+		 * \param buffer A reference to a scratch array.
+		 *
+		 */
+		void
+			VoronoiExtractor::ClipToHalfPlane(
+				std::vector<double>& polygon,
+				double a,
+				double b,
+				double c,
+				std::vector<double>& buffer
+			)
+		{
+			size_t n = polygon.size() / 2;
+
+			buffer.clear();
+
+			for (size_t j = 0; j < n; j++)
+			{
+				size_t l = (j + 1) % n;
+
+				double u0 = polygon[2 * j];
+				double v0 = polygon[2 * j + 1];
+				double u1 = polygon[2 * l];
+				double v1 = polygon[2 * l + 1];
+
+				double d0 = a * u0 + b * v0 - c;
+				double d1 = a * u1 + b * v1 - c;
+
+				// Keep the corners inside the half-plane, and add the
+				// crossings of the boundary line.
+				if (d0 <= 0)
+				{
+					buffer.push_back(u0);
+					buffer.push_back(v0);
+				}
+
+				if (((d0 < 0) && (d1 > 0)) || ((d0 > 0) && (d1 < 0)))
+				{
+					double t = d0 / (d0 - d1);
+
+					buffer.push_back(u0 + t * (u1 - u0));
+					buffer.push_back(v0 + t * (v1 - v0));
+				}
+			}
+
+			polygon.swap(buffer);
+
+			return;
+		}
+
+	}
+
+}
+
+/** @} */ //end of group class.
@@ -0,0 +1,240 @@
+/**
+ * \file VoronoiExtractor.h
+ *
+ * \brief Definition of class VoronoiExtractor, which computes the
+ * Voronoi cells of the vertices of a CDT from its dual.
+ *
+ * \author
+ * Marcelo Ferreira Siqueira \n
+ * Universidade Federal do Rio Grande do Norte, \n
+ * Departamento de Matem&aacute;tica, \n
+ * mfsiqueira at mat (dot) ufrn (dot) br
+ *
+ * \version 1.0
+ * \date October 2026
+ *
+ * \attention This program is distributed WITHOUT ANY WARRANTY, and it
+ *            may be freely redistributed under the condition that the
+ *            copyright notices  are not removed,  and no compensation
+ *            is received. Private, research, and institutional use is
+ *            free. Distribution of this  code as part of a commercial
+ *            system  is permissible ONLY  BY DIRECT  ARRANGEMENT WITH
+ *            THE AUTHOR.
+ */
+
+#pragma once
+
+#include "Cdt.h"              // CDT
+#include "Face.h"             // Face
+#include "Edge.h"             // Edge
+#include "Vertex.h"           // Vertex
+
+#include <cstddef>            // size_t
+#include <vector>             // std::vector
+
+
+/**
+ * \defgroup MAT309NameSpace Namespace MAT309.
+ * @{
+ */
+
+/**
+ * \namespace MAT309
+ *
+ * \brief Global namespace for MAT309 software.
+ */
+namespace MAT309
+{
+
+	/**
+	 * \defgroup CDTNameSpace Namespace cdt.
+	 * @{
+	 */
+
+	 /**
+	  * \namespace cdt
+	  *
+	  * \brief   The  namespace   cdt  contains   the  definition   and
+	  * implementation of classes to build and manipulate a constrained
+	  * Delaunay  triangulation  (CDT)  using an  augmentation  of  the
+	  * quad-edge data structure.
+	  */
+
+	namespace cdt {
+
+		/**
+		 * \class VoronoiExtractor
+		 *
+		 * \brief This class computes the Voronoi cell of each vertex of
+		 * a finished CDT, clipped to a rectangular domain.
+		 *
+		 * The circumcenter of each triangle is computed once.  The cell
+		 * of an interior vertex is the polygon of the circumcenters of
+		 * the triangles around it, clipped to the domain if any of them
+		 * falls outside.  The cell of a vertex of the convex hull is
+		 * unbounded,  so it is computed instead by cutting the domain
+		 * with the bisectors of the vertex and its neighbours.  The
+		 * cells are exact for a Delaunay triangulation; near constrained
+		 * edges, or under a metric other than the Euclidean one, they
+		 * are the dual polygons of the triangulation.
+		 *
+		 */
+		class VoronoiExtractor
+		{
+		public:
+
+			// -------------------------------------------------------
+			//
+			// Type definitions
+			//
+			// -------------------------------------------------------
+
+			/**
+			 * \typedef spPoint
+			 *
+			 * \brief Alias for a shared pointer to vertex point attributes.
+			 *
+			 */
+			typedef Vertex::spPoint spPoint;
+
+
+			/**
+			 * \typedef PointList
+			 *
+			 * \brief Alias for an array of vertex point attributes.
+			 *
+			 */
+			typedef std::vector<spPoint> PointList;
+
+
+		private:
+
+			// -------------------------------------------------------
+			//
+			// Private data members
+			//
+			// -------------------------------------------------------
+
+			bool _hasDomain;      ///< A flag to indicate whether the domain was given (otherwise, it is the bounding box of the vertices).
+			double _umin;         ///< Lower bound for the first coordinate of the domain.
+			double _umax;         ///< Upper bound for the first coordinate of the domain.
+			double _vmin;         ///< Lower bound for the second coordinate of the domain.
+			double _vmax;         ///< Upper bound for the second coordinate of the domain.
+
+
+		public:
+
+			// -------------------------------------------------------
+			//
+			// Public methods
+			//
+			// -------------------------------------------------------
+
+			/**
+			 * \fn VoronoiExtractor()
+			 *
+			 * \brief Creates an instance of this class that clips the
+			 * cells to the bounding box of the vertices of the CDT.
+			 *
+			 */
+			VoronoiExtractor()
+				:
+				_hasDomain(false),
+				_umin(0),
+				_umax(0),
+				_vmin(0),
+				_vmax(0)
+			{
+			}
+
+
+			/**
+			 * \fn VoronoiExtractor(double umin, double umax, double vmin, double vmax)
+			 *
+			 * \brief Creates an instance of this class that clips the
+			 * cells to the domain [umin,umax] x [vmin,vmax].
+			 *
+			 * \param umin Lower bound for the first coordinate.
+			 * \param umax Upper bound for the first coordinate.
+			 * \param vmin Lower bound for the second coordinate.
+			 * \param vmax Upper bound for the second coordinate.
+			 *
+			 */
+			VoronoiExtractor(
+				double umin,
+				double umax,
+				double vmin,
+				double vmax
+			);
+
+
+			/**
+			 * \fn void Extract(const CDT& cdt, size_t& numberOfCells, PointList& sites, std::vector<size_t>& offsets, std::vector<double>& corners, std::vector<double>& centroids, std::vector<double>& areas, size_t numberOfThreads = 0) const
+			 *
+			 * \brief Computes the Voronoi cells of all vertices of a
+			 * CDT.
+			 *
+			 * \param cdt A finished CDT.
+			 * \param numberOfCells Total number of cells (one per
+			 * vertex of the CDT).
+			 * \param sites A reference to an array with the point of
+			 * the vertex of each cell.
+			 * \param offsets A reference to an array with the position
+			 * of the first corner of each cell in the array of corners,
+			 * followed by the total number of corners.
+			 * \param corners A reference to an array with the two
+			 * coordinates of each corner of each cell, in CCW order.
+			 * \param centroids A reference to an array with the two
+			 * coordinates of the centroid of each cell (the site, if
+			 * the cell is empty).
+			 * \param areas A reference to an array with the area of
+			 * each cell.
+			 * \param numberOfThreads The number of threads (0 means one
+			 * per hardware thread).
+			 *
+			 */
+			void
+				Extract(
+					const CDT& cdt,
+					size_t& numberOfCells,
+					PointList& sites,
+					std::vector<size_t>& offsets,
+					std::vector<double>& corners,
+					std::vector<double>& centroids,
+					std::vector<double>& areas,
+					size_t numberOfThreads = 0
+				)
+				const;
+
+
+			/**
+			 * \fn static void ClipToHalfPlane(std::vector<double>& polygon, double a, double b, double c, std::vector<double>& buffer)
+			 *
+			 * \brief Clips a convex polygon to the half-plane a u + b v
+			 * <= c.
+			 *
+			 * \param polygon A reference to the coordinates of the
+			 * corners of the polygon, replaced by those of the clipped
+			 * polygon.
+			 * \param a Coefficient of the first coordinate.
+			 * \param b Coefficient of the second coordinate.
+			 * \param c Right-hand side of the inequality.
+			 * \param buffer A reference to a scratch array.
+			 *
+			 */
+			static
+			void
+				ClipToHalfPlane(
+					std::vector<double>& polygon,
+					double a,
+					double b,
+					double c,
+					std::vector<double>& buffer
+				);
+		};
+
+	}
+
+}
+
+/** @} */ //end of group class.
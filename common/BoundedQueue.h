@@ -0,0 +1,210 @@
+/**
+ * \file BoundedQueue.h
+ *
+ * \brief Definition  and implementation of the class  BoundedQueue, a
+ * blocking queue  of bounded capacity that hands items  from producer
+ * threads to consumer threads.
+ *
+ * \author
+ * Marcelo Ferreira Siqueira \n
+ * Universidade Federal do Rio Grande do Norte, \n
+ * Departamento de Matem&aacute;tica, \n
+ * mfsiqueira at mat (dot) ufrn (dot) br
+ *
+ * \version 1.0
+ * \date October 2026
+ *
+ * \attention This program is distributed WITHOUT ANY WARRANTY, and it
+ *            may be freely redistributed under the condition that the
+ *            copyright notices  are not removed,  and no compensation
+ *            is received. Private, research, and institutional use is
+ *            free. Distribution of this  code as part of a commercial
+ *            system  is permissible ONLY  BY DIRECT  ARRANGEMENT WITH
+ *            THE AUTHOR.
+ */
+
+#pragma once
+
+#include <cstddef>              // size_t
+#include <deque>                // std::deque
+#include <mutex>                // std::mutex
+#include <utility>              // std::move
+#include <condition_variable>   // std::condition_variable
+
+
+/**
+ * \defgroup MAT309NameSpace Namespace MAT309.
+ * @{
+ */
+
+/**
+ * \namespace MAT309
+ *
+ * \brief Global namespace for MAT309 software.
+ */
+
+namespace MAT309
+{
+
+	/**
+	 * \class BoundedQueue
+	 *
+	 * \brief This class is a  first-in first-out queue holding at most
+	 * a given number of items.  Push() blocks while the queue is full,
+	 * and Pop() blocks while it is empty,  so a fast producer cannot
+	 * run arbitrarily far ahead of its consumer.  Once the producer
+	 * closes the queue, the consumer drains the remaining items.
+	 *
+	 * \tparam T The type of the items.
+	 *
+	 */
+	template <typename T>
+	class BoundedQueue
+	{
+	private:
+
+		// -----------------------------------------------------------
+		//
+		// Private data members
+		//
+		// -----------------------------------------------------------
+
+		std::deque<T> _items;              ///< The items in the queue.
+		size_t _capacity;                  ///< Maximum number of items in the queue.
+		bool _closed;                      ///< A flag to indicate whether no more items will be pushed.
+		std::mutex _mutex;                 ///< A mutex protecting the queue.
+		std::condition_variable _notFull;  ///< Signals that an item was popped or the queue was closed.
+		std::condition_variable _notEmpty; ///< Signals that an item was pushed or the queue was closed.
+
+
+	public:
+
+		// -----------------------------------------------------------
+		//
+		// Public methods
+		//
+		// -----------------------------------------------------------
+
+		/**
+		 * \fn BoundedQueue(size_t capacity)
+		 *
+		 * \brief Creates an empty queue.
+		 *
+		 * \param capacity Maximum number of items in the queue (at
+		 * least 1).
+		 *
+		 */
+		BoundedQueue(size_t capacity)
+			:
+			_capacity((capacity > 0) ? capacity : 1),
+			_closed(false)
+		{
+		}
+
+
+		/**
+		 * \fn bool Push(T&& item)
+		 *
+		 * \brief Appends an item to the queue, waiting for room if the
+		 * queue is full.
+		 *
+		 * \param item The item.
+		 *
+		 * \return The logic value false if the queue was closed (the
+		 * item is then dropped), and true otherwise.
+		 *
+		 */
+		bool Push(T&& item)
+		{
+			{
+				std::unique_lock<std::mutex> lock(_mutex);
+				_notFull.wait(lock, [this] { return (_items.size() < _capacity) || _closed; });
+
+				if (_closed)
+				{
+					return false;
+				}
+
+				_items.push_back(std::move(item));
+			}
+
+			_notEmpty.notify_one();
+
+			return true;
+		}
+
+
+		/**
+		 * \fn bool Pop(T& item)
+		 *
+		 * \brief Removes the first item of the queue, waiting for one if
+		 * the queue is empty.
+		 *
+		 * \param item A reference to the item removed.
+		 *
+		 * \return The logic value false if the queue is closed and
+		 * empty, and true otherwise.
+		 *
+		 */
+		bool Pop(T& item)
+		{
+			{
+				std::unique_lock<std::mutex> lock(_mutex);
+				_notEmpty.wait(lock, [this] { return !_items.empty() || _closed; });
+
+				if (_items.empty())
+				{
+					return false;
+				}
+
+				item = std::move(_items.front());
+				_items.pop_front();
+			}
+
+			_notFull.notify_one();
+
+			return true;
+		}
+
+
+		/**
+		 * \fn void Close()
+		 *
+		 * \brief Marks the end of the items.  Blocked producers give up
+		 * and consumers drain what is left.
+		 *
+		 */
+		void Close()
+		{
+			{
+				std::lock_guard<std::mutex> lock(_mutex);
+				_closed = true;
+			}
+
+			_notFull.notify_all();
+			_notEmpty.notify_all();
+		}
+
+
+	private:
+
+		// -----------------------------------------------------------
+		//
+		// Private methods
+		//
+		// -----------------------------------------------------------
+
+		/**
+		 * \fn BoundedQueue(const BoundedQueue& q)
+		 *
+		 * \brief Copying a queue is not allowed.
+		 *
+		 * \param q An instance of this class.
+		 *
+		 */
+		BoundedQueue(const BoundedQueue& q) = delete;
+	};
+
+}
+
+/** @} */ //end of group class.
@@ -0,0 +1,414 @@
+/**
+ * \file KdTree.h
+ *
+ * \brief Definition and implementation of a kd-tree answering fixed
+ * radius neighbour queries on points in K-dimensional space.
+ *
+ * \author
+ * Marcelo Ferreira Siqueira \n
+ * Universidade Federal do Rio Grande do Norte, \n
+ * Departamento de Matem&aacute;tica, \n
+ * mfsiqueira at mat (dot) ufrn (dot) br
+ *
+ * \version 1.0
+ * \date October 2026
+ *
+ * \attention This program is distributed WITHOUT ANY WARRANTY, and it
+ *            may be freely redistributed under the condition that the
+ *            copyright notices  are not removed,  and no compensation
+ *            is received. Private, research, and institutional use is
+ *            free. Distribution of this  code as part of a commercial
+ *            system  is permissible ONLY  BY DIRECT  ARRANGEMENT WITH
+ *            THE AUTHOR.
+ */
+
+#pragma once
+
+#include <cstddef>              // size_t
+#include <algorithm>            // std::nth_element
+#include <vector>               // std::vector
+
+
+/**
+ * \defgroup MAT309NameSpace Namespace MAT309.
+ * @{
+ */
+
+/**
+ * \namespace MAT309
+ *
+ * \brief Global namespace for MAT309 software.
+ */
+
+namespace MAT309
+{
+
+	/**
+	 * \class KdTree
+	 *
+	 * \brief This class is a kd-tree of points in K-dimensional space.
+	 * Each node holds a point and splits space along one coordinate,
+	 * cycling through the coordinates with depth.  The tree can be
+	 * built balanced from a set of points, and points can be inserted
+	 * one at a time afterwards; points inserted in random order, as
+	 * samples thrown at random are, keep the tree shallow.
+	 *
+	 * Points are identified by the order in which they entered the
+	 * tree, starting at 0.  Queries only read the tree, so several
+	 * threads may query the same tree at once.
+	 *
+	 * \tparam K The dimension of the space.
+	 *
+	 */
+	template <size_t K>
+	class KdTree
+	{
+	private:
+
+		// -----------------------------------------------------------
+		//
+		// Private types
+		//
+		// -----------------------------------------------------------
+
+		/**
+		 * \struct Node
+		 *
+		 * \brief A node of the tree.
+		 *
+		 */
+		struct Node
+		{
+			double _x[K];      ///< The coordinates of the point.
+			size_t _left;      ///< Index of the child holding smaller coordinates (or NONE).
+			size_t _right;     ///< Index of the child holding larger coordinates (or NONE).
+			size_t _axis;      ///< The coordinate along which this node splits space.
+		};
+
+
+		// -----------------------------------------------------------
+		//
+		// Private data members
+		//
+		// -----------------------------------------------------------
+
+		static const size_t NONE = size_t(-1);   ///< Index of a missing node.
+
+		std::vector<Node> _nodes;   ///< The nodes, in the order their points entered the tree.
+		size_t _root;               ///< Index of the root node (or NONE).
+
+
+	public:
+
+		// -----------------------------------------------------------
+		//
+		// Public methods
+		//
+		// -----------------------------------------------------------
+
+		/**
+		 * \fn KdTree()
+		 *
+		 * \brief Creates an empty tree.
+		 *
+		 */
+		KdTree() : _root(NONE)
+		{
+		}
+
+
+		/**
+		 * \fn void Clear()
+		 *
+		 * \brief Removes all points from the tree.
+		 *
+		 */
+		void Clear()
+		{
+			_nodes.clear();
+			_root = NONE;
+		}
+
+
+		/**
+		 * \fn void Reserve(size_t numberOfPoints)
+		 *
+		 * \brief Reserves room for a number of points.
+		 *
+		 * \param numberOfPoints The number of points.
+		 *
+		 */
+		void Reserve(size_t numberOfPoints)
+		{
+			_nodes.reserve(numberOfPoints);
+		}
+
+
+		/**
+		 * \fn size_t GetSize() const
+		 *
+		 * \brief Returns the number of points in the tree.
+		 *
+		 * \return The number of points in the tree.
+		 *
+		 */
+		size_t GetSize() const
+		{
+			return _nodes.size();
+		}
+
+
+		/**
+		 * \fn const double* GetPoint(size_t i) const
+		 *
+		 * \brief Returns the coordinates of a point of the tree.
+		 *
+		 * \param i The index of the point.
+		 *
+		 * \return A pointer to the K coordinates of the point.
+		 *
+		 */
+		const double* GetPoint(size_t i) const
+		{
+			return _nodes[i]._x;
+		}
+
+
+		/**
+		 * \fn void Build(size_t numberOfPoints, const double* coordinates)
+		 *
+		 * \brief Replaces the points of the tree with a set of points,
+		 * splitting each subtree at the median of its points.
+		 *
+		 * \param numberOfPoints The number of points.
+		 * \param coordinates The K coordinates of each point, one point
+		 * after the other.
+		 *
+		 */
+		void
+			Build(
+				size_t numberOfPoints,
+				const double* coordinates
+			)
+		{
+			_nodes.resize(numberOfPoints);
+
+			std::vector<size_t> order(numberOfPoints);
+
+			for (size_t i = 0; i < numberOfPoints; i++)
+			{
+				for (size_t k = 0; k < K; k++)
+				{
+					_nodes[i]._x[k] = coordinates[K * i + k];
+				}
+
+				order[i] = i;
+			}
+
+			_root = Build(order, 0, numberOfPoints, 0);
+		}
+
+
+		/**
+		 * \fn size_t Insert(const double* x)
+		 *
+		 * \brief Inserts a point into the tree.
+		 *
+		 * \param x The K coordinates of the point.
+		 *
+		 * \return The index of the point.
+		 *
+		 */
+		size_t
+			Insert(
+				const double* x
+			)
+		{
+			size_t id = _nodes.size();
+
+			Node node;
+
+			for (size_t k = 0; k < K; k++)
+			{
+				node._x[k] = x[k];
+			}
+
+			node._left = node._right = NONE;
+			node._axis = 0;
+
+			if (_root == NONE)
+			{
+				_nodes.push_back(node);
+				_root = id;
+
+				return id;
+			}
+
+			// Descend to the empty child the point belongs to.
+			size_t parent = _root;
+
+			for (;;)
+			{
+				const Node& p = _nodes[parent];
+				size_t child = (x[p._axis] < p._x[p._axis]) ? p._left : p._right;
+
+				if (child == NONE)
+				{
+					break;
+				}
+
+				parent = child;
+			}
+
+			node._axis = (_nodes[parent]._axis + 1) % K;
+			_nodes.push_back(node);
+
+			Node& p = _nodes[parent];
+
+			if (x[p._axis] < p._x[p._axis])
+			{
+				p._left = id;
+			}
+			else
+			{
+				p._right = id;
+			}
+
+			return id;
+		}
+
+
+		/**
+		 * \fn void FindInRadius(const double* x, double radius, std::vector<size_t>& found) const
+		 *
+		 * \brief Finds all points of the tree closer to a point than a
+		 * given distance.
+		 *
+		 * \param x The K coordinates of the point.
+		 * \param radius The distance.
+		 * \param found A reference to an array receiving the indices of
+		 * the points found, in no particular order.
+		 *
+		 */
+		void
+			FindInRadius(
+				const double* x,
+				double radius,
+				std::vector<size_t>& found
+			)
+			const
+		{
+			found.clear();
+
+			if (_root == NONE)
+			{
+				return;
+			}
+
+			const double radius2 = radius * radius;
+
+			// Visit the subtrees that meet the ball around the point.
+			std::vector<size_t> stack;
+			stack.reserve(64);
+			stack.push_back(_root);
+
+			while (!stack.empty())
+			{
+				size_t i = stack.back();
+				stack.pop_back();
+
+				const Node& node = _nodes[i];
+
+				double d2 = 0;
+
+				for (size_t k = 0; k < K; k++)
+				{
+					double d = node._x[k] - x[k];
+					d2 += d * d;
+				}
+
+				if (d2 < radius2)
+				{
+					found.push_back(i);
+				}
+
+				double d = x[node._axis] - node._x[node._axis];
+
+				size_t near = (d < 0) ? node._left : node._right;
+				size_t far = (d < 0) ? node._right : node._left;
+
+				if ((far != NONE) && (d * d < radius2))
+				{
+					stack.push_back(far);
+				}
+
+				if (near != NONE)
+				{
+					stack.push_back(near);
+				}
+			}
+
+			return;
+		}
+
+
+	private:
+
+		// -----------------------------------------------------------
+		//
+		// Private methods
+		//
+		// -----------------------------------------------------------
+
+		/**
+		 * \fn size_t Build(std::vector<size_t>& order, size_t first, size_t last, size_t axis)
+		 *
+		 * \brief Links the nodes of a range of points into a balanced
+		 * subtree.
+		 *
+		 * \param order A reference to an array with the indices of the
+		 * points, reordered within the range.
+		 * \param first Position of the first point of the range.
+		 * \param last Position after the last point of the range.
+		 * \param axis The coordinate along which the root of the
+		 * subtree splits space.
+		 *
+		 * \return The index of the root of the subtree (or NONE, if the
+		 * range is empty).
+		 *
+		 */
+		size_t
+			Build(
+				std::vector<size_t>& order,
+				size_t first,
+				size_t last,
+				size_t axis
+			)
+		{
+			if (first >= last)
+			{
+				return NONE;
+			}
+
+			size_t middle = first + (last - first) / 2;
+
+			std::nth_element(
+				order.begin() + first,
+				order.begin() + middle,
+				order.begin() + last,
+				[this, axis](size_t a, size_t b) { return _nodes[a]._x[axis] < _nodes[b]._x[axis]; }
+			);
+
+			size_t i = order[middle];
+
+			_nodes[i]._axis = axis;
+			_nodes[i]._left = Build(order, first, middle, (axis + 1) % K);
+			_nodes[i]._right = Build(order, middle + 1, last, (axis + 1) % K);
+
+			return i;
+		}
+	};
+
+}
+
+/** @} */ //end of group class.
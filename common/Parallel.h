@@ -0,0 +1,168 @@
+/**
+ * \file Parallel.h
+ *
+ * \brief Definition  and implementation of  helper functions to  run a
+ * loop over a range of indices on several threads.
+ *
+ * \author
+ * Marcelo Ferreira Siqueira \n
+ * Universidade Federal do Rio Grande do Norte, \n
+ * Departamento de Matem&aacute;tica, \n
+ * mfsiqueira at mat (dot) ufrn (dot) br
+ *
+ * \version 1.0
+ * \date October 2026
+ *
+ * \attention This program is distributed WITHOUT ANY WARRANTY, and it
+ *            may be freely redistributed under the condition that the
+ *            copyright notices  are not removed,  and no compensation
+ *            is received. Private, research, and institutional use is
+ *            free. Distribution of this  code as part of a commercial
+ *            system  is permissible ONLY  BY DIRECT  ARRANGEMENT WITH
+ *            THE AUTHOR.
+ */
+
+#pragma once
+
+#include <cstddef>      // size_t
+#include <thread>       // std::thread
+#include <vector>       // std::vector
+#include <exception>    // std::exception_ptr
+
+
+/**
+ * \defgroup MAT309NameSpace Namespace MAT309.
+ * @{
+ */
+
+/**
+ * \namespace MAT309
+ *
+ * \brief Global namespace for MAT309 software.
+ */
+
+namespace MAT309
+{
+
+	/**
+	 * \fn inline size_t DefaultNumberOfThreads()
+	 *
+	 * \brief Returns the number of hardware threads of this machine,
+	 * or 1 if it cannot be determined.
+	 *
+	 * \return The number of hardware threads of this machine.
+	 *
+	 */
+	inline
+	size_t
+		DefaultNumberOfThreads()
+	{
+		size_t n = std::thread::hardware_concurrency();
+		return (n == 0) ? 1 : n;
+	}
+
+
+	/**
+	 * \fn template <typename Body> void ParallelFor(size_t begin, size_t end, size_t numberOfThreads, Body body)
+	 *
+	 * \brief Splits  the index range \c  [begin,end) into contiguous
+	 * blocks, one per thread,  and calls \c body(first, last) for each
+	 * block.  The calling  thread processes the first block.   If the
+	 * body  throws an  exception on  any thread,  the first  one is
+	 * rethrown after all threads have finished.
+	 *
+	 * \param begin First index of the range.
+	 * \param end Index past the last index of the range.
+	 * \param numberOfThreads The number of threads (0 means one per
+	 * hardware thread).
+	 * \param body A callable taking the bounds of a block.
+	 *
+	 */
+	template <typename Body>
+	void
+		ParallelFor(
+			size_t begin,
+			size_t end,
+			size_t numberOfThreads,
+			Body body
+		)
+	{
+		if (end <= begin)
+		{
+			return;
+		}
+
+		if (numberOfThreads == 0)
+		{
+			numberOfThreads = DefaultNumberOfThreads();
+		}
+
+		size_t n = end - begin;
+
+		if (numberOfThreads > n)
+		{
+			numberOfThreads = n;
+		}
+
+		if (numberOfThreads <= 1)
+		{
+			body(begin, end);
+			return;
+		}
+
+		std::vector<std::exception_ptr> errors(numberOfThreads);
+		std::vector<std::thread> threads;
+		threads.reserve(numberOfThreads - 1);
+
+		size_t block = n / numberOfThreads;
+		size_t extra = n % numberOfThreads;
+
+		// Bounds of the k-th block: the first \c extra blocks get one
+		// more index than the others.
+		auto first = [=](size_t k) { return begin + k * block + ((k < extra) ? k : extra); };
+
+		for (size_t k = 1; k < numberOfThreads; k++)
+		{
+			threads.emplace_back(
+				[&, k]()
+				{
+					try
+					{
+						body(first(k), first(k + 1));
+					}
+					catch (...)
+					{
+						errors[k] = std::current_exception();
+					}
+				}
+			);
+		}
+
+		try
+		{
+			body(first(0), first(1));
+		}
+		catch (...)
+		{
+			errors[0] = std::current_exception();
+		}
+
+		for (size_t k = 0; k < threads.size(); k++)
+		{
+			threads[k].join();
+		}
+
+		for (size_t k = 0; k < numberOfThreads; k++)
+		{
+			if (errors[k])
+			{
+				std::rethrow_exception(errors[k]);
+			}
+		}
+
+		return;
+	}
+
+}
+
+/** @} */ //end of group class.
@@ -25,8 +25,8 @@
 
 #pragma once
 
-#include <cstdlib>    // rand(), srand(), RAND_MAX
 #include <ctime>      // time()
+#include <random>     // std::mt19937
 
 
 /**
@@ -47,10 +47,23 @@ namespace MAT309
 	 * \class Random
 	 *
 	 * \brief This  class represents a pseudo-random  generator of
-	 * real values in a given interval.
+	 * real values in a given interval.  Each instance has its own
+	 * state, so instances  owned by different threads do not share
+	 * anything.
 	 *
 	 */
 	 class Random {
+	 private:
+
+		// -------------------------------------------------------
+		//
+		// Private data members
+		//
+		// -------------------------------------------------------
+
+		std::mt19937 _engine;    ///< The pseudo-random number engine.
+
+
 	 public:
 
 		// -------------------------------------------------------
@@ -65,9 +78,37 @@ namespace MAT309
 		 * \brief Creates an instance of this class.
 		 *
 		 */
-		Random()
+		Random() : _engine((unsigned)time(0))
+		{
+		}
+
+
+		/**
+		 * \fn Random(unsigned seed)
+		 *
+		 * \brief Creates an  instance of this class  whose sequence is
+		 * determined by a given seed.
+		 *
+		 * \param seed The seed of the generator.
+		 *
+		 */
+		Random(unsigned seed) : _engine(seed)
+		{
+		}
+
+
+		/**
+		 * \fn void seed(unsigned seed)
+		 *
+		 * \brief Restarts the sequence of this generator from a given
+		 * seed.
+		 *
+		 * \param seed The seed of the generator.
+		 *
+		 */
+		void seed(unsigned seed)
 		{
-			srand((unsigned)time(0));
+			_engine.seed(seed);
 		}
 
 
@@ -84,7 +125,7 @@ namespace MAT309
 		 */
 		double draw()
 		{
-			return double(rand()) / double(RAND_MAX);
+			return double(_engine() - _engine.min()) / double(_engine.max() - _engine.min());
 		}
 
 
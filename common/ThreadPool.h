@@ -0,0 +1,423 @@
+/**
+ * \file ThreadPool.h
+ *
+ * \brief Definition  and implementation of  the class ThreadPool, which
+ * runs tasks on a fixed set of worker threads with work stealing.
+ *
+ * \author
+ * Marcelo Ferreira Siqueira \n
+ * Universidade Federal do Rio Grande do Norte, \n
+ * Departamento de Matem&aacute;tica, \n
+ * mfsiqueira at mat (dot) ufrn (dot) br
+ *
+ * \version 1.0
+ * \date October 2026
+ *
+ * \attention This program is distributed WITHOUT ANY WARRANTY, and it
+ *            may be freely redistributed under the condition that the
+ *            copyright notices  are not removed,  and no compensation
+ *            is received. Private, research, and institutional use is
+ *            free. Distribution of this  code as part of a commercial
+ *            system  is permissible ONLY  BY DIRECT  ARRANGEMENT WITH
+ *            THE AUTHOR.
+ */
+
+#pragma once
+
+#include "Parallel.h"           // DefaultNumberOfThreads
+
+#include <cstddef>              // size_t
+#include <deque>                // std::deque
+#include <memory>               // std::unique_ptr
+#include <mutex>                // std::mutex
+#include <thread>               // std::thread
+#include <vector>               // std::vector
+#include <exception>            // std::exception_ptr
+#include <functional>           // std::function
+#include <condition_variable>   // std::condition_variable
+
+
+/**
+ * \defgroup MAT309NameSpace Namespace MAT309.
+ * @{
+ */
+
+/**
+ * \namespace MAT309
+ *
+ * \brief Global namespace for MAT309 software.
+ */
+
+namespace MAT309
+{
+
+	/**
+	 * \class ThreadPool
+	 *
+	 * \brief This class  runs tasks on a  fixed set of worker threads.
+	 * Each worker has its own task deque: a task submitted by a worker
+	 * goes to the back of that worker's deque, and other tasks are
+	 * dealt to the workers in turn.  A worker takes its own tasks from
+	 * the back (most recent first) and, once its deque is empty, steals
+	 * the oldest task of another worker.
+	 *
+	 * Tasks  can find out  which worker runs  them, so they can use
+	 * per-worker buffers without locking.
+	 *
+	 */
+	class ThreadPool
+	{
+	public:
+
+		// -----------------------------------------------------------
+		//
+		// Type definitions
+		//
+		// -----------------------------------------------------------
+
+		/**
+		 * \typedef Task
+		 *
+		 * \brief Alias for a task.
+		 *
+		 */
+		typedef std::function<void ()> Task;
+
+
+	private:
+
+		/**
+		 * \struct Worker
+		 *
+		 * \brief This struct holds the task deque of a worker.
+		 *
+		 */
+		struct Worker
+		{
+			std::deque<Task> _tasks;    ///< The tasks of this worker.
+			std::mutex _mutex;          ///< A mutex protecting the deque.
+		};
+
+
+		// -----------------------------------------------------------
+		//
+		// Private data members
+		//
+		// -----------------------------------------------------------
+
+		std::vector< std::unique_ptr<Worker> > _workers;   ///< The task deques of the workers.
+		std::vector<std::thread> _threads;                 ///< The worker threads.
+		std::mutex _mutex;                                 ///< A mutex protecting the counters below.
+		std::condition_variable _wakeup;                   ///< Signals workers that a task was queued.
+		std::condition_variable _done;                     ///< Signals that all tasks have finished.
+		size_t _queued;                                    ///< Number of tasks in the deques not yet claimed by a worker.
+		size_t _pending;                                   ///< Number of tasks submitted and not yet finished.
+		size_t _next;                                      ///< Worker receiving the next task submitted from outside the pool.
+		bool _stopping;                                    ///< A flag to tell the workers to exit.
+		std::exception_ptr _error;                         ///< The first exception thrown by a task.
+
+
+	public:
+
+		// -----------------------------------------------------------
+		//
+		// Public methods
+		//
+		// -----------------------------------------------------------
+
+		/**
+		 * \fn ThreadPool(size_t numberOfThreads = 0)
+		 *
+		 * \brief Creates an instance of this class and starts its
+		 * workers.
+		 *
+		 * \param numberOfThreads The number of workers (0 means one per
+		 * hardware thread).
+		 *
+		 */
+		ThreadPool(size_t numberOfThreads = 0)
+			:
+			_queued(0),
+			_pending(0),
+			_next(0),
+			_stopping(false)
+		{
+			if (numberOfThreads == 0)
+			{
+				numberOfThreads = DefaultNumberOfThreads();
+			}
+
+			for (size_t i = 0; i < numberOfThreads; i++)
+			{
+				_workers.push_back(std::unique_ptr<Worker>(new Worker));
+			}
+
+			for (size_t i = 0; i < numberOfThreads; i++)
+			{
+				_threads.emplace_back(&ThreadPool::Work, this, i);
+			}
+		}
+
+
+		/**
+		 * \fn ~ThreadPool()
+		 *
+		 * \brief  Waits for all  tasks to finish and  stops the
+		 * workers.
+		 *
+		 */
+		~ThreadPool()
+		{
+			{
+				std::unique_lock<std::mutex> lock(_mutex);
+				_done.wait(lock, [this] { return _pending == 0; });
+				_stopping = true;
+			}
+
+			_wakeup.notify_all();
+
+			for (size_t i = 0; i < _threads.size(); i++)
+			{
+				_threads[i].join();
+			}
+		}
+
+
+		/**
+		 * \fn size_t GetNumberOfThreads() const
+		 *
+		 * \brief Returns the number of workers of this pool.
+		 *
+		 * \return The number of workers of this pool.
+		 *
+		 */
+		size_t GetNumberOfThreads() const
+		{
+			return _workers.size();
+		}
+
+
+		/**
+		 * \fn void Submit(Task task)
+		 *
+		 * \brief Queues a task.  Tasks may submit further tasks.
+		 *
+		 * \param task The task.
+		 *
+		 */
+		void Submit(Task task)
+		{
+			size_t index = GetWorkerIndex();
+
+			{
+				std::lock_guard<std::mutex> lock(_mutex);
+
+				if (index >= _workers.size())
+				{
+					index = _next;
+					_next = (_next + 1) % _workers.size();
+				}
+
+				++_pending;
+			}
+
+			{
+				std::lock_guard<std::mutex> lock(_workers[index]->_mutex);
+				_workers[index]->_tasks.push_back(task);
+			}
+
+			{
+				std::lock_guard<std::mutex> lock(_mutex);
+				++_queued;
+			}
+
+			_wakeup.notify_one();
+		}
+
+
+		/**
+		 * \fn void Wait()
+		 *
+		 * \brief Waits until all  tasks submitted so far, and all tasks
+		 * they submitted, have finished.  If a task threw an exception,
+		 * the first one is rethrown.  This method must not be called
+		 * from a task.
+		 *
+		 */
+		void Wait()
+		{
+			std::exception_ptr error;
+
+			{
+				std::unique_lock<std::mutex> lock(_mutex);
+				_done.wait(lock, [this] { return _pending == 0; });
+
+				error = _error;
+				_error = nullptr;
+			}
+
+			if (error)
+			{
+				std::rethrow_exception(error);
+			}
+		}
+
+
+		/**
+		 * \fn static size_t GetWorkerIndex()
+		 *
+		 * \brief Returns the index of the worker running the calling
+		 * thread.
+		 *
+		 * \return The index of the worker, or a number not smaller than
+		 * the number of workers if the caller is not a worker.
+		 *
+		 */
+		static size_t GetWorkerIndex()
+		{
+			return WorkerIndex();
+		}
+
+
+	private:
+
+		// -----------------------------------------------------------
+		//
+		// Private methods
+		//
+		// -----------------------------------------------------------
+
+		/**
+		 * \fn ThreadPool(const ThreadPool& p)
+		 *
+		 * \brief Copying a pool is not allowed.
+		 *
+		 * \param p An instance of this class.
+		 *
+		 */
+		ThreadPool(const ThreadPool& p) = delete;
+
+
+		/**
+		 * \fn static size_t& WorkerIndex()
+		 *
+		 * \brief Returns a reference to the worker index of the calling
+		 * thread.
+		 *
+		 * \return A reference to the worker index of the calling thread.
+		 *
+		 */
+		static size_t& WorkerIndex()
+		{
+			thread_local size_t index = size_t(-1);
+			return index;
+		}
+
+
+		/**
+		 * \fn void Take(size_t index, Task& task)
+		 *
+		 * \brief Takes a task for a worker, from the back of its own
+		 * deque or, if it is empty, from the front of another deque.
+		 * The caller must have claimed a queued task, so one exists.
+		 *
+		 * \param index The index of the worker.
+		 * \param task A reference to the task taken.
+		 *
+		 */
+		void Take(size_t index, Task& task)
+		{
+			while (true)
+			{
+				{
+					std::lock_guard<std::mutex> lock(_workers[index]->_mutex);
+
+					if (!_workers[index]->_tasks.empty())
+					{
+						task = std::move(_workers[index]->_tasks.back());
+						_workers[index]->_tasks.pop_back();
+						return;
+					}
+				}
+
+				for (size_t k = 1; k < _workers.size(); k++)
+				{
+					Worker& victim = *_workers[(index + k) % _workers.size()];
+
+					std::lock_guard<std::mutex> lock(victim._mutex);
+
+					if (!victim._tasks.empty())
+					{
+						task = std::move(victim._tasks.front());
+						victim._tasks.pop_front();
+						return;
+					}
+				}
+
+				// The claimed task has not been pushed yet.
+				std::this_thread::yield();
+			}
+		}
+
+
+		/**
+		 * \fn void Work(size_t index)
+		 *
+		 * \brief Body of a worker thread.
+		 *
+		 * \param index The index of the worker.
+		 *
+		 */
+		void Work(size_t index)
+		{
+			WorkerIndex() = index;
+
+			while (true)
+			{
+				{
+					std::unique_lock<std::mutex> lock(_mutex);
+					_wakeup.wait(lock, [this] { return (_queued > 0) || _stopping; });
+
+					if (_queued == 0)
+					{
+						return;
+					}
+
+					// Claim one of the queued tasks.
+					--_queued;
+				}
+
+				Task task;
+				Take(index, task);
+
+				std::exception_ptr error;
+
+				try
+				{
+					task();
+				}
+				catch (...)
+				{
+					error = std::current_exception();
+				}
+
+				{
+					std::lock_guard<std::mutex> lock(_mutex);
+
+					if (error && !_error)
+					{
+						_error = error;
+					}
+
+					if (--_pending == 0)
+					{
+						_done.notify_all();
+					}
+				}
+			}
+		}
+	};
+
+}
+
+/** @} */ //end of group class.
@@ -2,3 +2,7 @@ cd src
 make
 make clean
 cd ..
+cd bench
+make
+make clean
+cd ..
@@ -0,0 +1,220 @@
+/**
+ * \file AlphaEstimator.cpp
+ *
+ * \brief Implementation of the class AlphaEstimator, which chooses
+ * the Poisson disk radius giving about a desired number of sample
+ * points on a surface.
+ *
+ * \author
+ * Adelino Afonso e Irene Ginani \n
+ * Universidade Federal do Rio Grande do Norte, \n
+ * Instituto Metr&oacute;pole Digital, \n
+ * Adelino Afonso at imd (dot) ufrn (dot) br, \n
+ * Irene Ginani at imd (dot) ufrn (dot) br
+ *
+ * \version 1.0
+ * \date October 2026
+ *
+ * \attention This program is distributed WITHOUT ANY WARRANTY, and it
+ *            may be freely redistributed under the condition that the
+ *            copyright notices  are not removed,  and no compensation
+ *            is received. Private, research, and institutional use is
+ *            free. Distribution of this  code as part of a commercial
+ *            system  is permissible ONLY  BY DIRECT  ARRANGEMENT WITH
+ *            THE AUTHOR.
+ */
+
+#include "AlphaEstimator.h"      // AlphaEstimator
+#include "PDSampler.h"           // PDSampler
+#include "Parallel.h"            // ParallelFor
+
+#include <algorithm>             // std::max
+#include <cmath>                 // sqrt, acos
+#include <stdexcept>             // std::runtime_error
+#include <vector>                // std::vector
+
+
+/**
+ * \defgroup MAT309NameSpace Namespace MAT309.
+ * @{
+ */
+
+/**
+ * \namespace MAT309
+ *
+ * \brief Global namespace for MAT309 software.
+ */
+
+namespace MAT309
+{
+
+	/**
+	 * \fn double AlphaEstimator::GetArea(const spSurface& surface) const
+	 *
+	 * \brief Computes the area of a surface.
+	 *
+	 * \param surface A pointer to the surface.
+	 *
+	 * \return The area of the surface.
+	 *
+	 */
+	double
+		AlphaEstimator::GetArea(
+			const spSurface& surface
+		)
+		const
+	{
+		const size_t n = _resolution;
+
+		const double umin = surface->GetUMin();
+		const double vmin = surface->GetVMin();
+		const double du = (surface->GetUMax() - umin) / n;
+		const double dv = (surface->GetVMax() - vmin) / n;
+
+		// Two-point Gauss-Legendre nodes on [0, 1], with weights 1/2.
+		const double node[2] = { 0.5 - 0.5 / sqrt(3.0), 0.5 + 0.5 / sqrt(3.0) };
+
+		// Sum each row of cells apart, and then the rows in order, so
+		// that the area does not depend on the number of threads.
+		std::vector<double> rows(n, 0);
+
+		ParallelFor(
+			0,
+			n,
+			_numberOfThreads,
+			[&](size_t first, size_t last)
+			{
+				for (size_t i = first; i < last; i++)
+				{
+					double sum = 0;
+
+					for (size_t j = 0; j < n; j++)
+					{
+						for (int a = 0; a < 2; a++)
+						{
+							for (int b = 0; b < 2; b++)
+							{
+								double e, f, g;
+								surface->GetFirstFundamentalForm(
+									umin + (i + node[a]) * du,
+									vmin + (j + node[b]) * dv,
+									e,
+									f,
+									g
+								);
+
+								sum += sqrt(std::max(0.0, e * g - f * f));
+							}
+						}
+					}
+
+					rows[i] = sum * du * dv / 4;
+				}
+			}
+		);
+
+		double area = 0;
+
+		for (size_t i = 0; i < n; i++)
+		{
+			area += rows[i];
+		}
+
+		return area;
+	}
+
+
+	/**
+	 * \fn double AlphaEstimator::Estimate(const spSurface& surface, size_t numberOfPoints) const
+	 *
+	 * \brief Computes the Poisson disk radius with which about a given
+	 * number of points are sampled on a surface.
+	 *
+	 * \param surface A pointer to the surface.
+	 * \param numberOfPoints The desired number of sample points.
+	 *
+	 * \return The Poisson disk radius.
+	 *
+	 */
+	double
+		AlphaEstimator::Estimate(
+			const spSurface& surface,
+			size_t numberOfPoints
+		)
+		const
+	{
+		if (numberOfPoints < 4)
+		{
+			throw std::runtime_error("At least four sample points (the corners of the domain) are needed.");
+		}
+
+		double area = GetArea(surface);
+
+		if (area <= 0)
+		{
+			throw std::runtime_error("The surface has no area to sample.");
+		}
+
+		const double pi = acos(-1.0);
+		const double n = double(numberOfPoints);
+
+		// When dart throwing gives up after about a hundred failed
+		// trials, the disks of radius alpha around the samples cover
+		// close to 38% of the surface (a hexagonal packing covers 91%).
+		const double coverage = 0.38;
+
+		double alpha = sqrt(coverage * area / (pi * n));
+
+		if ((_trialPoints == 0) || (numberOfPoints <= _trialPoints))
+		{
+			return alpha;
+		}
+
+		// Sample the surface with a radius giving about _trialPoints
+		// points, and scale the radius by the square root of the ratio
+		// between the points found and the points expected, as their
+		// number goes with the inverse square of the radius.  This
+		// corrects for what the area misses, such as samples crowding
+		// where the parametrization degenerates.
+		double trialAlpha = alpha * sqrt(n / _trialPoints);
+		double trialPoints = double(Trial(surface, trialAlpha));
+
+		return trialAlpha * sqrt(trialPoints / n);
+	}
+
+
+	/**
+	 * \fn size_t AlphaEstimator::Trial(const spSurface& surface, double alpha) const
+	 *
+	 * \brief Samples a surface and counts the sample points.
+	 *
+	 * \param surface A pointer to the surface.
+	 * \param alpha The Poisson disk radius.
+	 *
+	 * \return The number of sample points.
+	 *
+	 */
+	size_t
+		AlphaEstimator::Trial(
+			const spSurface& surface,
+			double alpha
+		)
+		const
+	{
+		PDSampler sampler;
+
+		sampler.setAlpha(alpha);
+		sampler.setMT(_maxTrials);
+		sampler.setSeed(_seed);
+
+		size_t numberOfPoints = 0;
+		std::vector<PDSampler::spPoint> points;
+
+		sampler.sample(surface, numberOfPoints, points);
+
+		return numberOfPoints;
+	}
+
+}
+
+/** @} */ //end of group class.
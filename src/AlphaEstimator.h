@@ -0,0 +1,207 @@
+/**
+ * \file AlphaEstimator.h
+ *
+ * \brief This file contains the definition of a class that chooses
+ * the Poisson disk radius giving about a desired number of sample
+ * points on a surface.
+ *
+ * \author
+ * Adelino Afonso e Irene Ginani \n
+ * Universidade Federal do Rio Grande do Norte, \n
+ * Instituto Metr&oacute;pole Digital, \n
+ * Adelino Afonso at imd (dot) ufrn (dot) br, \n
+ * Irene Ginani at imd (dot) ufrn (dot) br
+ *
+ * \version 1.0
+ * \date October 2026
+ *
+ * \attention This program is distributed WITHOUT ANY WARRANTY, and it
+ *            may be freely redistributed under the condition that the
+ *            copyright notices  are not removed,  and no compensation
+ *            is received. Private, research, and institutional use is
+ *            free. Distribution of this  code as part of a commercial
+ *            system  is permissible ONLY  BY DIRECT  ARRANGEMENT WITH
+ *            THE AUTHOR.
+ */
+
+#pragma once
+
+#include "Surface.h"           // Surface
+
+#include <memory>              // std::shared_ptr
+
+
+/**
+ * \defgroup MAT309NameSpace Namespace MAT309.
+ * @{
+ */
+
+/**
+ * \namespace MAT309
+ *
+ * \brief Global namespace for MAT309 software.
+ *
+ */
+
+namespace MAT309
+{
+
+	/**
+	 * \class AlphaEstimator
+	 *
+	 * \brief This class chooses the radius alpha with which PDSampler
+	 * gives about a desired number N of sample points on a surface.
+	 *
+	 * The area of the surface is integrated over the parameter domain
+	 * with Gauss quadrature of the area element sqrt(EG - F^2), the
+	 * rows of the quadrature grid being summed in parallel.  The first
+	 * guess of alpha follows from the fraction of the surface that the
+	 * disks of radius alpha around the samples cover when sampling
+	 * stops.  Optionally, the guess is then corrected with a quick
+	 * trial run of the sampler with a larger radius, the number of
+	 * samples going with the inverse square of the radius.  A trial
+	 * with a thousand points takes a fraction of a second.
+	 *
+	 */
+	class AlphaEstimator
+	{
+	public:
+
+		// -----------------------------------------------------------
+		//
+		// Type definitions
+		//
+		// -----------------------------------------------------------
+
+		/**
+		 * \typedef spSurface
+		 *
+		 * \brief Alias for a shared pointer to a surface.
+		 *
+		 */
+		typedef std::shared_ptr<Surface> spSurface;
+
+
+	private:
+
+		// -----------------------------------------------------------
+		//
+		// Private data members
+		//
+		// -----------------------------------------------------------
+
+		double _maxTrials;          ///< Number of failed trials after which sampling stops.
+		unsigned _seed;             ///< Seed of the sampler in the trial runs.
+		size_t _trialPoints;        ///< Number of sample points of the trial run (0 means no trial).
+		size_t _resolution;         ///< Number of quadrature cells along each parameter.
+		size_t _numberOfThreads;    ///< Number of threads (0 means one per hardware thread).
+
+
+	public:
+
+		// -----------------------------------------------------------
+		//
+		// Public methods
+		//
+		// -----------------------------------------------------------
+
+		/**
+		 * \fn AlphaEstimator(double maxTrials = 100, unsigned seed = 1, size_t trialPoints = 1000, size_t resolution = 64, size_t numberOfThreads = 0)
+		 *
+		 * \brief Creates an instance of this class.
+		 *
+		 * \param maxTrials Number of failed trials after which sampling
+		 * stops, as given to the sampler.
+		 * \param seed Seed of the sampler in the trial runs.
+		 * \param trialPoints Number of sample points of the trial run (0
+		 * means no trial).
+		 * \param resolution Number of quadrature cells along each
+		 * parameter.
+		 * \param numberOfThreads Number of threads (0 means one per
+		 * hardware thread).
+		 *
+		 */
+		AlphaEstimator(
+			double maxTrials = 100,
+			unsigned seed = 1,
+			size_t trialPoints = 1000,
+			size_t resolution = 64,
+			size_t numberOfThreads = 0
+		)
+			:
+			_maxTrials(maxTrials),
+			_seed(seed),
+			_trialPoints(trialPoints),
+			_resolution((resolution > 0) ? resolution : 1),
+			_numberOfThreads(numberOfThreads)
+		{
+		}
+
+
+		/**
+		 * \fn double GetArea(const spSurface& surface) const
+		 *
+		 * \brief Computes the area of a surface.
+		 *
+		 * \param surface A pointer to the surface.
+		 *
+		 * \return The area of the surface.
+		 *
+		 */
+		double
+			GetArea(
+				const spSurface& surface
+			)
+			const;
+
+
+		/**
+		 * \fn double Estimate(const spSurface& surface, size_t numberOfPoints) const
+		 *
+		 * \brief Computes the Poisson disk radius with which about a
+		 * given number of points are sampled on a surface.
+		 *
+		 * \param surface A pointer to the surface.
+		 * \param numberOfPoints The desired number of sample points.
+		 *
+		 * \return The Poisson disk radius.
+		 *
+		 */
+		double
+			Estimate(
+				const spSurface& surface,
+				size_t numberOfPoints
+			)
+			const;
+
+
+	private:
+
+		// -----------------------------------------------------------
+		//
+		// Private methods
+		//
+		// -----------------------------------------------------------
+
+		/**
+		 * \fn size_t Trial(const spSurface& surface, double alpha) const
+		 *
+		 * \brief Samples a surface and counts the sample points.
+		 *
+		 * \param surface A pointer to the surface.
+		 * \param alpha The Poisson disk radius.
+		 *
+		 * \return The number of sample points.
+		 *
+		 */
+		size_t
+			Trial(
+				const spSurface& surface,
+				double alpha
+			)
+			const;
+	};
+
+}
+
+/** @} */ //end of group class.
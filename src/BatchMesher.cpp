@@ -0,0 +1,875 @@
+/**
+ * \file BatchMesher.cpp
+ *
+ * \brief Implementation of  the class BatchMesher,  which meshes a list
+ * of surface patches concurrently on a work-stealing thread pool.
+ *
+ * \author
+ * Adelino Afonso e Irene Ginani \n
+ * Universidade Federal do Rio Grande do Norte, \n
+ * Instituto Metr&oacute;pole Digital, \n
+ * Adelino Afonso at imd (dot) ufrn (dot) br, \n
+ * Irene Ginani at imd (dot) ufrn (dot) br
+ *
+ * \version 1.0
+ * \date October 2026
+ *
+ * \attention This program is distributed WITHOUT ANY WARRANTY, and it
+ *            may be freely redistributed under the condition that the
+ *            copyright notices  are not removed,  and no compensation
+ *            is received. Private, research, and institutional use is
+ *            free. Distribution of this  code as part of a commercial
+ *            system  is permissible ONLY  BY DIRECT  ARRANGEMENT WITH
+ *            THE AUTHOR.
+ */
+
+#include "BatchMesher.h"           // BatchMesher
+#include "SubPatch.h"              // SubPatch
+#include "OffWriter.h"             // OffWriter
+#include "Cdt.h"                   // cdt::CDT
+#include "FaceVisitor.h"           // cdt::FaceVisitor
+#include "TriangulationVisitor.h"  // cdt::TriangulationVisitor
+#include "LloydRelaxer.h"          // LloydRelaxer
+#include "SampleEliminator.h"      // SampleEliminator
+#include "AlphaEstimator.h"        // AlphaEstimator
+
+#include <cmath>                   // sqrt, ceil, floor
+#include <cstdlib>                 // EXIT_SUCCESS, EXIT_FAILURE
+#include <limits>                  // std::numeric_limits
+#include <fstream>                 // std::ofstream
+#include <iostream>                // std::cout, std::cerr, std::endl
+#include <algorithm>               // std::min, std::max
+#include <stdexcept>               // std::runtime_error
+
+
+/**
+ * \defgroup MAT309NameSpace Namespace MAT309.
+ * @{
+ */
+
+/**
+ * \namespace MAT309
+ *
+ * \brief Global namespace for MAT309 software.
+ */
+
+namespace MAT309
+{
+
+	/**
+	 * \fn BatchMesher::BatchMesher(const SurfaceRegistry& registry, size_t numberOfThreads)
+	 *
+	 * \brief Creates an instance of this class and starts its worker
+	 * threads.
+	 *
+	 * \param registry The registry of surfaces.
+	 * \param numberOfThreads The number of worker threads (0 means one
+	 * per hardware thread).
+	 *
+	 */
+	BatchMesher::BatchMesher(
+		const SurfaceRegistry& registry,
+		size_t numberOfThreads
+	)
+		:
+		_registry(registry),
+		_pool(numberOfThreads),
+		_buffers(_pool.GetNumberOfThreads()),
+		_numberOfFailures(0),
+		_numberOfPatches(0)
+	{
+	}
+
+
+	/**
+	 * \fn int BatchMesher::Run(const std::vector<DriverOptions>& patches)
+	 *
+	 * \brief Meshes a list of patches and waits until all of them are
+	 * written.
+	 *
+	 * \param patches The settings of each patch.
+	 *
+	 * \return EXIT_SUCCESS, or EXIT_FAILURE if any patch failed.
+	 *
+	 */
+	int
+		BatchMesher::Run(
+			const std::vector<DriverOptions>& patches
+		)
+	{
+		std::cout	<< std::endl
+					<< "Meshing "
+					<< patches.size()
+					<< " patches on "
+					<< _pool.GetNumberOfThreads()
+					<< " threads..."
+					<< std::endl;
+		std::cout.flush();
+
+		_numberOfPatches = patches.size();
+		_numberOfFailures = 0;
+
+		std::vector< std::unique_ptr<Patch> > work;
+
+		for (size_t i = 0; i < patches.size(); i++)
+		{
+			work.push_back(std::unique_ptr<Patch>(new Patch));
+			work.back()->_index = i;
+			work.back()->_options = patches[i];
+		}
+
+		// Planning a patch submits the tasks sampling its tiles, which
+		// idle workers steal from the worker that planned the patch.
+		for (size_t i = 0; i < work.size(); i++)
+		{
+			Patch* patch = work[i].get();
+			_pool.Submit([this, patch] { Plan(*patch); });
+		}
+
+		_pool.Wait();
+
+		std::cout	<< "Finished: "
+					<< (patches.size() - _numberOfFailures)
+					<< " of "
+					<< patches.size()
+					<< " patches meshed."
+					<< std::endl
+					<< std::endl;
+		std::cout.flush();
+
+		return (_numberOfFailures == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+	}
+
+
+	/**
+	 * \fn void BatchMesher::Plan(Patch& patch)
+	 *
+	 * \brief Creates the surface of a patch, splits it into tiles, and
+	 * submits one sampling task per tile.
+	 *
+	 * \param patch A reference to the patch.
+	 *
+	 */
+	void
+		BatchMesher::Plan(
+			Patch& patch
+		)
+	{
+		const DriverOptions& options = patch._options;
+
+		patch._timer.AddLabel("output", options._output);
+		patch._timer.AddLabel("surface", options._surface);
+		patch._timer.AddLabel("target_points", options._targetPoints);
+		patch._timer.AddLabel("max_error", options._maxError);
+		patch._timer.AddLabel("points", options._numberOfSamples);
+		patch._timer.AddLabel("max_trials", options._maxTrials);
+		patch._timer.AddLabel("seed", options._seed);
+
+		patch._timer.Start("plan");
+
+		try
+		{
+			patch._surface = _registry.Create(options._surface);
+
+			// Patches are planned on the workers, so the radius of a patch
+			// is estimated on one thread.
+			if (options._targetPoints > 0)
+			{
+				AlphaEstimator estimator(options._maxTrials, options._seed, options._trialPoints, 64, 1);
+
+				patch._options._alpha = estimator.Estimate(patch._surface, options._targetPoints);
+			}
+
+			patch._timer.AddLabel("alpha", options._alpha);
+
+			const Surface& surface = *patch._surface;
+
+			// Survey the first fundamental form on a grid of the domain
+			// to estimate the area, the extent of the domain along each
+			// parameter, and the smallest stretch of the parametrization.
+			const size_t n = 16;
+
+			double du = (surface.GetUMax() - surface.GetUMin()) / n;
+			double dv = (surface.GetVMax() - surface.GetVMin()) / n;
+
+			double area = 0;
+			double lengthU = 0;
+			double lengthV = 0;
+			double minStretch = std::numeric_limits<double>::max();
+
+			for (size_t i = 0; i < n; i++)
+			{
+				for (size_t j = 0; j < n; j++)
+				{
+					double u = surface.GetUMin() + (i + 0.5) * du;
+					double v = surface.GetVMin() + (j + 0.5) * dv;
+
+					double xu, yu, zu;
+					double xv, yv, zv;
+
+					surface.GetDu(u, v, xu, yu, zu);
+					surface.GetDv(u, v, xv, yv, zv);
+
+					double E = xu * xu + yu * yu + zu * zu;
+					double F = xu * xv + yu * yv + zu * zv;
+					double G = xv * xv + yv * yv + zv * zv;
+
+					area += sqrt(std::max(0.0, E * G - F * F)) * du * dv;
+					lengthU += sqrt(E) * du / n;
+					lengthV += sqrt(G) * dv / n;
+
+					// Smallest eigenvalue of the first fundamental form.
+					double mean = 0.5 * (E + G);
+					double diff = 0.5 * (E - G);
+
+					minStretch = std::min(minStretch, mean - sqrt(diff * diff + F * F));
+				}
+			}
+
+			// A Poisson disk sample of radius alpha has at most as many
+			// points as a hexagonal packing with spacing 2 alpha.
+			double expected = area / (2 * sqrt(3.0) * options._alpha * options._alpha);
+
+			size_t numberOfTiles = 1;
+
+			// Tiles are merged with the fixed radius alpha, so a patch
+			// whose radius varies, or whose samples are drawn by sample
+			// elimination, is sampled whole.  So is a patch whose sides
+			// are sampled first, which only its own sides bound.
+			if (
+				(options._maxTilePoints > 0) &&
+				(options._maxError == 0) &&
+				(options._numberOfSamples == 0) &&
+				(options._patchBoundary != "sampled") &&
+				(expected > options._maxTilePoints)
+			   )
+			{
+				numberOfTiles = size_t(ceil(expected / options._maxTilePoints));
+			}
+
+			// Make the tiles about as long as wide on the surface.
+			double ratio = (lengthV > 0) ? lengthU / lengthV : 1;
+			size_t nu = size_t(std::max(1.0, floor(sqrt(numberOfTiles * ratio) + 0.5)));
+
+			nu = std::min(nu, numberOfTiles);
+
+			size_t nv = (numberOfTiles + nu - 1) / nu;
+
+			patch._numberOfTilesU = nu;
+			patch._numberOfTilesV = nv;
+
+			// Two samples farther apart than this in either parameter
+			// are farther than 2 alpha apart on the surface.
+			patch._band = (minStretch > 0) ? 2 * options._alpha / sqrt(minStretch) : std::numeric_limits<double>::max();
+
+			patch._tiles.resize(nu * nv);
+
+			for (size_t j = 0; j < nv; j++)
+			{
+				for (size_t i = 0; i < nu; i++)
+				{
+					Tile& tile = patch._tiles[j * nu + i];
+
+					tile._seed = options._seed + unsigned(j * nu + i);
+
+					if ((nu == 1) && (nv == 1))
+					{
+						tile._surface = patch._surface;
+					}
+					else
+					{
+						double umin = surface.GetUMin();
+						double umax = surface.GetUMax();
+						double vmin = surface.GetVMin();
+						double vmax = surface.GetVMax();
+
+						tile._surface = std::make_shared<SubPatch>(
+							patch._surface,
+							umin + i * (umax - umin) / nu,
+							(i + 1 == nu) ? umax : umin + (i + 1) * (umax - umin) / nu,
+							vmin + j * (vmax - vmin) / nv,
+							(j + 1 == nv) ? vmax : vmin + (j + 1) * (vmax - vmin) / nv
+						);
+					}
+				}
+			}
+		}
+		catch (const std::exception& xpt)
+		{
+			Fail(patch, xpt);
+			return;
+		}
+
+		patch._timer.Stop();
+		patch._timer.AddCount("tiles", patch._tiles.size());
+
+		patch._remainingTiles = patch._tiles.size();
+
+		for (size_t t = 0; t < patch._tiles.size(); t++)
+		{
+			Patch* p = &patch;
+			_pool.Submit([this, p, t] { SampleTile(*p, t); });
+		}
+
+		return;
+	}
+
+
+	/**
+	 * \fn void BatchMesher::SampleTile(Patch& patch, size_t tile)
+	 *
+	 * \brief Samples a tile of a patch.  The task sampling the last tile
+	 * of a patch goes on to mesh the patch.
+	 *
+	 * \param patch A reference to the patch.
+	 * \param tile The index of the tile.
+	 *
+	 */
+	void
+		BatchMesher::SampleTile(
+			Patch& patch,
+			size_t tile
+		)
+	{
+		if (!patch._failed)
+		{
+			Tile& t = patch._tiles[tile];
+
+			t._timer.Start("sampling");
+
+			size_t numberOfPoints = 0;
+
+			try
+			{
+				if (patch._options._numberOfSamples > 0)
+				{
+					SampleEliminator eliminator(t._seed, 5, 1);
+
+					eliminator.Sample(t._surface, patch._options._numberOfSamples, numberOfPoints, t._points);
+				}
+				else
+				{
+					PDSampler& sampler = _buffers[ThreadPool::GetWorkerIndex()]._sampler;
+
+					sampler.setAlpha(patch._options._alpha);
+					sampler.setMT(patch._options._maxTrials);
+					sampler.setSeed(t._seed);
+					sampler.setMaxError(patch._options._maxError);
+					sampler.setMinAlpha(patch._options._minAlpha);
+					sampler.setBoundaryFirst(patch._options._patchBoundary == "sampled");
+
+					sampler.sample(t._surface, numberOfPoints, t._points);
+
+					t._segments = sampler.getSegments();
+				}
+			}
+			catch (const std::exception& xpt)
+			{
+				Fail(patch, xpt);
+			}
+
+			t._timer.Stop();
+			t._timer.AddCount("tile", tile);
+			t._timer.AddCount("points", numberOfPoints);
+		}
+
+		if (--patch._remainingTiles == 0)
+		{
+			MeshPatch(patch);
+		}
+
+		return;
+	}
+
+
+	/**
+	 * \fn void BatchMesher::MeshPatch(Patch& patch)
+	 *
+	 * \brief Merges the samples of the tiles of a patch, computes their
+	 * CDT, and writes the triangulation to a file.
+	 *
+	 * \param patch A reference to the patch.
+	 *
+	 */
+	void
+		BatchMesher::MeshPatch(
+			Patch& patch
+		)
+	{
+		if (patch._failed)
+		{
+			return;
+		}
+
+		RunBuffers& buffers = _buffers[ThreadPool::GetWorkerIndex()];
+		StageTimer& timer = patch._timer;
+
+		for (size_t t = 0; t < patch._tiles.size(); t++)
+		{
+			timer.Append(patch._tiles[t]._timer);
+		}
+
+		size_t numberOfVertices = 0;
+		size_t numberOfEdges = 0;
+		size_t numberOfTriangles = 0;
+
+		try
+		{
+			timer.Start("merge");
+			MergeTiles(patch, buffers._points);
+			timer.Stop();
+			timer.AddCount("points", buffers._points.size());
+
+			timer.Start("cdt");
+
+			cdt::CDT::MetricField metric;
+
+			if (patch._options._metric == "surface")
+			{
+				const spSurface& surface = patch._surface;
+
+				metric = [&surface](double u, double v, double& e, double& f, double& g)
+				{
+					surface->GetFirstFundamentalForm(u, v, e, f, g);
+				};
+			}
+
+			cdt::CDT::BoundaryMode boundary = (patch._options._boundary == "ghost") ?
+				cdt::CDT::BoundaryMode::GhostVertex :
+				cdt::CDT::BoundaryMode::EnclosingTriangle;
+
+			// The samples of a patch whose sides are sampled first are
+			// those of its only tile, in the same order, so the segments
+			// of the tile are those of the patch.
+			const std::vector<size_t>& segments = patch._tiles.front()._segments;
+
+			std::unique_ptr<cdt::CDT> myCdt(
+				segments.empty() ?
+				new cdt::CDT(buffers._points.size(), buffers._points, metric, boundary) :
+				new cdt::CDT(buffers._points.size(), segments.size() / 2, buffers._points, segments, boundary)
+			);
+
+			timer.Stop();
+
+			// Patches are meshed concurrently, so the relaxation of
+			// each one runs on the thread of its patch.
+			if (patch._options._lloyd > 0)
+			{
+				timer.Start("lloyd");
+
+				LloydRelaxer relaxer(patch._surface, 1);
+
+				size_t numberOfMoves = relaxer.Relax(*myCdt, patch._options._lloyd);
+
+				timer.Stop();
+				timer.AddCount("lloyd_moves", numberOfMoves);
+			}
+
+			if ((patch._options._minAngle > 0) || (patch._options._maxArea > 0))
+			{
+				timer.Start("refine");
+
+				const spSurface& surface = patch._surface;
+
+				size_t numberOfSteinerPoints = myCdt->Refine(
+					patch._options._minAngle,
+					patch._options._maxArea,
+					0,
+					[&surface](double u, double v) -> spPoint
+					{
+						SamplePoint::Point pos;
+						surface->GetPoint(u, v, pos._x, pos._y, pos._z);
+
+						return std::make_shared<SamplePoint>(SamplePoint(u, v, pos));
+					}
+				);
+
+				timer.Stop();
+				timer.AddCount("steiner_points", numberOfSteinerPoints);
+			}
+
+			timer.Start("visitor");
+
+			// The size of the final triangulation goes with the stage
+			// that always follows it, whichever stages built it.
+			timer.AddCount("cdt_vertices", myCdt->GetNumberOfVertices());
+			timer.AddCount("cdt_edges", myCdt->GetNumberOfEdges());
+			timer.AddCount("cdt_faces", myCdt->GetNumberOfFaces());
+			timer.AddCount("cdt_flips", myCdt->GetNumberOfSwaps());
+
+			// Of a patch bounded by segments, only the region they
+			// bound is collected.
+			if (segments.empty())
+			{
+				cdt::FaceVisitor visitor;
+				visitor.Visit(
+					*myCdt,
+					numberOfTriangles,
+					buffers._triangles,
+					numberOfEdges,
+					buffers._edges,
+					buffers._edgeType,
+					numberOfVertices,
+					buffers._vertices
+				);
+			}
+			else
+			{
+				std::vector<cdt::TriangulationVisitor::EdgeType> edgeType;
+
+				cdt::TriangulationVisitor visitor;
+				visitor.Visit(
+					*myCdt,
+					numberOfTriangles,
+					buffers._triangles,
+					numberOfEdges,
+					buffers._edges,
+					edgeType,
+					numberOfVertices,
+					buffers._vertices
+				);
+			}
+
+			timer.Stop();
+			timer.AddCount("triangles", numberOfTriangles);
+			timer.AddCount("vertices", numberOfVertices);
+
+			timer.Start("write");
+
+			// DriverOptions::Check() has already made sure the extension is .vtk.
+			const std::string& output = patch._options._output;
+
+			WritePatch(
+				output.substr(0, output.size() - 3) + "off",
+				numberOfTriangles,
+				buffers._triangles,
+				numberOfVertices,
+				buffers._vertices,
+				patch._options._format == "stoff"
+			);
+
+			timer.Stop();
+			timer.AddCount("triangles", numberOfTriangles);
+
+			timer.Start("teardown");
+		}
+		catch (const std::exception& xpt)
+		{
+			Fail(patch, xpt);
+		}
+
+		// The arrays keep their capacity for the next patch of this worker.
+		buffers._vertices.clear();
+		buffers._triangles.clear();
+		buffers._edges.clear();
+		buffers._edgeType.clear();
+		buffers._points.clear();
+
+		if (patch._failed)
+		{
+			return;
+		}
+
+		timer.Stop();
+
+		std::lock_guard<std::mutex> lock(_outputMutex);
+
+		std::cout	<< "Patch "
+					<< (patch._index + 1)
+					<< " of "
+					<< _numberOfPatches
+					<< ": "
+					<< patch._options._output
+					<< " ("
+					<< patch._tiles.size()
+					<< " tiles, "
+					<< numberOfVertices
+					<< " vertices, "
+					<< numberOfTriangles
+					<< " triangles)"
+					<< std::endl;
+		std::cout.flush();
+
+		// Report the measurements of each stage.
+		const std::string& report = patch._options._report;
+
+		if (!report.empty())
+		{
+			if (report == "-")
+			{
+				timer.WriteJson(std::cout);
+			}
+			else
+			{
+				std::ofstream os(report.c_str(), std::ios::app);
+
+				if (!os.is_open())
+				{
+					std::cerr << "ERROR: report file cannot be opened." << std::endl;
+					++_numberOfFailures;
+					return;
+				}
+
+				timer.WriteJson(os);
+			}
+		}
+
+		return;
+	}
+
+
+	/**
+	 * \fn void BatchMesher::MergeTiles(Patch& patch, std::vector<spPoint>& points)
+	 *
+	 * \brief Gathers the samples of all tiles of a patch, dropping the
+	 * samples that conflict with a sample of a neighbouring tile
+	 * gathered before.
+	 *
+	 * \param patch A reference to the patch.
+	 * \param points A reference to the merged sample points.
+	 *
+	 */
+	void
+		BatchMesher::MergeTiles(
+			Patch& patch,
+			std::vector<spPoint>& points
+		)
+	{
+		const size_t nu = patch._numberOfTilesU;
+		const size_t nv = patch._numberOfTilesV;
+		const double band = patch._band;
+		const double alpha = patch._options._alpha;
+
+		points.clear();
+
+		// Indices (into points) of the merged samples of each tile lying
+		// within band of the tile border.  Only those can conflict with
+		// samples of the neighbouring tiles.
+		std::vector< std::vector<size_t> > border(patch._tiles.size());
+
+		for (size_t j = 0; j < nv; j++)
+		{
+			for (size_t i = 0; i < nu; i++)
+			{
+				Tile& tile = patch._tiles[j * nu + i];
+				const Surface& s = *tile._surface;
+
+				for (size_t k = 0; k < tile._points.size(); k++)
+				{
+					const spPoint& p = tile._points[k];
+
+					bool nearBorder =
+						(p->GetU() - s.GetUMin() < band) || (s.GetUMax() - p->GetU() < band) ||
+						(p->GetV() - s.GetVMin() < band) || (s.GetVMax() - p->GetV() < band);
+
+					if (nearBorder)
+					{
+						const SamplePoint& sp = static_cast<const SamplePoint&>(*p);
+
+						bool conflicted = false;
+
+						// Check the neighbouring tiles merged before this one.
+						for (size_t jj = (j > 0) ? j - 1 : 0; (jj <= j + 1) && (jj < nv) && !conflicted; jj++)
+						{
+							for (size_t ii = (i > 0) ? i - 1 : 0; (ii <= i + 1) && (ii < nu) && !conflicted; ii++)
+							{
+								if (jj * nu + ii >= j * nu + i)
+								{
+									continue;
+								}
+
+								const std::vector<size_t>& candidates = border[jj * nu + ii];
+
+								for (size_t c = 0; (c < candidates.size()) && !conflicted; c++)
+								{
+									const SamplePoint& q = static_cast<const SamplePoint&>(*points[candidates[c]]);
+
+									if (
+										(fabs(q.GetU() - sp.GetU()) < band) &&
+										(fabs(q.GetV() - sp.GetV()) < band) &&
+										Conflict(*patch._surface, sp, q, alpha)
+									   )
+									{
+										conflicted = true;
+									}
+								}
+							}
+						}
+
+						if (conflicted)
+						{
+							continue;
+						}
+
+						border[j * nu + i].push_back(points.size());
+					}
+
+					points.push_back(p);
+				}
+
+				// Release the tile samples; the merged array shares them.
+				std::vector<spPoint>().swap(tile._points);
+			}
+		}
+
+		return;
+	}
+
+
+	/**
+	 * \fn void BatchMesher::Fail(Patch& patch, const std::exception& xpt)
+	 *
+	 * \brief Reports an error that prevents a patch from being meshed.
+	 *
+	 * \param patch A reference to the patch.
+	 * \param xpt The error.
+	 *
+	 */
+	void
+		BatchMesher::Fail(
+			Patch& patch,
+			const std::exception& xpt
+		)
+	{
+		// Report each failed patch once.
+		if (patch._failed.exchange(true))
+		{
+			return;
+		}
+
+		++_numberOfFailures;
+
+		std::lock_guard<std::mutex> lock(_outputMutex);
+
+		std::cerr	<< "ERROR: patch "
+					<< (patch._index + 1)
+					<< " ("
+					<< patch._options._output
+					<< "): "
+					<< xpt.what()
+					<< std::endl;
+	}
+
+
+	/**
+	 * \fn bool BatchMesher::Conflict(const Surface& surface, const SamplePoint& p, const SamplePoint& q, double alpha)
+	 *
+	 * \brief Decides whether two samples are closer than allowed.
+	 *
+	 * \param surface The surface.
+	 * \param p A sample point.
+	 * \param q Another sample point.
+	 * \param alpha The Poisson disk radius.
+	 *
+	 * \return True if the samples are closer than 2 alpha.
+	 *
+	 */
+	bool
+		BatchMesher::Conflict(
+			const Surface& surface,
+			const SamplePoint& p,
+			const SamplePoint& q,
+			double alpha
+		)
+	{
+		double du = q.GetU() - p.GetU();
+		double dv = q.GetV() - p.GetV();
+
+		const SamplePoint* at[2] = { &p, &q };
+
+		for (size_t i = 0; i < 2; i++)
+		{
+			double xu, yu, zu;
+			double xv, yv, zv;
+
+			surface.GetDu(at[i]->GetU(), at[i]->GetV(), xu, yu, zu);
+			surface.GetDv(at[i]->GetU(), at[i]->GetV(), xv, yv, zv);
+
+			double x = xu * du + xv * dv;
+			double y = yu * du + yv * dv;
+			double z = zu * du + zv * dv;
+
+			if (x * x + y * y + z * z < 4 * alpha * alpha)
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+
+	/**
+	 * \fn void BatchMesher::WritePatch(const std::string& filename, size_t numberOfTriangles, const std::vector<size_t>& triangles, size_t numberOfVertices, const std::vector<spPoint>& vertices, bool withParameters)
+	 *
+	 * \brief Writes the triangulation of a patch to an OFF file.
+	 *
+	 * \param filename The name of a file to be written to.
+	 * \param numberOfTriangles Total number of triangles of the CDT.
+	 * \param triangles An array with vertex indices of all triangles.
+	 * \param numberOfVertices Total number of vertices of the CDT.
+	 * \param vertices An array with all vertices of the CDT.
+	 * \param withParameters A flag to indicate whether an STOFF file,
+	 * with the parameter coordinates of the vertices, is written.
+	 *
+	 */
+	void
+		BatchMesher::WritePatch(
+			const std::string& filename,
+			size_t numberOfTriangles,
+			const std::vector<size_t>& triangles,
+			size_t numberOfVertices,
+			const std::vector<spPoint>& vertices,
+			bool withParameters
+		)
+	{
+		OffWriter ou;
+
+		ou.Open(filename, numberOfVertices, numberOfTriangles, withParameters);
+
+		for (size_t i = 0; i < numberOfVertices; i++)
+		{
+			spSamplePoint p = std::dynamic_pointer_cast<SamplePoint>(vertices[i]);
+
+			if (p == nullptr)
+			{
+				throw std::runtime_error("Failed to dynamically cast a shared pointer.");
+			}
+
+			if (withParameters)
+			{
+				ou.WriteVertex(
+					p->GetPosition()._x,
+					p->GetPosition()._y,
+					p->GetPosition()._z,
+					p->GetU(),
+					p->GetV()
+				);
+			}
+			else
+			{
+				ou.WriteVertex(
+					p->GetPosition()._x,
+					p->GetPosition()._y,
+					p->GetPosition()._z
+				);
+			}
+		}
+
+		for (size_t i = 0; i < numberOfTriangles; i++)
+		{
+			ou.WriteTriangle(
+				triangles[3 * i],
+				triangles[3 * i + 1],
+				triangles[3 * i + 2]
+			);
+		}
+
+		ou.Close();
+
+		return;
+	}
+
+}
+
+/** @} */ //end of group class.
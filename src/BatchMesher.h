@@ -0,0 +1,362 @@
+/**
+ * \file BatchMesher.h
+ *
+ * \brief This  file contains the  definition of a class  that meshes a
+ * list of surface patches concurrently on a work-stealing thread pool.
+ *
+ * \author
+ * Adelino Afonso e Irene Ginani \n
+ * Universidade Federal do Rio Grande do Norte, \n
+ * Instituto Metr&oacute;pole Digital, \n
+ * Adelino Afonso at imd (dot) ufrn (dot) br, \n
+ * Irene Ginani at imd (dot) ufrn (dot) br
+ *
+ * \version 1.0
+ * \date October 2026
+ *
+ * \attention This program is distributed WITHOUT ANY WARRANTY, and it
+ *            may be freely redistributed under the condition that the
+ *            copyright notices  are not removed,  and no compensation
+ *            is received. Private, research, and institutional use is
+ *            free. Distribution of this  code as part of a commercial
+ *            system  is permissible ONLY  BY DIRECT  ARRANGEMENT WITH
+ *            THE AUTHOR.
+ */
+
+#pragma once
+
+#include "Surface.h"               // Surface
+#include "SamplePoint.h"           // SamplePoint
+#include "DtPoint.h"               // cdt::DtPoint
+#include "StageTimer.h"            // StageTimer
+#include "SurfaceRegistry.h"       // SurfaceRegistry
+#include "DriverOptions.h"         // DriverOptions
+#include "RunBuffers.h"            // RunBuffers
+#include "../common/ThreadPool.h"  // ThreadPool
+
+#include <atomic>                  // std::atomic
+#include <memory>                  // std::shared_ptr, std::unique_ptr
+#include <mutex>                   // std::mutex
+#include <string>                  // std::string
+#include <vector>                  // std::vector
+#include <exception>               // std::exception
+
+
+/**
+ * \defgroup MAT309NameSpace Namespace MAT309.
+ * @{
+ */
+
+/**
+ * \namespace MAT309
+ *
+ * \brief Global namespace for MAT309 software.
+ *
+ */
+
+namespace MAT309
+{
+
+	/**
+	 * \class BatchMesher
+	 *
+	 * \brief This class meshes a list of surface patches concurrently.
+	 * Each patch goes through sample, CDT, extract, and write, as in a
+	 * single run of the driver, and is written to its own file.
+	 *
+	 * A patch whose expected number of sample points exceeds a given
+	 * limit is split into a grid of tiles that are sampled as separate
+	 * tasks.  The tile samples are then merged,  dropping the points
+	 * that violate the Poisson disk condition across tile borders, and
+	 * triangulated as a single patch, so the output mesh of a patch is
+	 * conforming whether or not it was split.
+	 *
+	 * Every worker thread owns its sampler and arrays (RunBuffers), so
+	 * tasks never share mutable state besides their own patch.
+	 *
+	 */
+	class BatchMesher
+	{
+	public:
+
+		// -----------------------------------------------------------
+		//
+		// Type definitions
+		//
+		// -----------------------------------------------------------
+
+		/**
+		 * \typedef spPoint
+		 *
+		 * \brief Alias for a shared pointer to DtPoint objects.
+		 *
+		 */
+		typedef cdt::DtPoint::spPoint spPoint;
+
+
+		/**
+		 * \typedef spSamplePoint
+		 *
+		 * \brief Alias for a shared pointer to SamplePoint objects.
+		 *
+		 */
+		typedef SamplePoint::spSamplePoint spSamplePoint;
+
+
+		/**
+		 * \typedef spSurface
+		 *
+		 * \brief Alias for a shared pointer to Surface objects.
+		 *
+		 */
+		typedef std::shared_ptr<Surface> spSurface;
+
+
+	private:
+
+		/**
+		 * \struct Tile
+		 *
+		 * \brief This struct holds a tile of a patch and its samples.
+		 *
+		 */
+		struct Tile
+		{
+			spSurface _surface;              ///< The restriction of the patch surface to the tile.
+			unsigned _seed;                  ///< Seed of the sampler for this tile.
+			std::vector<spPoint> _points;    ///< The sample points of the tile.
+			std::vector<size_t> _segments;   ///< The indices of the two samples of each boundary segment of the tile.
+			StageTimer _timer;               ///< Measurements of the sampling of the tile.
+
+			Tile() : _seed(0), _timer(true)
+			{
+			}
+		};
+
+
+		/**
+		 * \struct Patch
+		 *
+		 * \brief This struct holds a patch and the state of its meshing.
+		 *
+		 */
+		struct Patch
+		{
+			size_t _index;                          ///< Position of the patch in the batch.
+			DriverOptions _options;                 ///< Settings of the patch.
+			spSurface _surface;                     ///< The surface of the patch.
+			size_t _numberOfTilesU;                 ///< Number of tiles along the first parameter.
+			size_t _numberOfTilesV;                 ///< Number of tiles along the second parameter.
+			double _band;                           ///< Parameter distance beyond which two samples cannot conflict.
+			std::vector<Tile> _tiles;               ///< The tiles of the patch, row by row.
+			std::atomic<size_t> _remainingTiles;    ///< Number of tiles still being sampled.
+			std::atomic<bool> _failed;              ///< A flag to indicate whether a task of this patch failed.
+			StageTimer _timer;                      ///< Measurements of the patch.
+
+			Patch() : _index(0), _numberOfTilesU(1), _numberOfTilesV(1), _band(0), _remainingTiles(0), _failed(false), _timer(true)
+			{
+			}
+		};
+
+
+		// -----------------------------------------------------------
+		//
+		// Private data members
+		//
+		// -----------------------------------------------------------
+
+		const SurfaceRegistry& _registry;           ///< The registry of surfaces.
+		ThreadPool _pool;                           ///< The worker threads.
+		std::vector<RunBuffers> _buffers;           ///< The sampler and arrays of each worker.
+		std::mutex _outputMutex;                    ///< A mutex serializing console and report output.
+		std::atomic<size_t> _numberOfFailures;      ///< Number of patches that could not be meshed.
+		size_t _numberOfPatches;                    ///< Number of patches of the current batch.
+
+
+	public:
+
+		// -----------------------------------------------------------
+		//
+		// Public methods
+		//
+		// -----------------------------------------------------------
+
+		/**
+		 * \fn BatchMesher(const SurfaceRegistry& registry, size_t numberOfThreads = 0)
+		 *
+		 * \brief Creates an instance of this class and starts its
+		 * worker threads.
+		 *
+		 * \param registry The registry of surfaces.
+		 * \param numberOfThreads The number of worker threads (0 means
+		 * one per hardware thread).
+		 *
+		 */
+		BatchMesher(
+			const SurfaceRegistry& registry,
+			size_t numberOfThreads = 0
+		);
+
+
+		/**
+		 * \fn int Run(const std::vector<DriverOptions>& patches)
+		 *
+		 * \brief Meshes a list of patches and waits until all of them are
+		 * written.
+		 *
+		 * \param patches The settings of each patch.
+		 *
+		 * \return EXIT_SUCCESS, or EXIT_FAILURE if any patch failed.
+		 *
+		 */
+		int
+			Run(
+				const std::vector<DriverOptions>& patches
+			);
+
+
+	private:
+
+		// -----------------------------------------------------------
+		//
+		// Private methods
+		//
+		// -----------------------------------------------------------
+
+		/**
+		 * \fn void Plan(Patch& patch)
+		 *
+		 * \brief Creates the surface of a patch, splits it into tiles,
+		 * and submits one sampling task per tile.
+		 *
+		 * \param patch A reference to the patch.
+		 *
+		 */
+		void
+			Plan(
+				Patch& patch
+			);
+
+
+		/**
+		 * \fn void SampleTile(Patch& patch, size_t tile)
+		 *
+		 * \brief Samples a tile of a patch.  The task sampling the last
+		 * tile of a patch goes on to mesh the patch.
+		 *
+		 * \param patch A reference to the patch.
+		 * \param tile The index of the tile.
+		 *
+		 */
+		void
+			SampleTile(
+				Patch& patch,
+				size_t tile
+			);
+
+
+		/**
+		 * \fn void MeshPatch(Patch& patch)
+		 *
+		 * \brief Merges the samples of the tiles of a patch, computes
+		 * their CDT, and writes the triangulation to a file.
+		 *
+		 * \param patch A reference to the patch.
+		 *
+		 */
+		void
+			MeshPatch(
+				Patch& patch
+			);
+
+
+		/**
+		 * \fn void MergeTiles(Patch& patch, std::vector<spPoint>& points)
+		 *
+		 * \brief Gathers the samples of all tiles of a patch, dropping
+		 * the samples that conflict with a sample of a neighbouring tile
+		 * gathered before.
+		 *
+		 * \param patch A reference to the patch.
+		 * \param points A reference to the merged sample points.
+		 *
+		 */
+		void
+			MergeTiles(
+				Patch& patch,
+				std::vector<spPoint>& points
+			);
+
+
+		/**
+		 * \fn void Fail(Patch& patch, const std::exception& xpt)
+		 *
+		 * \brief Reports an error that prevents a patch from being
+		 * meshed.
+		 *
+		 * \param patch A reference to the patch.
+		 * \param xpt The error.
+		 *
+		 */
+		void
+			Fail(
+				Patch& patch,
+				const std::exception& xpt
+			);
+
+
+		/**
+		 * \fn static bool Conflict(const Surface& surface, const SamplePoint& p, const SamplePoint& q, double alpha)
+		 *
+		 * \brief Decides whether two samples are closer than allowed,
+		 * using the same distance as the sampler:  the length of their
+		 * parameter difference in the first fundamental form at either
+		 * sample.
+		 *
+		 * \param surface The surface.
+		 * \param p A sample point.
+		 * \param q Another sample point.
+		 * \param alpha The Poisson disk radius.
+		 *
+		 * \return True if the samples are closer than 2 alpha.
+		 *
+		 */
+		static
+		bool
+			Conflict(
+				const Surface& surface,
+				const SamplePoint& p,
+				const SamplePoint& q,
+				double alpha
+			);
+
+
+		/**
+		 * \fn static void WritePatch(const std::string& filename, size_t numberOfTriangles, const std::vector<size_t>& triangles, size_t numberOfVertices, const std::vector<spPoint>& vertices, bool withParameters)
+		 *
+		 * \brief Writes the triangulation of a patch to an OFF file.
+		 *
+		 * \param filename The name of a file to be written to.
+		 * \param numberOfTriangles Total number of triangles of the CDT.
+		 * \param triangles An array with vertex indices of all triangles.
+		 * \param numberOfVertices Total number of vertices of the CDT.
+		 * \param vertices An array with all vertices of the CDT.
+		 * \param withParameters A flag to indicate whether an STOFF file,
+		 * with the parameter coordinates of the vertices, is written.
+		 *
+		 */
+		static
+		void
+			WritePatch(
+				const std::string& filename,
+				size_t numberOfTriangles,
+				const std::vector<size_t>& triangles,
+				size_t numberOfVertices,
+				const std::vector<spPoint>& vertices,
+				bool withParameters
+			);
+	};
+
+}
+
+/** @} */ //end of group class.
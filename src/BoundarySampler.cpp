@@ -0,0 +1,235 @@
+/**
+ * \file BoundarySampler.cpp
+ *
+ * \brief Implementation of the class BoundarySampler, which samples the
+ * boundary curves of a surface patch at a fixed spacing on the surface.
+ *
+ * \author
+ * Adelino Afonso e Irene Ginani \n
+ * Universidade Federal do Rio Grande do Norte, \n
+ * Instituto Metr&oacute;pole Digital, \n
+ * Adelino Afonso at imd (dot) ufrn (dot) br, \n
+ * Irene Ginani at imd (dot) ufrn (dot) br
+ *
+ * \version 1.0
+ * \date October 2026
+ *
+ * \attention This program is distributed WITHOUT ANY WARRANTY, and it
+ *            may be freely redistributed under the condition that the
+ *            copyright notices  are not removed,  and no compensation
+ *            is received. Private, research, and institutional use is
+ *            free. Distribution of this  code as part of a commercial
+ *            system  is permissible ONLY  BY DIRECT  ARRANGEMENT WITH
+ *            THE AUTHOR.
+ */
+
+#include "BoundarySampler.h"     // BoundarySampler
+#include "SamplePoint.h"         // SamplePoint
+
+#include <algorithm>             // std::max
+#include <cmath>                 // sqrt, ceil
+#include <stdexcept>             // std::runtime_error
+
+
+/**
+ * \defgroup MAT309NameSpace Namespace MAT309.
+ * @{
+ */
+
+/**
+ * \namespace MAT309
+ *
+ * \brief Global namespace for MAT309 software.
+ */
+
+namespace MAT309
+{
+
+	/**
+	 * \fn void BoundarySampler::SampleDomain(std::vector<spPoint>& points, std::vector<size_t>& segments) const
+	 *
+	 * \brief Samples the boundary of the parameter domain of the surface,
+	 * from its lower left corner counterclockwise.
+	 *
+	 * \param points A reference to an array to which the samples are
+	 * appended.
+	 * \param segments A reference to an array to which the indices of
+	 * the two samples of each segment are appended.
+	 *
+	 */
+	void
+		BoundarySampler::SampleDomain(
+			std::vector<spPoint>& points,
+			std::vector<size_t>& segments
+		)
+		const
+	{
+		const double umin = _surface->GetUMin();
+		const double umax = _surface->GetUMax();
+		const double vmin = _surface->GetVMin();
+		const double vmax = _surface->GetVMax();
+
+		std::vector<double> corners = {
+			umin, vmin,
+			umax, vmin,
+			umax, vmax,
+			umin, vmax
+		};
+
+		SampleLoop(corners, points, segments);
+
+		return;
+	}
+
+
+	/**
+	 * \fn void BoundarySampler::SampleLoop(const std::vector<double>& corners, std::vector<spPoint>& points, std::vector<size_t>& segments) const
+	 *
+	 * \brief Samples a closed polygon of the parameter domain.
+	 *
+	 * \param corners The u and v coordinates of each corner of the
+	 * polygon, in order.
+	 * \param points A reference to an array to which the samples are
+	 * appended.
+	 * \param segments A reference to an array to which the indices of
+	 * the two samples of each segment are appended.
+	 *
+	 */
+	void
+		BoundarySampler::SampleLoop(
+			const std::vector<double>& corners,
+			std::vector<spPoint>& points,
+			std::vector<size_t>& segments
+		)
+		const
+	{
+		if (_spacing <= 0)
+		{
+			throw std::runtime_error("The spacing of the boundary samples must be positive.");
+		}
+
+		const size_t numberOfCorners = corners.size() / 2;
+
+		size_t firstSample = points.size();
+
+		for (size_t i = 0; i < numberOfCorners; i++)
+		{
+			size_t j = (i + 1 < numberOfCorners) ? i + 1 : 0;
+
+			SampleSide(corners[2 * i], corners[2 * i + 1], corners[2 * j], corners[2 * j + 1], points);
+		}
+
+		size_t lastSample = points.size();
+
+		for (size_t k = firstSample; k < lastSample; k++)
+		{
+			segments.push_back(k);
+			segments.push_back((k + 1 < lastSample) ? k + 1 : firstSample);
+		}
+
+		return;
+	}
+
+
+	/**
+	 * \fn void BoundarySampler::SampleSide(double au, double av, double bu, double bv, std::vector<spPoint>& points) const
+	 *
+	 * \brief Samples a side of a polygon, appending its first end and
+	 * the samples inside it, but not its last end.
+	 *
+	 * \param au The first coordinate of the first end of the side.
+	 * \param av The second coordinate of the first end of the side.
+	 * \param bu The first coordinate of the last end of the side.
+	 * \param bv The second coordinate of the last end of the side.
+	 * \param points A reference to an array to which the samples are
+	 * appended.
+	 *
+	 */
+	void
+		BoundarySampler::SampleSide(
+			double au,
+			double av,
+			double bu,
+			double bv,
+			std::vector<spPoint>& points
+		)
+		const
+	{
+		SamplePoint::Point pos;
+
+		_surface->GetPoint(au, av, pos._x, pos._y, pos._z);
+		points.push_back(std::make_shared<SamplePoint>(SamplePoint(au, av, pos)));
+
+		// Walk the side from its lesser end, so that the patch on the
+		// other side of it gets the same samples.
+		const bool reversed = (bu < au) || ((bu == au) && (bv < av));
+
+		const double su = reversed ? bu : au;
+		const double sv = reversed ? bv : av;
+		const double eu = reversed ? au : bu;
+		const double ev = reversed ? av : bv;
+
+		// The length on the surface from the start of the side to the
+		// end of each step.
+		std::vector<double> lengths(_steps + 1);
+
+		SamplePoint::Point previous;
+		_surface->GetPoint(su, sv, previous._x, previous._y, previous._z);
+
+		lengths[0] = 0;
+
+		for (size_t s = 1; s <= _steps; s++)
+		{
+			double w = double(s) / _steps;
+
+			SamplePoint::Point next;
+			_surface->GetPoint(su + w * (eu - su), sv + w * (ev - sv), next._x, next._y, next._z);
+
+			double dx = next._x - previous._x;
+			double dy = next._y - previous._y;
+			double dz = next._z - previous._z;
+
+			lengths[s] = lengths[s - 1] + sqrt(dx * dx + dy * dy + dz * dz);
+			previous = next;
+		}
+
+		const double length = lengths[_steps];
+		const size_t pieces = std::max(size_t(1), size_t(ceil(length / _spacing)));
+
+		// The parameter of each sample inside the side, at equal
+		// lengths from each other along the chords.
+		std::vector<double> parameters(pieces - 1);
+
+		size_t s = 1;
+
+		for (size_t k = 1; k < pieces; k++)
+		{
+			double target = length * k / pieces;
+
+			while (lengths[s] < target)
+			{
+				s++;
+			}
+
+			double step = lengths[s] - lengths[s - 1];
+			double t = (step > 0) ? (target - lengths[s - 1]) / step : 0;
+
+			parameters[k - 1] = (s - 1 + t) / _steps;
+		}
+
+		for (size_t k = 0; k + 1 < pieces; k++)
+		{
+			double w = reversed ? parameters[pieces - 2 - k] : parameters[k];
+			double u = su + w * (eu - su);
+			double v = sv + w * (ev - sv);
+
+			_surface->GetPoint(u, v, pos._x, pos._y, pos._z);
+			points.push_back(std::make_shared<SamplePoint>(SamplePoint(u, v, pos)));
+		}
+
+		return;
+	}
+
+}
+
+/** @} */ //end of group class.
@@ -0,0 +1,218 @@
+/**
+ * \file BoundarySampler.h
+ *
+ * \brief This file contains the definition of a class that samples the
+ * boundary curves of a surface patch at a fixed spacing on the surface.
+ *
+ * \author
+ * Adelino Afonso e Irene Ginani \n
+ * Universidade Federal do Rio Grande do Norte, \n
+ * Instituto Metr&oacute;pole Digital, \n
+ * Adelino Afonso at imd (dot) ufrn (dot) br, \n
+ * Irene Ginani at imd (dot) ufrn (dot) br
+ *
+ * \version 1.0
+ * \date October 2026
+ *
+ * \attention This program is distributed WITHOUT ANY WARRANTY, and it
+ *            may be freely redistributed under the condition that the
+ *            copyright notices  are not removed,  and no compensation
+ *            is received. Private, research, and institutional use is
+ *            free. Distribution of this  code as part of a commercial
+ *            system  is permissible ONLY  BY DIRECT  ARRANGEMENT WITH
+ *            THE AUTHOR.
+ */
+
+#pragma once
+
+#include "Surface.h"           // Surface
+#include "DtPoint.h"           // cdt::DtPoint
+
+#include <memory>              // std::shared_ptr
+#include <vector>              // std::vector
+
+
+/**
+ * \defgroup MAT309NameSpace Namespace MAT309.
+ * @{
+ */
+
+/**
+ * \namespace MAT309
+ *
+ * \brief Global namespace for MAT309 software.
+ *
+ */
+
+namespace MAT309
+{
+
+	/**
+	 * \class BoundarySampler
+	 *
+	 * \brief This class samples closed polygons of the parameter domain
+	 * of a surface, such as the boundary of the domain or the trimming
+	 * curves of a patch, and emits the pieces between consecutive
+	 * samples as segments for the CDT of a set of points and segments.
+	 *
+	 * Each side of a polygon is split into pieces of equal length on
+	 * the surface, as few as keep them no longer than the spacing.  The
+	 * length is measured along the chords of a fixed number of steps of
+	 * the side.  A side is always sampled from the lesser of its ends,
+	 * in the order of their coordinates, so the samples of a side two
+	 * patches share are the same, bit for bit, in both patches, and
+	 * their meshes can be stitched without meshing the side again.
+	 *
+	 */
+	class BoundarySampler
+	{
+	public:
+
+		// -----------------------------------------------------------
+		//
+		// Type definitions
+		//
+		// -----------------------------------------------------------
+
+		/**
+		 * \typedef spPoint
+		 *
+		 * \brief Alias for a shared pointer to DtPoint objects.
+		 *
+		 */
+		typedef cdt::DtPoint::spPoint spPoint;
+
+
+		/**
+		 * \typedef spSurface
+		 *
+		 * \brief Alias for a shared pointer to a surface.
+		 *
+		 */
+		typedef std::shared_ptr<Surface> spSurface;
+
+
+	private:
+
+		// -----------------------------------------------------------
+		//
+		// Private data members
+		//
+		// -----------------------------------------------------------
+
+		spSurface _surface;        ///< The surface whose domain is sampled.
+		double _spacing;           ///< The largest length of a piece on the surface.
+		size_t _steps;             ///< The number of chords measuring the length of a side.
+
+
+	public:
+
+		// -----------------------------------------------------------
+		//
+		// Public methods
+		//
+		// -----------------------------------------------------------
+
+		/**
+		 * \fn BoundarySampler(const spSurface& surface, double spacing, size_t steps = 64)
+		 *
+		 * \brief Creates an instance of this class.
+		 *
+		 * \param surface The surface whose domain is sampled.
+		 * \param spacing The largest length of a piece on the surface.
+		 * \param steps The number of chords measuring the length of a
+		 * side.
+		 *
+		 */
+		BoundarySampler(
+			const spSurface& surface,
+			double spacing,
+			size_t steps = 64
+		)
+			:
+			_surface(surface),
+			_spacing(spacing),
+			_steps(steps)
+		{
+		}
+
+
+		/**
+		 * \fn void SampleDomain(std::vector<spPoint>& points, std::vector<size_t>& segments) const
+		 *
+		 * \brief Samples the boundary of the parameter domain of the
+		 * surface, from its lower left corner counterclockwise.
+		 *
+		 * \param points A reference to an array to which the samples
+		 * are appended.
+		 * \param segments A reference to an array to which the indices
+		 * of the two samples of each segment are appended.
+		 *
+		 */
+		void
+			SampleDomain(
+				std::vector<spPoint>& points,
+				std::vector<size_t>& segments
+			)
+			const;
+
+
+		/**
+		 * \fn void SampleLoop(const std::vector<double>& corners, std::vector<spPoint>& points, std::vector<size_t>& segments) const
+		 *
+		 * \brief Samples a closed polygon of the parameter domain.
+		 *
+		 * \param corners The u and v coordinates of each corner of the
+		 * polygon, in order.
+		 * \param points A reference to an array to which the samples
+		 * are appended.
+		 * \param segments A reference to an array to which the indices
+		 * of the two samples of each segment are appended.
+		 *
+		 */
+		void
+			SampleLoop(
+				const std::vector<double>& corners,
+				std::vector<spPoint>& points,
+				std::vector<size_t>& segments
+			)
+			const;
+
+
+	private:
+
+		// -----------------------------------------------------------
+		//
+		// Private methods
+		//
+		// -----------------------------------------------------------
+
+		/**
+		 * \fn void SampleSide(double au, double av, double bu, double bv, std::vector<spPoint>& points) const
+		 *
+		 * \brief Samples a side of a polygon, appending its first end
+		 * and the samples inside it, but not its last end, which is the
+		 * first end of the next side.
+		 *
+		 * \param au The first coordinate of the first end of the side.
+		 * \param av The second coordinate of the first end of the side.
+		 * \param bu The first coordinate of the last end of the side.
+		 * \param bv The second coordinate of the last end of the side.
+		 * \param points A reference to an array to which the samples
+		 * are appended.
+		 *
+		 */
+		void
+			SampleSide(
+				double au,
+				double av,
+				double bu,
+				double bv,
+				std::vector<spPoint>& points
+			)
+			const;
+	};
+
+}
+
+/** @} */ //end of group class.
@@ -161,6 +161,22 @@ namespace MAT309
 		}
 
 
+		/**
+		 * \fn bool IsPeriodicInV() const
+		 *
+		 * \brief Tells whether the surface closes up along the second
+		 * coordinate, which it does: the sides v = GetVMin() and
+		 * v = GetVMax() are the same curve.
+		 *
+		 * \return True.
+		 *
+		 */
+		bool IsPeriodicInV() const
+		{
+			return true;
+		}
+
+
 		/**
 		 * \fn void GetPoint(double u, double v, double& x, double& y, double& z) const
 		 *
@@ -187,7 +203,8 @@ namespace MAT309
 			)
 		    const
 		{
-			if ((u < GetUMin()) || (u > GetUMax()) || (v < GetVMin()) || (v > GetVMax()))
+			// The surface is periodic in v, so any v is valid.
+			if ((u < GetUMin()) || (u > GetUMax()))
 			{
 				throw std::runtime_error("The given parameter point is outside the parameter domain.");
 			}
@@ -226,7 +243,7 @@ namespace MAT309
 			)
 		    const
 		{
-			if ((u < GetUMin()) || (u > GetUMax()) || (v < GetVMin()) || (v > GetVMax()))
+			if ((u < GetUMin()) || (u > GetUMax()))
 			{
 				throw std::runtime_error("The given parameter point is outside the parameter domain.");
 			}
@@ -265,7 +282,7 @@ namespace MAT309
 			)
 		    const
 		{
-			if ((u < GetUMin()) || (u > GetUMax()) || (v < GetVMin()) || (v > GetVMax()))
+			if ((u < GetUMin()) || (u > GetUMax()))
 			{
 				throw std::runtime_error("The given parameter point is outside the parameter domain.");
 			}
@@ -0,0 +1,677 @@
+/**
+ * \file DriverOptions.cpp
+ *
+ * \brief Implementation of  the class DriverOptions,  which holds the
+ * settings of a run of the driver.
+ *
+ * \author
+ * Adelino Afonso e Irene Ginani \n
+ * Universidade Federal do Rio Grande do Norte, \n
+ * Instituto Metr&oacute;pole Digital, \n
+ * Adelino Afonso at imd (dot) ufrn (dot) br, \n
+ * Irene Ginani at imd (dot) ufrn (dot) br
+ *
+ * \version 1.0
+ * \date October 2026
+ *
+ * \attention This program is distributed WITHOUT ANY WARRANTY, and it
+ *            may be freely redistributed under the condition that the
+ *            copyright notices  are not removed,  and no compensation
+ *            is received. Private, research, and institutional use is
+ *            free. Distribution of this  code as part of a commercial
+ *            system  is permissible ONLY  BY DIRECT  ARRANGEMENT WITH
+ *            THE AUTHOR.
+ */
+
+#include "DriverOptions.h"     // DriverOptions
+
+#include <fstream>             // std::ifstream
+#include <sstream>             // std::istringstream
+#include <cstdlib>             // strtod, strtoul
+#include <stdexcept>           // std::runtime_error
+
+
+/**
+ * \defgroup MAT309NameSpace Namespace MAT309.
+ * @{
+ */
+
+/**
+ * \namespace MAT309
+ *
+ * \brief Global namespace for MAT309 software.
+ */
+
+namespace MAT309
+{
+
+	/**
+	 * \fn static std::string Trim(const std::string& s)
+	 *
+	 * \brief Removes leading and trailing white space from a string.
+	 *
+	 * \param s A string.
+	 *
+	 * \return The string without leading and trailing white space.
+	 *
+	 */
+	static
+	std::string
+		Trim(
+			const std::string& s
+		)
+	{
+		size_t first = s.find_first_not_of(" \t\r\n");
+
+		if (first == std::string::npos)
+		{
+			return "";
+		}
+
+		size_t last = s.find_last_not_of(" \t\r\n");
+
+		return s.substr(first, last - first + 1);
+	}
+
+
+	/**
+	 * \fn static double ToNumber(const std::string& name, const std::string& value)
+	 *
+	 * \brief Converts the value of a setting to a number.
+	 *
+	 * \param name The name of the setting.
+	 * \param value The value of the setting.
+	 *
+	 * \return The number.
+	 *
+	 */
+	static
+	double
+		ToNumber(
+			const std::string& name,
+			const std::string& value
+		)
+	{
+		char* tail;
+		double x = strtod(value.c_str(), &tail);
+
+		if (value.empty() || (*tail != '\0'))
+		{
+			throw std::runtime_error("Setting \"" + name + "\" expects a number, got \"" + value + "\".");
+		}
+
+		return x;
+	}
+
+
+	/**
+	 * \fn DriverOptions::DriverOptions()
+	 *
+	 * \brief Creates an instance of this class holding the default
+	 * settings.
+	 *
+	 */
+	DriverOptions::DriverOptions()
+		:
+		_surface("cylinder"),
+		_alpha(0.1),
+		_targetPoints(0),
+		_trialPoints(1000),
+		_maxError(0),
+		_minAlpha(0),
+		_numberOfSamples(0),
+		_levels(1),
+		_maxTrials(100),
+		_seed(1),
+		_numberOfThreads(0),
+		_format("off"),
+		_streamBatch(512),
+		_maxTilePoints(2000),
+		_minAngle(0),
+		_maxArea(0),
+		_metric("uv"),
+		_boundary("triangle"),
+		_patchBoundary("corners"),
+		_lloyd(0),
+		_weld(0)
+	{
+	}
+
+
+	/**
+	 * \fn void DriverOptions::Set(const std::string& name, const std::string& value)
+	 *
+	 * \brief Changes a setting.
+	 *
+	 * \param name The name of the setting.
+	 * \param value The new value of the setting.
+	 *
+	 */
+	void
+		DriverOptions::Set(
+			const std::string& name,
+			const std::string& value
+		)
+	{
+		if (name == "output")
+		{
+			_output = value;
+		}
+		else if (name == "surface")
+		{
+			_surface = value;
+		}
+		else if (name == "alpha")
+		{
+			_alpha = ToNumber(name, value);
+		}
+		else if (name == "target-points")
+		{
+			_targetPoints = size_t(ToNumber(name, value));
+		}
+		else if (name == "trial-points")
+		{
+			_trialPoints = size_t(ToNumber(name, value));
+		}
+		else if (name == "max-error")
+		{
+			_maxError = ToNumber(name, value);
+		}
+		else if (name == "min-alpha")
+		{
+			_minAlpha = ToNumber(name, value);
+		}
+		else if (name == "points")
+		{
+			_numberOfSamples = size_t(ToNumber(name, value));
+		}
+		else if (name == "levels")
+		{
+			_levels = size_t(ToNumber(name, value));
+		}
+		else if (name == "tile")
+		{
+			_tile = value;
+		}
+		else if (name == "trim")
+		{
+			_trim = value;
+		}
+		else if (name == "max-trials")
+		{
+			_maxTrials = ToNumber(name, value);
+		}
+		else if (name == "seed")
+		{
+			_seed = unsigned(ToNumber(name, value));
+		}
+		else if (name == "threads")
+		{
+			_numberOfThreads = size_t(ToNumber(name, value));
+		}
+		else if (name == "format")
+		{
+			_format = value;
+		}
+		else if (name == "load-samples")
+		{
+			_loadSamples = value;
+		}
+		else if (name == "save-samples")
+		{
+			_saveSamples = value;
+		}
+		else if (name == "compare")
+		{
+			_golden = value;
+		}
+		else if (name == "report")
+		{
+			_report = value;
+		}
+		else if (name == "stream-batch")
+		{
+			_streamBatch = size_t(ToNumber(name, value));
+		}
+		else if (name == "max-tile-points")
+		{
+			_maxTilePoints = size_t(ToNumber(name, value));
+		}
+		else if (name == "min-angle")
+		{
+			_minAngle = ToNumber(name, value);
+		}
+		else if (name == "max-area")
+		{
+			_maxArea = ToNumber(name, value);
+		}
+		else if (name == "metric")
+		{
+			_metric = value;
+		}
+		else if (name == "boundary")
+		{
+			_boundary = value;
+		}
+		else if (name == "patch-boundary")
+		{
+			_patchBoundary = value;
+		}
+		else if (name == "lloyd")
+		{
+			_lloyd = size_t(ToNumber(name, value));
+		}
+		else if (name == "weld")
+		{
+			_weld = ToNumber(name, value);
+		}
+		else if (name == "config")
+		{
+			ReadConfigFile(value);
+		}
+		else
+		{
+			throw std::runtime_error("Unknown setting \"" + name + "\".");
+		}
+
+		return;
+	}
+
+
+	/**
+	 * \fn void DriverOptions::ReadConfigFile(const std::string& filename)
+	 *
+	 * \brief Reads settings from a configuration file.
+	 *
+	 * \param filename The name of the configuration file.
+	 *
+	 */
+	void
+		DriverOptions::ReadConfigFile(
+			const std::string& filename
+		)
+	{
+		std::ifstream in(filename.c_str());
+
+		if (!in.is_open())
+		{
+			throw std::runtime_error("Configuration file \"" + filename + "\" cannot be opened.");
+		}
+
+		std::string line;
+
+		while (std::getline(in, line))
+		{
+			line = Trim(line);
+
+			if (line.empty() || (line[0] == '#'))
+			{
+				continue;
+			}
+
+			size_t eq = line.find('=');
+
+			if (eq == std::string::npos)
+			{
+				throw std::runtime_error("Configuration line \"" + line + "\" is not of the form name = value.");
+			}
+
+			Set(Trim(line.substr(0, eq)), Trim(line.substr(eq + 1)));
+		}
+
+		return;
+	}
+
+
+	/**
+	 * \fn void DriverOptions::Check() const
+	 *
+	 * \brief Makes sure the settings describe a valid run.
+	 *
+	 */
+	void DriverOptions::Check() const
+	{
+		std::string extension(".vtk");
+
+		if (
+			(_output.size() < extension.size()) ||
+			(_output.compare(_output.size() - extension.size(), extension.size(), extension) != 0)
+		   )
+		{
+			throw std::runtime_error("The output file name must have extension .vtk.");
+		}
+
+		if (_alpha <= 0)
+		{
+			throw std::runtime_error("The Poisson disk radius must be positive.");
+		}
+
+		if ((_targetPoints > 0) && (_targetPoints < 4))
+		{
+			throw std::runtime_error("The target number of sample points must be at least 4, one per corner of the domain.");
+		}
+
+		if ((_targetPoints > 0) && ((_numberOfSamples > 0) || (_maxError > 0)))
+		{
+			throw std::runtime_error("Setting target-points cannot be used with points or max-error.");
+		}
+
+		if (_maxError < 0)
+		{
+			throw std::runtime_error("The maximum error cannot be negative.");
+		}
+
+		if ((_minAlpha < 0) || (_minAlpha > _alpha))
+		{
+			throw std::runtime_error("The minimum Poisson disk radius must be between 0 and alpha.");
+		}
+
+		if ((_numberOfSamples > 0) && (_numberOfSamples < 4))
+		{
+			throw std::runtime_error("The number of sample points must be at least 4, one per corner of the domain.");
+		}
+
+		if ((_numberOfSamples > 0) && (_maxError > 0))
+		{
+			throw std::runtime_error("Settings points and max-error cannot be used together.");
+		}
+
+		if ((_levels < 1) || (_levels > 8))
+		{
+			throw std::runtime_error("The number of levels of detail must be between 1 and 8.");
+		}
+
+		if ((_levels > 1) && ((_numberOfSamples > 0) || (_maxError > 0) || !_loadSamples.empty()))
+		{
+			throw std::runtime_error("Setting levels cannot be used with points, max-error, or load-samples.");
+		}
+
+		if (!_tile.empty() && ((_numberOfSamples > 0) || (_maxError > 0) || (_levels > 1) || !_loadSamples.empty()))
+		{
+			throw std::runtime_error("Setting tile cannot be used with points, max-error, levels, or load-samples.");
+		}
+
+		if (!_trim.empty() && ((_numberOfSamples > 0) || (_maxError > 0) || (_levels > 1) || !_tile.empty() || !_loadSamples.empty()))
+		{
+			throw std::runtime_error("Setting trim cannot be used with points, max-error, levels, tile, or load-samples.");
+		}
+
+		// The CDT of a set of points and segments is Delaunay in the
+		// parameter plane.
+		if (!_trim.empty() && (_metric != "uv"))
+		{
+			throw std::runtime_error("Setting trim can only be used with the uv metric.");
+		}
+
+		// The trimming polygons bound the CDT, so there is no bounding
+		// triangle of ghost points, and the small angles the polygons
+		// make with the convex hull would make Delaunay refinement
+		// cascade.
+		if (!_trim.empty() && ((_boundary != "triangle") || (_minAngle > 0) || (_maxArea > 0)))
+		{
+			throw std::runtime_error("Setting trim can only be used with the triangle boundary, and without min-angle or max-area.");
+		}
+
+		// Refinement bounds the angles in the parameter plane, and a
+		// circumcenter there need not remove a triangle that is only
+		// Delaunay on the surface, so it may never end.
+		if (((_minAngle > 0) || (_maxArea > 0)) && (_metric != "uv"))
+		{
+			throw std::runtime_error("Settings min-angle and max-area can only be used with the uv metric.");
+		}
+
+		// A sampled boundary is bounded by segments like the trimming
+		// curves, and refinement would split the segments differently
+		// in the patches that share them.
+		if ((_patchBoundary == "sampled") && ((_numberOfSamples > 0) || (_maxError > 0) || (_levels > 1) || !_tile.empty() || !_loadSamples.empty() || !_trim.empty()))
+		{
+			throw std::runtime_error("Setting patch-boundary sampled cannot be used with points, max-error, levels, tile, load-samples, or trim.");
+		}
+
+		if ((_patchBoundary == "sampled") && ((_metric != "uv") || (_boundary != "triangle") || (_minAngle > 0) || (_maxArea > 0)))
+		{
+			throw std::runtime_error("Setting patch-boundary sampled can only be used with the uv metric and the triangle boundary, and without min-angle or max-area.");
+		}
+
+		if (_maxTrials < 1)
+		{
+			throw std::runtime_error("The number of trials must be at least 1.");
+		}
+
+		if ((_format != "off") && (_format != "stoff"))
+		{
+			throw std::runtime_error("The output format must be either off or stoff.");
+		}
+
+		// Refinement is not guaranteed to terminate beyond 20.7 degrees,
+		// and rarely does beyond 34.
+		if ((_minAngle < 0) || (_minAngle > 34))
+		{
+			throw std::runtime_error("The minimum angle must be between 0 and 34 degrees.");
+		}
+
+		if (_maxArea < 0)
+		{
+			throw std::runtime_error("The maximum triangle area cannot be negative.");
+		}
+
+		if ((_metric != "uv") && (_metric != "surface"))
+		{
+			throw std::runtime_error("The metric must be either uv or surface.");
+		}
+
+		if ((_boundary != "triangle") && (_boundary != "ghost"))
+		{
+			throw std::runtime_error("The boundary must be either triangle or ghost.");
+		}
+
+		if ((_patchBoundary != "corners") && (_patchBoundary != "sampled"))
+		{
+			throw std::runtime_error("The patch boundary must be either corners or sampled.");
+		}
+
+		if (_weld < 0)
+		{
+			throw std::runtime_error("The welding tolerance cannot be negative.");
+		}
+
+		return;
+	}
+
+
+	/**
+	 * \fn void DriverOptions::ParseCommandLine(int argc, char* argv[], std::vector<DriverOptions>& runs, bool& batch)
+	 *
+	 * \brief Reads the settings of all runs from the command line.
+	 *
+	 * \param argc The number of command-line arguments.
+	 * \param argv An array with the command-line arguments.
+	 * \param runs A reference to the settings of each run.
+	 * \param batch A reference to a flag indicating whether the runs
+	 * came from a batch file.
+	 *
+	 */
+	void
+		DriverOptions::ParseCommandLine(
+			int argc,
+			char* argv[],
+			std::vector<DriverOptions>& runs,
+			bool& batch
+		)
+	{
+		DriverOptions base;
+		std::string sweep;
+
+		batch = false;
+
+		for (int i = 1; i < argc; i++)
+		{
+			std::string arg(argv[i]);
+
+			if (arg.compare(0, 2, "--") != 0)
+			{
+				// The only positional argument is the output file.
+				if (!base._output.empty())
+				{
+					throw std::runtime_error("More than one output file was given.");
+				}
+
+				base._output = arg;
+			}
+			else if (i + 1 >= argc)
+			{
+				throw std::runtime_error("Option " + arg + " expects a value.");
+			}
+			else if ((arg == "--sweep") || (arg == "--batch"))
+			{
+				if (!sweep.empty())
+				{
+					throw std::runtime_error("Only one sweep or batch file may be given.");
+				}
+
+				sweep = argv[++i];
+				batch = (arg == "--batch");
+			}
+			else
+			{
+				base.Set(arg.substr(2), argv[++i]);
+			}
+		}
+
+		runs.clear();
+
+		if (sweep.empty())
+		{
+			runs.push_back(base);
+		}
+		else
+		{
+			ReadSweepFile(sweep, base, runs);
+		}
+
+		for (size_t i = 0; i < runs.size(); i++)
+		{
+			runs[i].Check();
+
+			if (batch && (!runs[i]._loadSamples.empty() || !runs[i]._saveSamples.empty() || !runs[i]._golden.empty() || (runs[i]._levels > 1) || !runs[i]._tile.empty() || !runs[i]._trim.empty() || (runs[i]._weld > 0)))
+			{
+				throw std::runtime_error("Settings load-samples, save-samples, compare, levels, tile, trim, and weld are not available in batch mode.");
+			}
+		}
+
+		return;
+	}
+
+
+	/**
+	 * \fn std::string DriverOptions::GetUsage()
+	 *
+	 * \brief Returns a description of the command-line arguments.
+	 *
+	 * \return A description of the command-line arguments.
+	 *
+	 */
+	std::string DriverOptions::GetUsage()
+	{
+		return
+			"\t\t CDT arg1 [--name value]...\n"
+			"\t\t arg1: name of the output file describing the triangulation of the sample points (extension .vtk; an .off file is written).\n"
+			"\t\t --surface name: surface to be sampled, among cylinder, esfera, cone, and toro, nurbs:file.txt for a NURBS patch read from file.txt, or heightfield:file.txt for a terrain described by file.txt (default cylinder).\n"
+			"\t\t --alpha a: Poisson disk radius (default 0.1).\n"
+			"\t\t --target-points n: estimate alpha so that about n points are sampled, from the area of the surface (default 0, use alpha).\n"
+			"\t\t --trial-points n: correct the estimated alpha with a trial run sampling about n points, 0 for no trial (default 1000).\n"
+			"\t\t --max-error e: let the radius shrink with the curvature, down to min-alpha, so that triangles stay within e of the surface (default 0, fixed radius alpha).\n"
+			"\t\t --min-alpha a: smallest Poisson disk radius with --max-error, 0 for alpha / 10 (default 0).\n"
+			"\t\t --points n: sample exactly n points by weighted sample elimination instead of Poisson disk sampling (default 0, Poisson disk sampling).\n"
+			"\t\t --levels k: sample k levels of detail, the radius halving from each level to the next down to alpha, and also write the coarser levels to file_lod0.off, file_lod1.off, ... (default 1).\n"
+			"\t\t --tile file.bin: sample by laying copies of a periodic Poisson disk tile read from file.bin, which is generated and written first if missing (default none, Poisson disk sampling).\n"
+			"\t\t --trim file.txt: mesh only the part of the domain kept by the trimming polygons of file.txt, whose sides become constrained edges (default none, the whole domain).\n"
+			"\t\t --max-trials n: failed trials after which sampling stops (default 100).\n"
+			"\t\t --seed s: seed of the sampler (default 1).\n"
+			"\t\t --threads t: number of threads, 0 for one per hardware thread (default 0).\n"
+			"\t\t --format f: off, or stoff to also write parameter coordinates (default off).\n"
+			"\t\t --min-angle a: insert Steiner points until no triangle has a parameter-space angle below a degrees, up to 34; the angles on the surface are not bounded (default 0, no refinement).\n"
+			"\t\t --max-area A: insert Steiner points until no triangle has a parameter-space area above A (default 0, no bound).\n"
+			"\t\t --metric m: uv for triangles Delaunay in the parameter plane, or surface for triangles Delaunay on the surface (default uv).\n"
+			"\t\t --boundary b: triangle to build the CDT inside an enclosing triangle, or ghost to use a ghost vertex at infinity (default triangle).\n"
+			"\t\t --patch-boundary b: corners to seed only the corners of the domain, or sampled to sample its sides first at a spacing of 2 alpha on the surface and make them constrained edges, so that patches sharing a side share its vertices (default corners).\n"
+			"\t\t --lloyd k: move the samples to the centroids of their Voronoi cells on the surface k times after the CDT is built (default 0).\n"
+			"\t\t --weld d: weld the output vertices within a distance d of each other on the surface, and drop the triangles left degenerate (default 0, no welding).\n"
+			"\t\t --stream-batch n: triangulate the sample points in batches of n while sampling goes on, 0 to triangulate after sampling (default 512).\n"
+			"\t\t --load-samples file.off: reuse the sample points of an STOFF file instead of sampling the surface.\n"
+			"\t\t --save-samples file.off: save the sample points to an STOFF file.\n"
+			"\t\t --compare golden.off: compare the output triangulation against a golden OFF file.\n"
+			"\t\t --report file.json: append the time, memory, and item counts of each stage as a JSON line (- for the standard output).\n"
+			"\t\t --config file: read \"name = value\" settings from a file.\n"
+			"\t\t --sweep file: run once per line of a file; each line holds name=value settings (including output=file.vtk).\n"
+			"\t\t --batch file: like --sweep, but each line is a surface patch and all patches are meshed concurrently.\n"
+			"\t\t --max-tile-points n: in batch mode, split patches expected to have more than n sample points into tiles sampled in parallel (default 2000, 0 to never split).\n";
+	}
+
+
+	/**
+	 * \fn void DriverOptions::ReadSweepFile(const std::string& filename, const DriverOptions& base, std::vector<DriverOptions>& runs)
+	 *
+	 * \brief Reads the settings of a list of runs from a sweep file.
+	 *
+	 * \param filename The name of the sweep file.
+	 * \param base The settings shared by all runs.
+	 * \param runs A reference to the settings of each run.
+	 *
+	 */
+	void
+		DriverOptions::ReadSweepFile(
+			const std::string& filename,
+			const DriverOptions& base,
+			std::vector<DriverOptions>& runs
+		)
+	{
+		std::ifstream in(filename.c_str());
+
+		if (!in.is_open())
+		{
+			throw std::runtime_error("Sweep file \"" + filename + "\" cannot be opened.");
+		}
+
+		std::string line;
+
+		while (std::getline(in, line))
+		{
+			line = Trim(line);
+
+			if (line.empty() || (line[0] == '#'))
+			{
+				continue;
+			}
+
+			DriverOptions run(base);
+
+			std::istringstream tokens(line);
+			std::string token;
+
+			while (tokens >> token)
+			{
+				size_t eq = token.find('=');
+
+				if (eq == std::string::npos)
+				{
+					throw std::runtime_error("Sweep token \"" + token + "\" is not of the form name=value.");
+				}
+
+				run.Set(token.substr(0, eq), token.substr(eq + 1));
+			}
+
+			runs.push_back(run);
+		}
+
+		if (runs.empty())
+		{
+			throw std::runtime_error("Sweep file \"" + filename + "\" has no runs.");
+		}
+
+		return;
+	}
+
+}
+
+/** @} */ //end of group class.
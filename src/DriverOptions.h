@@ -0,0 +1,226 @@
+/**
+ * \file DriverOptions.h
+ *
+ * \brief This  file contains the  definition of a class  that holds the
+ * settings of a run of the driver,  read from the command line, from a
+ * configuration file, or from a line of a sweep or batch file.
+ *
+ * \author
+ * Adelino Afonso e Irene Ginani \n
+ * Universidade Federal do Rio Grande do Norte, \n
+ * Instituto Metr&oacute;pole Digital, \n
+ * Adelino Afonso at imd (dot) ufrn (dot) br, \n
+ * Irene Ginani at imd (dot) ufrn (dot) br
+ *
+ * \version 1.0
+ * \date October 2026
+ *
+ * \attention This program is distributed WITHOUT ANY WARRANTY, and it
+ *            may be freely redistributed under the condition that the
+ *            copyright notices  are not removed,  and no compensation
+ *            is received. Private, research, and institutional use is
+ *            free. Distribution of this  code as part of a commercial
+ *            system  is permissible ONLY  BY DIRECT  ARRANGEMENT WITH
+ *            THE AUTHOR.
+ */
+
+#pragma once
+
+#include <string>              // std::string
+#include <vector>              // std::vector
+
+
+/**
+ * \defgroup MAT309NameSpace Namespace MAT309.
+ * @{
+ */
+
+/**
+ * \namespace MAT309
+ *
+ * \brief Global namespace for MAT309 software.
+ *
+ */
+
+namespace MAT309
+{
+
+	/**
+	 * \class DriverOptions
+	 *
+	 * \brief This class holds the settings of  a run of the driver.
+	 * Every setting has a name, which is used the same way in all
+	 * three sources of settings:
+	 *
+	 * - on the command line, as "--name value";
+	 * - in a configuration file, as "name = value", one per line;
+	 * - in a sweep file, as "name=value" tokens, one run per line.
+	 *
+	 * Lines starting with '#' are comments.
+	 *
+	 */
+	class DriverOptions
+	{
+	public:
+
+		// -----------------------------------------------------------
+		//
+		// Public data members
+		//
+		// -----------------------------------------------------------
+
+		std::string _output;          ///< Name of the output file (with extension .vtk).
+		std::string _surface;         ///< Name of the surface to be sampled.
+		double _alpha;                ///< Poisson disk radius (the largest radius, if the radius varies).
+		size_t _targetPoints;         ///< Desired number of sample points, from which the Poisson disk radius is estimated (0 means the radius is alpha).
+		size_t _trialPoints;          ///< Number of sample points of the trial run that corrects the estimated radius (0 means no trial).
+		double _maxError;             ///< Largest distance allowed between the surface and the triangles, from which the radius varies with the curvature (0 means a fixed radius).
+		double _minAlpha;             ///< Smallest Poisson disk radius when the radius varies (0 means alpha / 10).
+		size_t _numberOfSamples;      ///< Exact number of sample points, drawn by weighted sample elimination instead of Poisson disk sampling (0 means Poisson disk sampling).
+		size_t _levels;               ///< Number of levels of detail, the radius doubling from each level to the coarser one (1 means a single level).
+		std::string _tile;            ///< Name of a binary file with a periodic Poisson disk tile laid over the domain instead of Poisson disk sampling (empty means Poisson disk sampling).
+		std::string _trim;            ///< Name of a text file with the trimming polygons of the patch (empty means the whole domain is meshed).
+		double _maxTrials;            ///< Number of failed trials after which sampling stops.
+		unsigned _seed;               ///< Seed of the sampler.
+		size_t _numberOfThreads;      ///< Number of threads (0 means one per hardware thread).
+		std::string _format;          ///< Output format: "off", or "stoff" (OFF with parameter coordinates).
+		std::string _loadSamples;     ///< Name of an STOFF file with sample points to be reused.
+		std::string _saveSamples;     ///< Name of an STOFF file to which the sample points are saved.
+		std::string _golden;          ///< Name of an OFF file the output is compared against.
+		std::string _report;          ///< Name of a file to which the stage report is appended ("-" means the standard output).
+		size_t _streamBatch;          ///< Number of sample points handed to the CDT at a time while sampling (0 means the CDT starts after sampling).
+		size_t _maxTilePoints;        ///< In batch mode, estimated number of sample points above which a patch is split into tiles (0 means never).
+		double _minAngle;             ///< Minimum parameter-space angle, in degrees, of a triangle after refinement (0 means no bound).
+		double _maxArea;              ///< Maximum parameter-space area of a triangle after refinement (0 means no bound).
+		std::string _metric;          ///< Metric of the incircle test: "uv" (parameter plane) or "surface" (first fundamental form).
+		std::string _boundary;        ///< How the CDT handles the outside of the convex hull: "triangle" (enclosing triangle) or "ghost" (ghost vertex).
+		std::string _patchBoundary;   ///< How the boundary of the domain is sampled: "corners" (only the corners, the rest by chance) or "sampled" (first, at a spacing of 2 alpha, bounded by segments).
+		size_t _lloyd;                ///< Number of Lloyd iterations run on the samples after the CDT is built (0 means none).
+		double _weld;                 ///< Distance on the surface within which the output vertices are welded together (0 means no welding).
+
+
+		// -----------------------------------------------------------
+		//
+		// Public methods
+		//
+		// -----------------------------------------------------------
+
+		/**
+		 * \fn DriverOptions()
+		 *
+		 * \brief Creates an instance of this class holding the default
+		 * settings.
+		 *
+		 */
+		DriverOptions();
+
+
+		/**
+		 * \fn void Set(const std::string& name, const std::string& value)
+		 *
+		 * \brief Changes a setting.
+		 *
+		 * \param name The name of the setting.
+		 * \param value The new value of the setting.
+		 *
+		 */
+		void
+			Set(
+				const std::string& name,
+				const std::string& value
+			);
+
+
+		/**
+		 * \fn void ReadConfigFile(const std::string& filename)
+		 *
+		 * \brief Reads  settings  from  a configuration  file,  with one
+		 * "name = value" pair per line.
+		 *
+		 * \param filename The name of the configuration file.
+		 *
+		 */
+		void
+			ReadConfigFile(
+				const std::string& filename
+			);
+
+
+		/**
+		 * \fn void Check() const
+		 *
+		 * \brief Makes sure the settings describe a valid run.
+		 *
+		 */
+		void Check() const;
+
+
+		/**
+		 * \fn static void ParseCommandLine(int argc, char* argv[], std::vector<DriverOptions>& runs, bool& batch)
+		 *
+		 * \brief Reads the settings of  all runs from the command line.
+		 * If a sweep or batch file is given, each of its lines defines a
+		 * run whose settings override the ones given on the command
+		 * line.  Otherwise, there is a single run.
+		 *
+		 * \param argc The number of command-line arguments.
+		 * \param argv An array with the command-line arguments.
+		 * \param runs A reference to the settings of each run.
+		 * \param batch A reference to a flag indicating whether the runs
+		 * came from a batch file, and so are meant to run concurrently.
+		 *
+		 */
+		static
+		void
+			ParseCommandLine(
+				int argc,
+				char* argv[],
+				std::vector<DriverOptions>& runs,
+				bool& batch
+			);
+
+
+		/**
+		 * \fn static std::string GetUsage()
+		 *
+		 * \brief Returns a description of the command-line arguments.
+		 *
+		 * \return A description of the command-line arguments.
+		 *
+		 */
+		static
+		std::string
+			GetUsage();
+
+
+	private:
+
+		// -----------------------------------------------------------
+		//
+		// Private methods
+		//
+		// -----------------------------------------------------------
+
+		/**
+		 * \fn static void ReadSweepFile(const std::string& filename, const DriverOptions& base, std::vector<DriverOptions>& runs)
+		 *
+		 * \brief Reads the settings of a list of runs from a sweep (or
+		 * batch) file.
+		 *
+		 * \param filename The name of the sweep file.
+		 * \param base The settings shared by all runs.
+		 * \param runs A reference to the settings of each run.
+		 *
+		 */
+		static
+		void
+			ReadSweepFile(
+				const std::string& filename,
+				const DriverOptions& base,
+				std::vector<DriverOptions>& runs
+			);
+	};
+
+}
+
+/** @} */ //end of group class.
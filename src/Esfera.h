@@ -161,6 +161,22 @@ namespace MAT309
 		}
 
 
+		/**
+		 * \fn bool IsPeriodicInU() const
+		 *
+		 * \brief Tells whether the surface closes up along the first
+		 * coordinate, which it does: the sides u = GetUMin() and
+		 * u = GetUMax() are the same curve.
+		 *
+		 * \return True.
+		 *
+		 */
+		bool IsPeriodicInU() const
+		{
+			return true;
+		}
+
+
 		/**
 		 * \fn void GetPoint(double u, double v, double& x, double& y, double& z) const
 		 *
@@ -187,7 +203,8 @@ namespace MAT309
 			)
 		    const
 		{
-			if ((u < GetUMin()) || (u > GetUMax()) || (v < GetVMin()) || (v > GetVMax()))
+			// The surface is periodic in u, so any u is valid.
+			if ((v < GetVMin()) || (v > GetVMax()))
 			{
 				throw std::runtime_error("The given parameter point is outside the parameter domain.");
 			}
@@ -226,7 +243,7 @@ namespace MAT309
 			)
 		    const
 		{
-			if ((u < GetUMin()) || (u > GetUMax()) || (v < GetVMin()) || (v > GetVMax()))
+			if ((v < GetVMin()) || (v > GetVMax()))
 			{
 				throw std::runtime_error("The given parameter point is outside the parameter domain.");
 			}
@@ -265,7 +282,7 @@ namespace MAT309
 			)
 		    const
 		{
-			if ((u < GetUMin()) || (u > GetUMax()) || (v < GetVMin()) || (v > GetVMax()))
+			if ((v < GetVMin()) || (v > GetVMax()))
 			{
 				throw std::runtime_error("The given parameter point is outside the parameter domain.");
 			}
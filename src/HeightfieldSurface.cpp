@@ -0,0 +1,547 @@
+/**
+ * \file HeightfieldSurface.cpp
+ *
+ * \brief Implementation of the class HeightfieldSurface, which
+ * represents a terrain given by a grid of heights kept in a file mapped
+ * into memory.
+ *
+ * \author
+ * Adelino Afonso e Irene Ginani \n
+ * Universidade Federal do Rio Grande do Norte, \n
+ * Instituto Metr&oacute;pole Digital, \n
+ * Adelino Afonso at imd (dot) ufrn (dot) br, \n
+ * Irene Ginani at imd (dot) ufrn (dot) br
+ *
+ * \version 1.0
+ * \date October 2026
+ *
+ * \attention This program is distributed WITHOUT ANY WARRANTY, and it
+ *            may be freely redistributed under the condition that the
+ *            copyright notices  are not removed,  and no compensation
+ *            is received. Private, research, and institutional use is
+ *            free. Distribution of this  code as part of a commercial
+ *            system  is permissible ONLY  BY DIRECT  ARRANGEMENT WITH
+ *            THE AUTHOR.
+ */
+
+#include "HeightfieldSurface.h"  // HeightfieldSurface
+
+#include <algorithm>             // std::min, std::max
+#include <cmath>                 // floor, std::isfinite
+#include <fstream>               // std::ifstream
+#include <limits>                // std::numeric_limits
+#include <stdexcept>             // std::runtime_error
+
+#include <fcntl.h>               // open
+#include <sys/mman.h>            // mmap, munmap, madvise
+#include <sys/stat.h>            // fstat
+#include <unistd.h>              // close
+
+
+/**
+ * \defgroup MAT309NameSpace Namespace MAT309.
+ * @{
+ */
+
+/**
+ * \namespace MAT309
+ *
+ * \brief Global namespace for MAT309 software.
+ */
+
+namespace MAT309
+{
+
+	/**
+	 * \fn HeightfieldSurface::HeightfieldSurface(const std::string& filename, size_t columns, size_t rows, double spacing)
+	 *
+	 * \brief Creates an instance of this class, mapping the file of
+	 * heights into memory.
+	 *
+	 * \param filename The name of the file of heights.
+	 * \param columns The number of nodes along x.
+	 * \param rows The number of nodes along y.
+	 * \param spacing The distance between neighbouring nodes.
+	 *
+	 */
+	HeightfieldSurface::HeightfieldSurface(
+		const std::string& filename,
+		size_t columns,
+		size_t rows,
+		double spacing
+	)
+		:
+		_mapping(nullptr),
+		_mappingSize(0),
+		_heights(nullptr),
+		_columns(columns),
+		_rows(rows),
+		_spacing(spacing)
+	{
+		if ((columns < 2) || (rows < 2))
+		{
+			throw std::runtime_error("A heightfield needs at least two columns and two rows of heights.");
+		}
+
+		if (!std::isfinite(spacing) || (spacing <= 0))
+		{
+			throw std::runtime_error("The spacing of a heightfield must be positive.");
+		}
+
+		if (columns > std::numeric_limits<size_t>::max() / sizeof(float) / rows)
+		{
+			throw std::runtime_error("The heightfield is too large to be addressed.");
+		}
+
+		int fd = open(filename.c_str(), O_RDONLY);
+
+		if (fd < 0)
+		{
+			throw std::runtime_error("Heightfield file \"" + filename + "\" cannot be opened.");
+		}
+
+		struct stat info;
+
+		if ((fstat(fd, &info) != 0) || (size_t(info.st_size) < columns * rows * sizeof(float)))
+		{
+			close(fd);
+			throw std::runtime_error("Heightfield file \"" + filename + "\" is shorter than its number of columns times its number of rows.");
+		}
+
+		_mappingSize = size_t(info.st_size);
+		_mapping = mmap(nullptr, _mappingSize, PROT_READ, MAP_PRIVATE, fd, 0);
+
+		// The mapping keeps the file alive, so the descriptor is no
+		// longer needed.
+		close(fd);
+
+		if (_mapping == MAP_FAILED)
+		{
+			throw std::runtime_error("Heightfield file \"" + filename + "\" cannot be mapped into memory.");
+		}
+
+		// Samples are scattered over the grid, so reading ahead of a
+		// touched page would mostly read heights no one asks for.
+		madvise(_mapping, _mappingSize, MADV_RANDOM);
+
+		_heights = static_cast<const float*>(_mapping);
+	}
+
+
+	/**
+	 * \fn HeightfieldSurface::~HeightfieldSurface()
+	 *
+	 * \brief  Releases the  memory held  by an  instance of  this
+	 * class, unmapping the file of heights.
+	 */
+	HeightfieldSurface::~HeightfieldSurface()
+	{
+		munmap(_mapping, _mappingSize);
+	}
+
+
+	/**
+	 * \fn HeightfieldSurface::spHeightfieldSurface HeightfieldSurface::Load(const std::string& filename)
+	 *
+	 * \brief Reads the description of a grid from a text file, and maps
+	 * its file of heights into memory.
+	 *
+	 * \param filename The name of the text file.
+	 *
+	 * \return A pointer to the surface.
+	 *
+	 */
+	HeightfieldSurface::spHeightfieldSurface
+		HeightfieldSurface::Load(
+			const std::string& filename
+		)
+	{
+		std::ifstream in(filename);
+
+		if (!in.is_open())
+		{
+			throw std::runtime_error("Heightfield file \"" + filename + "\" cannot be opened.");
+		}
+
+		std::string heights;
+		size_t columns = 0;
+		size_t rows = 0;
+		double spacing = 0;
+
+		if (!(in >> heights >> columns >> rows >> spacing))
+		{
+			throw std::runtime_error("The heightfield file must hold the name of the file of heights, the numbers of columns and rows, and the spacing.");
+		}
+
+		// The file of heights is named relative to the description.
+		std::string::size_type slash = filename.rfind('/');
+
+		if ((heights[0] != '/') && (slash != std::string::npos))
+		{
+			heights = filename.substr(0, slash + 1) + heights;
+		}
+
+		return std::make_shared<HeightfieldSurface>(heights, columns, rows, spacing);
+	}
+
+
+	/**
+	 * \fn void HeightfieldSurface::GetPoint(double u, double v, double& x, double& y, double& z) const
+	 *
+	 * \brief Computes the  point on this surface  corresponding to a
+	 * given parameter point.
+	 *
+	 * \param u First coordinate of a parameter point.
+	 * \param v Second coordinate of a parameter point.
+	 * \param x A reference to the first coordinate of the point.
+	 * \param y A reference to the second coordinate of the point.
+	 * \param z A reference to the third coordinate of the point.
+	 *
+	 */
+	void
+		HeightfieldSurface::GetPoint(
+			double u,
+			double v,
+			double& x,
+			double& y,
+			double& z
+		)
+		const
+	{
+		double hu;
+		double hv;
+
+		Interpolate(u, v, z, hu, hv);
+
+		x = u;
+		y = v;
+
+		return;
+	}
+
+
+	/**
+	 * \fn void HeightfieldSurface::GetDu(double u, double v, double& x, double& y, double& z) const
+	 *
+	 * \brief Computes  the first derivative vector  in direction \c u
+	 * at a given parameter point.
+	 *
+	 * \param u First coordinate of a parameter point.
+	 * \param v Second coordinate of a parameter point.
+	 * \param x A reference to the first coordinate of the vector.
+	 * \param y A reference to the second coordinate of the vector.
+	 * \param z A reference to the third coordinate of the vector.
+	 *
+	 */
+	void
+		HeightfieldSurface::GetDu(
+			double u,
+			double v,
+			double& x,
+			double& y,
+			double& z
+		)
+		const
+	{
+		double h;
+		double hv;
+
+		Interpolate(u, v, h, z, hv);
+
+		x = 1;
+		y = 0;
+
+		return;
+	}
+
+
+	/**
+	 * \fn void HeightfieldSurface::GetDv(double u, double v, double& x, double& y, double& z) const
+	 *
+	 * \brief Computes  the first derivative vector  in direction \c v
+	 * at a given parameter point.
+	 *
+	 * \param u First coordinate of a parameter point.
+	 * \param v Second coordinate of a parameter point.
+	 * \param x A reference to the first coordinate of the vector.
+	 * \param y A reference to the second coordinate of the vector.
+	 * \param z A reference to the third coordinate of the vector.
+	 *
+	 */
+	void
+		HeightfieldSurface::GetDv(
+			double u,
+			double v,
+			double& x,
+			double& y,
+			double& z
+		)
+		const
+	{
+		double h;
+		double hu;
+
+		Interpolate(u, v, h, hu, z);
+
+		x = 0;
+		y = 1;
+
+		return;
+	}
+
+
+	/**
+	 * \fn void HeightfieldSurface::GetRow(double v, size_t count, const double* u, double* points, double* du, double* dv) const
+	 *
+	 * \brief Computes the points and the first derivative vectors at a
+	 * row of parameter points sharing their second coordinate.  The
+	 * weights of the four rows of nodes around the row are computed
+	 * once.
+	 *
+	 * \param v Second coordinate of the parameter points.
+	 * \param count Number of parameter points.
+	 * \param u An array with the first coordinate of each parameter
+	 * point.
+	 * \param points An array receiving the three coordinates of each
+	 * point on the surface (may be null).
+	 * \param du An array receiving the three coordinates of each first
+	 * derivative vector in direction \c u (may be null).
+	 * \param dv An array receiving the three coordinates of each first
+	 * derivative vector in direction \c v (may be null).
+	 *
+	 */
+	void
+		HeightfieldSurface::GetRow(
+			double v,
+			size_t count,
+			const double* u,
+			double* points,
+			double* du,
+			double* dv
+		)
+		const
+	{
+		size_t nodesV[4];
+		double weightsV[4];
+		double slopesV[4];
+
+		GetWeights(v, _rows, nodesV, weightsV, slopesV);
+
+		const float* rows[4];
+
+		for (size_t b = 0; b < 4; b++)
+		{
+			rows[b] = _heights + nodesV[b] * _columns;
+		}
+
+		for (size_t k = 0; k < count; k++)
+		{
+			size_t nodesU[4];
+			double weightsU[4];
+			double slopesU[4];
+
+			GetWeights(u[k], _columns, nodesU, weightsU, slopesU);
+
+			double h = 0;
+			double hu = 0;
+			double hv = 0;
+
+			for (size_t b = 0; b < 4; b++)
+			{
+				double height = 0;
+				double slope = 0;
+
+				for (size_t a = 0; a < 4; a++)
+				{
+					height += weightsU[a] * rows[b][nodesU[a]];
+					slope += slopesU[a] * rows[b][nodesU[a]];
+				}
+
+				h += weightsV[b] * height;
+				hu += weightsV[b] * slope;
+				hv += slopesV[b] * height;
+			}
+
+			if (points != nullptr)
+			{
+				points[3 * k] = u[k];
+				points[3 * k + 1] = v;
+				points[3 * k + 2] = h;
+			}
+
+			if (du != nullptr)
+			{
+				du[3 * k] = 1;
+				du[3 * k + 1] = 0;
+				du[3 * k + 2] = hu;
+			}
+
+			if (dv != nullptr)
+			{
+				dv[3 * k] = 0;
+				dv[3 * k + 1] = 1;
+				dv[3 * k + 2] = hv;
+			}
+		}
+
+		return;
+	}
+
+
+	/**
+	 * \fn void HeightfieldSurface::GetFirstFundamentalForm(double u, double v, double& e, double& f, double& g) const
+	 *
+	 * \brief Computes the coefficients  of the first fundamental form
+	 * at  a given  parameter  point, from both slopes computed in a
+	 * single interpolation.
+	 *
+	 * \param u First coordinate of a parameter point.
+	 * \param v Second coordinate of a parameter point.
+	 * \param e A reference to the dot product of the derivative in
+	 * direction \c u with itself.
+	 * \param f A reference to the dot product of the derivatives in
+	 * directions \c u and \c v.
+	 * \param g A reference to the dot product of the derivative in
+	 * direction \c v with itself.
+	 *
+	 */
+	void
+		HeightfieldSurface::GetFirstFundamentalForm(
+			double u,
+			double v,
+			double& e,
+			double& f,
+			double& g
+		)
+		const
+	{
+		double h;
+		double hu;
+		double hv;
+
+		Interpolate(u, v, h, hu, hv);
+
+		e = 1 + hu * hu;
+		f = hu * hv;
+		g = 1 + hv * hv;
+
+		return;
+	}
+
+
+	/**
+	 * \fn void HeightfieldSurface::Interpolate(double u, double v, double& h, double& hu, double& hv) const
+	 *
+	 * \brief Computes the height and both slopes of the terrain at a
+	 * parameter point.
+	 *
+	 * \param u First coordinate of a parameter point.
+	 * \param v Second coordinate of a parameter point.
+	 * \param h A reference to the height.
+	 * \param hu A reference to the slope along x.
+	 * \param hv A reference to the slope along y.
+	 *
+	 */
+	void
+		HeightfieldSurface::Interpolate(
+			double u,
+			double v,
+			double& h,
+			double& hu,
+			double& hv
+		)
+		const
+	{
+		size_t nodesU[4];
+		double weightsU[4];
+		double slopesU[4];
+
+		size_t nodesV[4];
+		double weightsV[4];
+		double slopesV[4];
+
+		GetWeights(u, _columns, nodesU, weightsU, slopesU);
+		GetWeights(v, _rows, nodesV, weightsV, slopesV);
+
+		h = 0;
+		hu = 0;
+		hv = 0;
+
+		for (size_t b = 0; b < 4; b++)
+		{
+			const float* row = _heights + nodesV[b] * _columns;
+
+			double height = 0;
+			double slope = 0;
+
+			for (size_t a = 0; a < 4; a++)
+			{
+				height += weightsU[a] * row[nodesU[a]];
+				slope += slopesU[a] * row[nodesU[a]];
+			}
+
+			h += weightsV[b] * height;
+			hu += weightsV[b] * slope;
+			hv += slopesV[b] * height;
+		}
+
+		return;
+	}
+
+
+	/**
+	 * \fn void HeightfieldSurface::GetWeights(double t, size_t count, size_t* nodes, double* weights, double* slopes) const
+	 *
+	 * \brief Computes the four nodes along one coordinate whose heights
+	 * are blended at a parameter, clamped to the grid, and the weights
+	 * of the blend and of its derivative.
+	 *
+	 * \param t The parameter.
+	 * \param count The number of nodes along the coordinate.
+	 * \param nodes An array receiving the indices of the four nodes.
+	 * \param weights An array receiving the weight of each node.
+	 * \param slopes An array receiving the weight of each node in the
+	 * derivative with respect to the parameter.
+	 *
+	 */
+	void
+		HeightfieldSurface::GetWeights(
+			double t,
+			size_t count,
+			size_t* nodes,
+			double* weights,
+			double* slopes
+		)
+		const
+	{
+		double s = std::min(std::max(t / _spacing, 0.0), double(count - 1));
+
+		// The last node ends the last cell rather than starting a new one.
+		size_t cell = std::min(size_t(floor(s)), count - 2);
+
+		double w = s - cell;
+		double w2 = w * w;
+		double w3 = w2 * w;
+
+		// The nodes beyond the ends of the grid repeat the end nodes.
+		nodes[0] = (cell > 0) ? cell - 1 : 0;
+		nodes[1] = cell;
+		nodes[2] = cell + 1;
+		nodes[3] = std::min(cell + 2, count - 1);
+
+		weights[0] = 0.5 * (-w3 + 2 * w2 - w);
+		weights[1] = 0.5 * (3 * w3 - 5 * w2 + 2);
+		weights[2] = 0.5 * (-3 * w3 + 4 * w2 + w);
+		weights[3] = 0.5 * (w3 - w2);
+
+		slopes[0] = 0.5 * (-3 * w2 + 4 * w - 1) / _spacing;
+		slopes[1] = 0.5 * (9 * w2 - 10 * w) / _spacing;
+		slopes[2] = 0.5 * (-9 * w2 + 8 * w + 1) / _spacing;
+		slopes[3] = 0.5 * (3 * w2 - 2 * w) / _spacing;
+
+		return;
+	}
+
+}
+
+/** @} */ //end of group class.
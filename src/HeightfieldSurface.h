@@ -0,0 +1,434 @@
+/**
+ * \file HeightfieldSurface.h
+ *
+ * \brief This file contains the definition of a class to represent a
+ * terrain given by a grid of heights kept in a file mapped into memory.
+ *
+ * \author
+ * Adelino Afonso e Irene Ginani \n
+ * Universidade Federal do Rio Grande do Norte, \n
+ * Instituto Metr&oacute;pole Digital, \n
+ * Adelino Afonso at imd (dot) ufrn (dot) br, \n
+ * Irene Ginani at imd (dot) ufrn (dot) br
+ *
+ * \version 1.0
+ * \date October 2026
+ *
+ * \attention This program is distributed WITHOUT ANY WARRANTY, and it
+ *            may be freely redistributed under the condition that the
+ *            copyright notices  are not removed,  and no compensation
+ *            is received. Private, research, and institutional use is
+ *            free. Distribution of this  code as part of a commercial
+ *            system  is permissible ONLY  BY DIRECT  ARRANGEMENT WITH
+ *            THE AUTHOR.
+ */
+
+#pragma once
+
+#include "Surface.h"           // Surface
+
+#include <memory>              // std::shared_ptr
+#include <string>              // std::string
+
+
+/**
+ * \defgroup MAT309NameSpace Namespace MAT309.
+ * @{
+ */
+
+/**
+ * \namespace MAT309
+ *
+ * \brief Global namespace for MAT309 software.
+ *
+ */
+
+namespace MAT309
+{
+
+	/**
+	 * \class HeightfieldSurface
+	 *
+	 * \brief This class represents a terrain z = h(x, y) given by the
+	 * heights at the nodes of a regular grid, stored as raw 32-bit
+	 * floats in the byte order of the machine, one row of constant y
+	 * after the other.  The parameters are x and y themselves, from
+	 * zero to the spacing times the number of columns or rows minus
+	 * one.  Between the nodes, the heights are interpolated by the
+	 * bicubic (Catmull-Rom) convolution of the 4 x 4 nearest nodes,
+	 * and the derivatives are those of the interpolant.
+	 *
+	 * The file is mapped into memory and never read as a whole: the
+	 * system reads the pages of the rows an evaluation touches when
+	 * they are first touched, and may drop them again when memory is
+	 * short, so grids larger than the memory can be meshed.  Read-ahead
+	 * is turned off, since the samples are scattered.  A patch split
+	 * into tiles by the batch mesher touches only the rows of the tiles
+	 * being sampled, which go through the file from its first row to
+	 * its last.
+	 *
+	 * A grid is described by a text file holding the name of the file
+	 * of heights (relative to the text file), the numbers of columns
+	 * and rows, and the spacing between neighbouring nodes.
+	 *
+	 */
+	class HeightfieldSurface : public Surface
+	{
+	public:
+
+		// -----------------------------------------------------------
+		//
+		// Type definitions
+		//
+		// -----------------------------------------------------------
+
+		/**
+		 * \typedef spHeightfieldSurface
+		 *
+		 * \brief Alias for a shared pointer to HeightfieldSurface
+		 * objects.
+		 *
+		 */
+		typedef std::shared_ptr<HeightfieldSurface> spHeightfieldSurface;
+
+
+	private:
+
+		// -----------------------------------------------------------
+		//
+		// Private data members
+		//
+		// -----------------------------------------------------------
+
+		void* _mapping;              ///< The start of the file mapped into memory.
+		size_t _mappingSize;         ///< The size in bytes of the mapping.
+		const float* _heights;       ///< The heights, the node of column i and row j at position j * columns + i.
+		size_t _columns;             ///< The number of nodes along x.
+		size_t _rows;                ///< The number of nodes along y.
+		double _spacing;             ///< The distance between neighbouring nodes.
+
+
+	public:
+
+		// -----------------------------------------------------------
+		//
+		// Public methods
+		//
+		// -----------------------------------------------------------
+
+		/**
+		 * \fn HeightfieldSurface(const std::string& filename, size_t columns, size_t rows, double spacing)
+		 *
+		 * \brief Creates an instance of this class, mapping the file of
+		 * heights into memory.
+		 *
+		 * \param filename The name of the file of heights.
+		 * \param columns The number of nodes along x.
+		 * \param rows The number of nodes along y.
+		 * \param spacing The distance between neighbouring nodes.
+		 *
+		 */
+		HeightfieldSurface(
+			const std::string& filename,
+			size_t columns,
+			size_t rows,
+			double spacing
+		);
+
+
+		/**
+		 * \fn HeightfieldSurface(const HeightfieldSurface& s) = delete
+		 *
+		 * \brief The mapping belongs to a single instance, so instances
+		 * cannot be copied.
+		 *
+		 * \param s An instance of this class.
+		 *
+		 */
+		HeightfieldSurface(const HeightfieldSurface& s) = delete;
+
+
+		/**
+		 * \fn virtual ~HeightfieldSurface()
+		 *
+		 * \brief  Releases the  memory held  by an  instance of  this
+		 * class, unmapping the file of heights.
+		 */
+		virtual ~HeightfieldSurface();
+
+
+		/**
+		 * \fn static spHeightfieldSurface Load(const std::string& filename)
+		 *
+		 * \brief Reads the description of a grid from a text file, and
+		 * maps its file of heights into memory.
+		 *
+		 * \param filename The name of the text file.
+		 *
+		 * \return A pointer to the surface.
+		 *
+		 */
+		static spHeightfieldSurface
+			Load(
+				const std::string& filename
+			);
+
+
+		/**
+		 * \fn double GetUMin() const
+		 *
+		 * \brief Returns the lower bound  for the first coordinate of
+		 * a domain point.
+		 *
+		 * \return  The lower  bound  for the  first  coordinate of  a
+		 * domain point.
+		 *
+		 */
+		double GetUMin() const
+		{
+			return 0;
+		}
+
+
+		/**
+		 * \fn double GetUMax() const
+		 *
+		 * \brief Returns the upper bound  for the first coordinate of
+		 * a domain point.
+		 *
+		 * \return  The upper  bound  for the  first  coordinate of  a
+		 * domain point.
+		 *
+		 */
+		double GetUMax() const
+		{
+			return _spacing * (_columns - 1);
+		}
+
+
+		/**
+		 * \fn double GetVMin() const
+		 *
+		 * \brief Returns the lower bound  for the second coordinate of
+		 * a domain point.
+		 *
+		 * \return  The lower  bound for  the second  coordinate of  a
+		 * domain point.
+		 *
+		 */
+		double GetVMin() const
+		{
+			return 0;
+		}
+
+
+		/**
+		 * \fn double GetVMax() const
+		 *
+		 * \brief Returns the upper bound for the second coordinate of
+		 * a domain point.
+		 *
+		 * \return  The upper  bound for  the second  coordinate of  a
+		 * domain point.
+		 *
+		 */
+		double GetVMax() const
+		{
+			return _spacing * (_rows - 1);
+		}
+
+
+		/**
+		 * \fn void GetPoint(double u, double v, double& x, double& y, double& z) const
+		 *
+		 * \brief Computes the  point on this surface  corresponding to
+		 * a given parameter point.
+		 *
+		 * \param u First coordinate of a parameter point.
+		 * \param v Second coordinate of a parameter point.
+		 * \param x A reference to the first coordinate of the point.
+		 * \param y A reference to the second coordinate of the point.
+		 * \param z A reference to the third coordinate of the point.
+		 *
+		 */
+		void
+		    GetPoint(
+				double u,
+				double v,
+				double& x,
+				double& y,
+				double& z
+			)
+		    const;
+
+
+		/**
+		 * \fn void GetDu(double u, double v, double& x, double& y, double& z) const
+		 *
+		 * \brief Computes  the first derivative vector  in direction
+		 * \c u at a given parameter point.
+		 *
+		 * \param u First coordinate of a parameter point.
+		 * \param v Second coordinate of a parameter point.
+		 * \param x A reference to the first coordinate of the vector.
+		 * \param y A reference to the second coordinate of the vector.
+		 * \param z A reference to the third coordinate of the vector.
+		 *
+		 */
+		void
+		    GetDu(
+				double u,
+				double v,
+				double& x,
+				double& y,
+				double& z
+			)
+		    const;
+
+
+		/**
+		 * \fn void GetDv(double u, double v, double& x, double& y, double& z) const
+		 *
+		 * \brief Computes  the first derivative vector  in direction
+		 * \c v at a given parameter point.
+		 *
+		 * \param u First coordinate of a parameter point.
+		 * \param v Second coordinate of a parameter point.
+		 * \param x A reference to the first coordinate of the vector.
+		 * \param y A reference to the second coordinate of the vector.
+		 * \param z A reference to the third coordinate of the vector.
+		 *
+		 */
+		void
+		    GetDv(
+				double u,
+				double v,
+				double& x,
+				double& y,
+				double& z
+			)
+		    const;
+
+
+		/**
+		 * \fn void GetRow(double v, size_t count, const double* u, double* points, double* du, double* dv) const
+		 *
+		 * \brief Computes the points and the first derivative vectors
+		 * at a row of parameter points sharing their second coordinate.
+		 * The weights of the four rows of nodes around the row are
+		 * computed once.
+		 *
+		 * \param v Second coordinate of the parameter points.
+		 * \param count Number of parameter points.
+		 * \param u An array with the first coordinate of each
+		 * parameter point.
+		 * \param points An array receiving the three coordinates of
+		 * each point on the surface (may be null).
+		 * \param du An array receiving the three coordinates of each
+		 * first derivative vector in direction \c u (may be null).
+		 * \param dv An array receiving the three coordinates of each
+		 * first derivative vector in direction \c v (may be null).
+		 *
+		 */
+		void
+		    GetRow(
+				double v,
+				size_t count,
+				const double* u,
+				double* points,
+				double* du,
+				double* dv
+			)
+		    const;
+
+
+		/**
+		 * \fn void GetFirstFundamentalForm(double u, double v, double& e, double& f, double& g) const
+		 *
+		 * \brief Computes the coefficients  of the first fundamental
+		 * form  at  a given  parameter  point, from both slopes
+		 * computed in a single interpolation.
+		 *
+		 * \param u First coordinate of a parameter point.
+		 * \param v Second coordinate of a parameter point.
+		 * \param e A reference to the dot product of the derivative in
+		 * direction \c u with itself.
+		 * \param f A reference to the dot product of the derivatives in
+		 * directions \c u and \c v.
+		 * \param g A reference to the dot product of the derivative in
+		 * direction \c v with itself.
+		 *
+		 */
+		void
+		    GetFirstFundamentalForm(
+				double u,
+				double v,
+				double& e,
+				double& f,
+				double& g
+			)
+		    const;
+
+
+	private:
+
+		// -----------------------------------------------------------
+		//
+		// Private methods
+		//
+		// -----------------------------------------------------------
+
+		/**
+		 * \fn void Interpolate(double u, double v, double& h, double& hu, double& hv) const
+		 *
+		 * \brief Computes the height and both slopes of the terrain at
+		 * a parameter point.
+		 *
+		 * \param u First coordinate of a parameter point.
+		 * \param v Second coordinate of a parameter point.
+		 * \param h A reference to the height.
+		 * \param hu A reference to the slope along x.
+		 * \param hv A reference to the slope along y.
+		 *
+		 */
+		void
+			Interpolate(
+				double u,
+				double v,
+				double& h,
+				double& hu,
+				double& hv
+			)
+			const;
+
+
+		/**
+		 * \fn void GetWeights(double t, size_t count, size_t* nodes, double* weights, double* slopes) const
+		 *
+		 * \brief Computes the four nodes along one coordinate whose
+		 * heights are blended at a parameter, clamped to the grid, and
+		 * the weights of the blend and of its derivative.
+		 *
+		 * \param t The parameter.
+		 * \param count The number of nodes along the coordinate.
+		 * \param nodes An array receiving the indices of the four
+		 * nodes.
+		 * \param weights An array receiving the weight of each node.
+		 * \param slopes An array receiving the weight of each node in
+		 * the derivative with respect to the parameter.
+		 *
+		 */
+		void
+			GetWeights(
+				double t,
+				size_t count,
+				size_t* nodes,
+				double* weights,
+				double* slopes
+			)
+			const;
+	};
+
+}
+
+/** @} */ //end of group class.
@@ -0,0 +1,419 @@
+/**
+ * \file LloydRelaxer.cpp
+ *
+ * \brief Implementation of the class LloydRelaxer, which runs Lloyd
+ * iterations on the vertices of the CDT of a sample set.
+ *
+ * \author
+ * Adelino Afonso e Irene Ginani \n
+ * Universidade Federal do Rio Grande do Norte, \n
+ * Instituto Metr&oacute;pole Digital, \n
+ * Adelino Afonso at imd (dot) ufrn (dot) br, \n
+ * Irene Ginani at imd (dot) ufrn (dot) br
+ *
+ * \version 1.0
+ * \date October 2026
+ *
+ * \attention This program is distributed WITHOUT ANY WARRANTY, and it
+ *            may be freely redistributed under the condition that the
+ *            copyright notices  are not removed,  and no compensation
+ *            is received. Private, research, and institutional use is
+ *            free. Distribution of this  code as part of a commercial
+ *            system  is permissible ONLY  BY DIRECT  ARRANGEMENT WITH
+ *            THE AUTHOR.
+ */
+
+#include "LloydRelaxer.h"        // LloydRelaxer
+#include "SamplePoint.h"         // SamplePoint
+#include "VoronoiExtractor.h"    // cdt::VoronoiExtractor
+#include "Edge.h"                // cdt::Edge
+#include "Face.h"                // cdt::Face
+#include "Parallel.h"            // ParallelFor
+
+#include <algorithm>             // std::min, std::max
+#include <cmath>                 // sqrt, fabs
+#include <stdexcept>             // std::runtime_error
+
+
+/**
+ * \defgroup MAT309NameSpace Namespace MAT309.
+ * @{
+ */
+
+/**
+ * \namespace MAT309
+ *
+ * \brief Global namespace for MAT309 software.
+ */
+
+namespace MAT309
+{
+
+	/**
+	 * \fn size_t LloydRelaxer::Relax(cdt::CDT& cdt, size_t numberOfIterations) const
+	 *
+	 * \brief Runs Lloyd iterations on the vertices of a CDT.
+	 *
+	 * \param cdt A finished CDT of samples of the surface.
+	 * \param numberOfIterations The number of iterations.
+	 *
+	 * \return The total number of vertex moves.
+	 *
+	 */
+	size_t
+		LloydRelaxer::Relax(
+			cdt::CDT& cdt,
+			size_t numberOfIterations
+		)
+		const
+	{
+		if (!cdt.IsFinished())
+		{
+			throw std::runtime_error("Only a finished triangulation can be relaxed.");
+		}
+
+		size_t numberOfMoves = 0;
+
+		std::vector<cdt::Vertex*> vertices;
+		std::vector<spPoint> sites;
+		std::vector<spPoint> targets;
+
+		for (size_t it = 0; it < numberOfIterations; it++)
+		{
+			vertices.assign(cdt.VertsBegin(), cdt.VertsEnd());
+
+			size_t numberOfVertices = vertices.size();
+
+			sites.resize(numberOfVertices);
+			targets.assign(numberOfVertices, spPoint());
+
+			// Compute the centroid of the cell of each vertex, and the
+			// sample point the vertex moves to.
+			ParallelFor(
+				0,
+				numberOfVertices,
+				_numberOfThreads,
+				[&](size_t first, size_t last)
+				{
+					std::vector<double> polygon;
+					std::vector<double> buffer;
+
+					for (size_t i = first; i < last; i++)
+					{
+						sites[i] = vertices[i]->GetPoint();
+
+						if (IsMovable(vertices[i]))
+						{
+							targets[i] = ComputeTarget(vertices[i], polygon, buffer);
+						}
+					}
+				}
+			);
+
+			// Move the vertices, one after the other.  The targets were
+			// computed on the stars of the vertices before any move, and
+			// the earlier moves of this iteration may have changed the
+			// star of a vertex, so a target that is no longer strictly
+			// inside the polygon of the current neighbours is computed
+			// again on the current star.  Strictly inside that polygon,
+			// the target is in the hole Remove() leaves, which holds no
+			// constrained edge and lies inside the convex hull, so the
+			// insertion is valid.
+			size_t numberOfMovesInIteration = 0;
+
+			std::vector<double> polygon;
+			std::vector<double> buffer;
+
+			for (size_t i = 0; i < numberOfVertices; i++)
+			{
+				if (targets[i] == nullptr)
+				{
+					continue;
+				}
+
+				if (!IsInsideStar(vertices[i], targets[i]->GetU(), targets[i]->GetV()))
+				{
+					targets[i] = ComputeTarget(vertices[i], polygon, buffer);
+
+					if (targets[i] == nullptr)
+					{
+						continue;
+					}
+				}
+
+				cdt.Remove(sites[i]);
+
+				if (cdt.Insert(targets[i]).empty())
+				{
+					// Another vertex has moved to the same place.
+					cdt.Insert(sites[i]);
+				}
+				else
+				{
+					numberOfMovesInIteration++;
+				}
+			}
+
+			numberOfMoves += numberOfMovesInIteration;
+
+			if (numberOfMovesInIteration == 0)
+			{
+				break;
+			}
+		}
+
+		return numberOfMoves;
+	}
+
+
+	/**
+	 * \fn LloydRelaxer::spPoint LloydRelaxer::ComputeTarget(cdt::Vertex* vertex, std::vector<double>& polygon, std::vector<double>& buffer) const
+	 *
+	 * \brief Computes the point a movable vertex moves to.
+	 *
+	 * \param vertex A movable vertex of a CDT.
+	 * \param polygon A reference to a scratch array.
+	 * \param buffer A reference to another scratch array.
+	 *
+	 * \return The point the vertex moves to, or a null pointer if the
+	 * vertex does not move.
+	 *
+	 */
+	LloydRelaxer::spPoint
+		LloydRelaxer::ComputeTarget(
+			cdt::Vertex* vertex,
+			std::vector<double>& polygon,
+			std::vector<double>& buffer
+		)
+		const
+	{
+		spPoint p = vertex->GetPoint();
+
+		double pu = p->GetU();
+		double pv = p->GetV();
+
+		// Factor the first fundamental form at the vertex as R^T R,
+		// with R = [a b; 0 c].  Then x = R (u - pu, v - pv) measures
+		// lengths on the tangent plane of the surface at the vertex.
+		double e, f, g;
+		_surface->GetFirstFundamentalForm(pu, pv, e, f, g);
+
+		if (e <= 0)
+		{
+			return spPoint();
+		}
+
+		double a = sqrt(e);
+		double b = f / a;
+		double c2 = g - b * b;
+
+		if (c2 <= 0)
+		{
+			return spPoint();
+		}
+
+		double c = sqrt(c2);
+
+		// Cut a square around the vertex with the bisectors of the
+		// vertex and each neighbour.  The vertex lies inside the
+		// polygon of its neighbours, so the cell is bounded.
+		double size = 0;
+
+		cdt::Edge* efirst = vertex->GetEdge();
+		cdt::Edge* edge = efirst;
+
+		do
+		{
+			spPoint q = edge->GetDestination()->GetPoint();
+
+			double x = a * (q->GetU() - pu) + b * (q->GetV() - pv);
+			double y = c * (q->GetV() - pv);
+
+			size = std::max(size, std::max(fabs(x), fabs(y)));
+
+			edge = edge->OriginNext();
+		} while (edge != efirst);
+
+		polygon.assign({ -size, -size, size, -size, size, size, -size, size });
+
+		do
+		{
+			spPoint q = edge->GetDestination()->GetPoint();
+
+			double x = a * (q->GetU() - pu) + b * (q->GetV() - pv);
+			double y = c * (q->GetV() - pv);
+
+			cdt::VoronoiExtractor::ClipToHalfPlane(polygon, x, y, (x * x + y * y) / 2, buffer);
+
+			edge = edge->OriginNext();
+		} while (edge != efirst);
+
+		// Clip the cell to the domain, whose sides are lines in this
+		// frame too: u - pu = (x - b y / c) / a and v - pv = y / c.
+		double umin = _surface->GetUMin();
+		double umax = _surface->GetUMax();
+		double vmin = _surface->GetVMin();
+		double vmax = _surface->GetVMax();
+
+		cdt::VoronoiExtractor::ClipToHalfPlane(polygon,  1 / a, -b / (a * c),  umax - pu, buffer);
+		cdt::VoronoiExtractor::ClipToHalfPlane(polygon, -1 / a,  b / (a * c), -(umin - pu), buffer);
+		cdt::VoronoiExtractor::ClipToHalfPlane(polygon,  0,  1 / c,  vmax - pv, buffer);
+		cdt::VoronoiExtractor::ClipToHalfPlane(polygon,  0, -1 / c, -(vmin - pv), buffer);
+
+		// Integrate over a fan of triangles from the vertex, with the
+		// area element, relative to the one at the vertex, taken at
+		// the centroid of each triangle.
+		double mass = 0;
+		double mx = 0;
+		double my = 0;
+
+		size_t n = polygon.size() / 2;
+
+		for (size_t j = 0; j < n; j++)
+		{
+			size_t l = (j + 1) % n;
+
+			double x0 = polygon[2 * j];
+			double y0 = polygon[2 * j + 1];
+			double x1 = polygon[2 * l];
+			double y1 = polygon[2 * l + 1];
+
+			double area = (x0 * y1 - x1 * y0) / 2;
+
+			double cx = (x0 + x1) / 3;
+			double cy = (y0 + y1) / 3;
+
+			double dv = cy / c;
+			double du = (cx - b * dv) / a;
+
+			double u = std::min(std::max(pu + du, umin), umax);
+			double v = std::min(std::max(pv + dv, vmin), vmax);
+
+			_surface->GetFirstFundamentalForm(u, v, e, f, g);
+
+			double w = area * sqrt(std::max(0.0, e * g - f * f)) / (a * c);
+
+			mass += w;
+			mx += w * cx;
+			my += w * cy;
+		}
+
+		if (mass <= 0)
+		{
+			return spPoint();
+		}
+
+		// Halve the move until the vertex stays inside the polygon of
+		// its neighbours.
+		double dv = (my / mass) / c;
+		double du = ((mx / mass) - b * dv) / a;
+
+		for (int k = 0; k < 3; k++)
+		{
+			double u = pu + du;
+			double v = pv + dv;
+
+			if ((u == pu) && (v == pv))
+			{
+				break;
+			}
+
+			if (IsInsideStar(vertex, u, v))
+			{
+				SamplePoint::Point pos;
+				_surface->GetPoint(u, v, pos._x, pos._y, pos._z);
+
+				return std::make_shared<SamplePoint>(SamplePoint(u, v, pos));
+			}
+
+			du /= 2;
+			dv /= 2;
+		}
+
+		return spPoint();
+	}
+
+
+	/**
+	 * \fn bool LloydRelaxer::IsMovable(cdt::Vertex* vertex)
+	 *
+	 * \brief Decides whether a vertex can be moved.
+	 *
+	 * \param vertex A vertex of a CDT.
+	 *
+	 * \return The logic value true if the vertex can be moved, and
+	 * the logic value false otherwise.
+	 *
+	 */
+	bool
+		LloydRelaxer::IsMovable(
+			cdt::Vertex* vertex
+		)
+	{
+		cdt::Edge* efirst = vertex->GetEdge();
+		cdt::Edge* e = efirst;
+
+		do
+		{
+			if (!e->GetFace()->IsBounded() || e->IsConstrained())
+			{
+				return false;
+			}
+
+			e = e->OriginNext();
+		} while (e != efirst);
+
+		return true;
+	}
+
+
+	/**
+	 * \fn bool LloydRelaxer::IsInsideStar(cdt::Vertex* vertex, double u, double v)
+	 *
+	 * \brief Decides whether a point lies strictly inside the polygon
+	 * formed by the neighbours of a movable vertex.
+	 *
+	 * \param vertex A movable vertex of a CDT.
+	 * \param u First coordinate of the point.
+	 * \param v Second coordinate of the point.
+	 *
+	 * \return The logic value true if the point lies strictly inside
+	 * the polygon, and the logic value false otherwise.
+	 *
+	 */
+	bool
+		LloydRelaxer::IsInsideStar(
+			cdt::Vertex* vertex,
+			double u,
+			double v
+		)
+	{
+		// The neighbours of the vertex are met in CCW order, so the
+		// point must lie to the left of each edge of their polygon.
+		cdt::Edge* efirst = vertex->GetEdge();
+		cdt::Edge* e = efirst;
+
+		do
+		{
+			spPoint p = e->GetDestination()->GetPoint();
+			spPoint q = e->OriginNext()->GetDestination()->GetPoint();
+
+			double pu = p->GetU() - u;
+			double pv = p->GetV() - v;
+			double qu = q->GetU() - u;
+			double qv = q->GetV() - v;
+
+			if (pu * qv - pv * qu <= 0)
+			{
+				return false;
+			}
+
+			e = e->OriginNext();
+		} while (e != efirst);
+
+		return true;
+	}
+
+}
+
+/** @} */ //end of group class.
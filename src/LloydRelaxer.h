@@ -0,0 +1,242 @@
+/**
+ * \file LloydRelaxer.h
+ *
+ * \brief This file contains the definition of a class that improves
+ * the quality of the CDT of a sample set by moving each sample to the
+ * centroid of its Voronoi cell, as measured on the surface (Lloyd's
+ * relaxation).
+ *
+ * \author
+ * Adelino Afonso e Irene Ginani \n
+ * Universidade Federal do Rio Grande do Norte, \n
+ * Instituto Metr&oacute;pole Digital, \n
+ * Adelino Afonso at imd (dot) ufrn (dot) br, \n
+ * Irene Ginani at imd (dot) ufrn (dot) br
+ *
+ * \version 1.0
+ * \date October 2026
+ *
+ * \attention This program is distributed WITHOUT ANY WARRANTY, and it
+ *            may be freely redistributed under the condition that the
+ *            copyright notices  are not removed,  and no compensation
+ *            is received. Private, research, and institutional use is
+ *            free. Distribution of this  code as part of a commercial
+ *            system  is permissible ONLY  BY DIRECT  ARRANGEMENT WITH
+ *            THE AUTHOR.
+ */
+
+#pragma once
+
+#include "Surface.h"           // Surface
+#include "Cdt.h"               // cdt::CDT
+#include "Vertex.h"            // cdt::Vertex
+
+#include <memory>              // std::shared_ptr
+#include <vector>              // std::vector
+
+
+/**
+ * \defgroup MAT309NameSpace Namespace MAT309.
+ * @{
+ */
+
+/**
+ * \namespace MAT309
+ *
+ * \brief Global namespace for MAT309 software.
+ *
+ */
+
+namespace MAT309
+{
+
+	/**
+	 * \class LloydRelaxer
+	 *
+	 * \brief This class runs Lloyd iterations on the vertices of a
+	 * finished CDT of samples of a surface.  In each iteration, every
+	 * movable vertex is moved to the centroid of its Voronoi cell on
+	 * the surface.  The cell is computed in the parameter domain, with
+	 * distances measured by the first fundamental form at the vertex,
+	 * and its centroid is computed with density sqrt(EG - F^2), the
+	 * surface area element, so that the samples even out on the
+	 * surface rather than on the domain.  Each moved vertex is removed
+	 * from the CDT and re-inserted at its centroid, so the CDT is
+	 * updated locally instead of being rebuilt.
+	 *
+	 * A vertex is movable if it is not on the convex hull and has no
+	 * incident constrained edge.  A move is shortened, or skipped, so
+	 * that the vertex stays inside the polygon formed by its
+	 * neighbours, which keeps the update valid.  The cells, centroids
+	 * and new surface points are computed in parallel; the updates of
+	 * the CDT are applied one at a time.
+	 *
+	 */
+	class LloydRelaxer
+	{
+	public:
+
+		// -----------------------------------------------------------
+		//
+		// Type definitions
+		//
+		// -----------------------------------------------------------
+
+		/**
+		 * \typedef spPoint
+		 *
+		 * \brief Alias for a shared pointer to DtPoint objects.
+		 *
+		 */
+		typedef cdt::DtPoint::spPoint spPoint;
+
+
+		/**
+		 * \typedef spSurface
+		 *
+		 * \brief Alias for a shared pointer to a surface.
+		 *
+		 */
+		typedef std::shared_ptr<Surface> spSurface;
+
+
+	private:
+
+		// -----------------------------------------------------------
+		//
+		// Private data members
+		//
+		// -----------------------------------------------------------
+
+		spSurface _surface;        ///< The surface the samples lie on.
+		size_t _numberOfThreads;   ///< Number of threads (0 means one per hardware thread).
+
+
+	public:
+
+		// -----------------------------------------------------------
+		//
+		// Public methods
+		//
+		// -----------------------------------------------------------
+
+		/**
+		 * \fn LloydRelaxer(const spSurface& surface, size_t numberOfThreads = 0)
+		 *
+		 * \brief Creates an instance of this class.
+		 *
+		 * \param surface The surface the samples lie on.
+		 * \param numberOfThreads Number of threads (0 means one per
+		 * hardware thread).
+		 *
+		 */
+		LloydRelaxer(
+			const spSurface& surface,
+			size_t numberOfThreads = 0
+		)
+			:
+			_surface(surface),
+			_numberOfThreads(numberOfThreads)
+		{
+		}
+
+
+		/**
+		 * \fn size_t Relax(cdt::CDT& cdt, size_t numberOfIterations) const
+		 *
+		 * \brief Runs Lloyd iterations on the vertices of a CDT.  The
+		 * points of the moved vertices are new SamplePoint objects.
+		 *
+		 * \param cdt A finished CDT of samples of the surface.
+		 * \param numberOfIterations The number of iterations.
+		 *
+		 * \return The total number of vertex moves.
+		 *
+		 */
+		size_t
+			Relax(
+				cdt::CDT& cdt,
+				size_t numberOfIterations
+			)
+			const;
+
+
+	private:
+
+		// -----------------------------------------------------------
+		//
+		// Private methods
+		//
+		// -----------------------------------------------------------
+
+		/**
+		 * \fn spPoint ComputeTarget(cdt::Vertex* vertex, std::vector<double>& polygon, std::vector<double>& buffer) const
+		 *
+		 * \brief Computes the point a movable vertex moves to.  The
+		 * cell of the vertex is computed from its neighbours in a frame
+		 * in which the first fundamental form at the vertex is the
+		 * identity, and is clipped to the domain of the surface.
+		 *
+		 * \param vertex A movable vertex of a CDT.
+		 * \param polygon A reference to a scratch array.
+		 * \param buffer A reference to another scratch array.
+		 *
+		 * \return The point the vertex moves to, or a null pointer if
+		 * the vertex does not move.
+		 *
+		 */
+		spPoint
+			ComputeTarget(
+				cdt::Vertex* vertex,
+				std::vector<double>& polygon,
+				std::vector<double>& buffer
+			)
+			const;
+
+
+		/**
+		 * \fn static bool IsMovable(cdt::Vertex* vertex)
+		 *
+		 * \brief Decides whether a vertex can be moved, that is,
+		 * whether it is not on the convex hull and has no incident
+		 * constrained edge.
+		 *
+		 * \param vertex A vertex of a CDT.
+		 *
+		 * \return The logic value true if the vertex can be moved, and
+		 * the logic value false otherwise.
+		 *
+		 */
+		static
+		bool
+			IsMovable(
+				cdt::Vertex* vertex
+			);
+
+
+		/**
+		 * \fn static bool IsInsideStar(cdt::Vertex* vertex, double u, double v)
+		 *
+		 * \brief Decides whether a point lies strictly inside the
+		 * polygon formed by the neighbours of a movable vertex.
+		 *
+		 * \param vertex A movable vertex of a CDT.
+		 * \param u First coordinate of the point.
+		 * \param v Second coordinate of the point.
+		 *
+		 * \return The logic value true if the point lies strictly
+		 * inside the polygon, and the logic value false otherwise.
+		 *
+		 */
+		static
+		bool
+			IsInsideStar(
+				cdt::Vertex* vertex,
+				double u,
+				double v
+			);
+	};
+
+}
+
+/** @} */ //end of group class.
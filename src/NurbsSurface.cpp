@@ -0,0 +1,878 @@
+/**
+ * \file NurbsSurface.cpp
+ *
+ * \brief Implementation of the class NurbsSurface, which represents a
+ * tensor-product rational B-spline (NURBS) surface patch.
+ *
+ * \author
+ * Adelino Afonso e Irene Ginani \n
+ * Universidade Federal do Rio Grande do Norte, \n
+ * Instituto Metr&oacute;pole Digital, \n
+ * Adelino Afonso at imd (dot) ufrn (dot) br, \n
+ * Irene Ginani at imd (dot) ufrn (dot) br
+ *
+ * \version 1.0
+ * \date October 2026
+ *
+ * \attention This program is distributed WITHOUT ANY WARRANTY, and it
+ *            may be freely redistributed under the condition that the
+ *            copyright notices  are not removed,  and no compensation
+ *            is received. Private, research, and institutional use is
+ *            free. Distribution of this  code as part of a commercial
+ *            system  is permissible ONLY  BY DIRECT  ARRANGEMENT WITH
+ *            THE AUTHOR.
+ */
+
+#include "NurbsSurface.h"        // NurbsSurface
+
+#include <algorithm>             // std::min, std::max
+#include <atomic>                // std::atomic
+#include <cmath>                 // sqrt, fabs, std::isfinite
+#include <fstream>               // std::ifstream
+#include <stdexcept>             // std::runtime_error
+
+
+/**
+ * \defgroup MAT309NameSpace Namespace MAT309.
+ * @{
+ */
+
+/**
+ * \namespace MAT309
+ *
+ * \brief Global namespace for MAT309 software.
+ */
+
+namespace MAT309
+{
+
+	namespace
+	{
+
+		/**
+		 * \struct Evaluation
+		 *
+		 * \brief This struct holds the last evaluation of a thread, and
+		 * the knot spans it found, which are tried first by the next
+		 * one.
+		 *
+		 */
+		struct Evaluation
+		{
+			size_t _id;              ///< The number of the evaluated surface (0 means none).
+			double _u;               ///< The first coordinate of the parameter point.
+			double _v;               ///< The second coordinate of the parameter point.
+			double _point[3];        ///< The point on the surface.
+			double _du[3];           ///< The first derivative vector in direction u.
+			double _dv[3];           ///< The first derivative vector in direction v.
+			size_t _spanU;           ///< The knot span along u.
+			size_t _spanV;           ///< The knot span along v.
+		};
+
+
+		thread_local Evaluation lastEvaluation = { 0, 0, 0, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, 0, 0 };
+
+		std::atomic<size_t> numberOfSurfaces(0);
+
+	}
+
+
+	/**
+	 * \fn NurbsSurface::NurbsSurface(size_t degreeU, size_t degreeV, size_t countU, size_t countV, const std::vector<double>& knotsU, const std::vector<double>& knotsV, const std::vector<double>& controlPoints)
+	 *
+	 * \brief Creates an instance of this class.
+	 *
+	 * \param degreeU The degree along u.
+	 * \param degreeV The degree along v.
+	 * \param countU The number of control points along u.
+	 * \param countV The number of control points along v.
+	 * \param knotsU The countU + degreeU + 1 knots along u.
+	 * \param knotsV The countV + degreeV + 1 knots along v.
+	 * \param controlPoints The x, y, z, and weight of each control
+	 * point, the point of indices i along u and j along v at position
+	 * i * countV + j.
+	 *
+	 */
+	NurbsSurface::NurbsSurface(
+		size_t degreeU,
+		size_t degreeV,
+		size_t countU,
+		size_t countV,
+		const std::vector<double>& knotsU,
+		const std::vector<double>& knotsV,
+		const std::vector<double>& controlPoints
+	)
+		:
+		_degreeU(degreeU),
+		_degreeV(degreeV),
+		_countU(countU),
+		_countV(countV),
+		_knotsU(knotsU),
+		_knotsV(knotsV),
+		_controlPoints(4 * countU * countV),
+		_periodicU(false),
+		_periodicV(false),
+		_id(++numberOfSurfaces)
+	{
+		if ((degreeU < 1) || (degreeU > MaxDegree) || (degreeV < 1) || (degreeV > MaxDegree))
+		{
+			throw std::runtime_error("The degrees of a NURBS surface must be between 1 and 9.");
+		}
+
+		if ((countU <= degreeU) || (countV <= degreeV))
+		{
+			throw std::runtime_error("A NURBS surface needs more control points than its degree along each coordinate.");
+		}
+
+		if ((knotsU.size() != countU + degreeU + 1) || (knotsV.size() != countV + degreeV + 1))
+		{
+			throw std::runtime_error("A NURBS surface needs as many knots as control points plus degree plus one along each coordinate.");
+		}
+
+		for (size_t k = 0; k + 1 < knotsU.size(); k++)
+		{
+			if (!std::isfinite(knotsU[k]) || (knotsU[k + 1] < knotsU[k]))
+			{
+				throw std::runtime_error("The knots of a NURBS surface must not decrease.");
+			}
+		}
+
+		for (size_t k = 0; k + 1 < knotsV.size(); k++)
+		{
+			if (!std::isfinite(knotsV[k]) || (knotsV[k + 1] < knotsV[k]))
+			{
+				throw std::runtime_error("The knots of a NURBS surface must not decrease.");
+			}
+		}
+
+		if ((GetUMin() >= GetUMax()) || (GetVMin() >= GetVMax()))
+		{
+			throw std::runtime_error("The domain of a NURBS surface has no area.");
+		}
+
+		if (controlPoints.size() != 4 * countU * countV)
+		{
+			throw std::runtime_error("A NURBS surface needs x, y, z, and a weight for each control point.");
+		}
+
+		// Keep the control points in homogeneous coordinates.
+		double scale = 0;
+
+		for (size_t c = 0; c < countU * countV; c++)
+		{
+			double w = controlPoints[4 * c + 3];
+
+			if (!(w > 0))
+			{
+				throw std::runtime_error("The weights of a NURBS surface must be positive.");
+			}
+
+			for (size_t d = 0; d < 3; d++)
+			{
+				_controlPoints[4 * c + d] = w * controlPoints[4 * c + d];
+				scale = std::max(scale, fabs(controlPoints[4 * c + d]));
+			}
+
+			_controlPoints[4 * c + 3] = w;
+		}
+
+		// The surface closes up along a coordinate if the knots are
+		// clamped, so the sides are the curves of the first and last
+		// rows of control points, and those rows coincide.
+		const double tolerance = 1e-12 * (1 + scale);
+
+		auto Same = [&](size_t a, size_t b)
+		{
+			for (size_t d = 0; d < 4; d++)
+			{
+				if (fabs(_controlPoints[4 * a + d] - _controlPoints[4 * b + d]) > tolerance)
+				{
+					return false;
+				}
+			}
+
+			return true;
+		};
+
+		bool clampedU = (_knotsU[0] == GetUMin()) && (_knotsU[countU + degreeU] == GetUMax());
+		bool clampedV = (_knotsV[0] == GetVMin()) && (_knotsV[countV + degreeV] == GetVMax());
+
+		_periodicU = clampedU;
+
+		for (size_t j = 0; (j < countV) && _periodicU; j++)
+		{
+			_periodicU = Same(j, (countU - 1) * countV + j);
+		}
+
+		_periodicV = clampedV;
+
+		for (size_t i = 0; (i < countU) && _periodicV; i++)
+		{
+			_periodicV = Same(i * countV, i * countV + countV - 1);
+		}
+	}
+
+
+	/**
+	 * \fn NurbsSurface::spNurbsSurface NurbsSurface::Load(const std::string& filename)
+	 *
+	 * \brief Reads a patch from a text file.
+	 *
+	 * \param filename The name of the file.
+	 *
+	 * \return A pointer to the patch.
+	 *
+	 */
+	NurbsSurface::spNurbsSurface
+		NurbsSurface::Load(
+			const std::string& filename
+		)
+	{
+		std::ifstream in(filename);
+
+		if (!in.is_open())
+		{
+			throw std::runtime_error("NURBS file \"" + filename + "\" cannot be opened.");
+		}
+
+		size_t degreeU = 0;
+		size_t degreeV = 0;
+		size_t countU = 0;
+		size_t countV = 0;
+
+		if (!(in >> degreeU >> degreeV >> countU >> countV))
+		{
+			throw std::runtime_error("The NURBS file must start with the two degrees and the two numbers of control points.");
+		}
+
+		if ((degreeU > MaxDegree) || (degreeV > MaxDegree) || (countU > 100000) || (countV > 100000))
+		{
+			throw std::runtime_error("The degrees or the numbers of control points of the NURBS file are too large.");
+		}
+
+		std::vector<double> knotsU(countU + degreeU + 1);
+		std::vector<double> knotsV(countV + degreeV + 1);
+		std::vector<double> controlPoints(4 * countU * countV);
+
+		for (double& knot : knotsU)
+		{
+			if (!(in >> knot))
+			{
+				throw std::runtime_error("The NURBS file is truncated, or has an invalid knot.");
+			}
+		}
+
+		for (double& knot : knotsV)
+		{
+			if (!(in >> knot))
+			{
+				throw std::runtime_error("The NURBS file is truncated, or has an invalid knot.");
+			}
+		}
+
+		for (double& coordinate : controlPoints)
+		{
+			if (!(in >> coordinate) || !std::isfinite(coordinate))
+			{
+				throw std::runtime_error("The NURBS file is truncated, or has an invalid control point.");
+			}
+		}
+
+		return std::make_shared<NurbsSurface>(degreeU, degreeV, countU, countV, knotsU, knotsV, controlPoints);
+	}
+
+
+	/**
+	 * \fn NurbsSurface::spNurbsSurface NurbsSurface::MakeTorus(double majorRadius, double minorRadius)
+	 *
+	 * \brief Creates the exact biquadratic patch of a torus around the
+	 * z axis, which closes up along both coordinates.
+	 *
+	 * \param majorRadius The distance from the axis to the center of
+	 * the tube.
+	 * \param minorRadius The radius of the tube.
+	 *
+	 * \return A pointer to the patch.
+	 *
+	 */
+	NurbsSurface::spNurbsSurface
+		NurbsSurface::MakeTorus(
+			double majorRadius,
+			double minorRadius
+		)
+	{
+		// The nine control points of the unit circle, at the corners
+		// and midpoints of its circumscribed square, and their weights.
+		const double h = sqrt(0.5);
+
+		const double circle[9][3] = {
+			{  1,  0, 1 }, {  1,  1, h }, {  0,  1, 1 },
+			{ -1,  1, h }, { -1,  0, 1 }, { -1, -1, h },
+			{  0, -1, 1 }, {  1, -1, h }, {  1,  0, 1 }
+		};
+
+		const std::vector<double> knots = { 0, 0, 0, 0.25, 0.25, 0.5, 0.5, 0.75, 0.75, 1, 1, 1 };
+
+		// The tube circle is swept around the axis: the control points
+		// of the sweep of a point are those of the circle through it.
+		std::vector<double> controlPoints;
+
+		for (size_t i = 0; i < 9; i++)
+		{
+			for (size_t j = 0; j < 9; j++)
+			{
+				double radius = majorRadius + minorRadius * circle[j][0];
+
+				controlPoints.push_back(radius * circle[i][0]);
+				controlPoints.push_back(radius * circle[i][1]);
+				controlPoints.push_back(minorRadius * circle[j][1]);
+				controlPoints.push_back(circle[i][2] * circle[j][2]);
+			}
+		}
+
+		return std::make_shared<NurbsSurface>(2, 2, 9, 9, knots, knots, controlPoints);
+	}
+
+
+	/**
+	 * \fn void NurbsSurface::GetPoint(double u, double v, double& x, double& y, double& z) const
+	 *
+	 * \brief Computes a point on the surface at a given parameter
+	 * point.
+	 *
+	 * \param u First coordinate of a parameter point.
+	 * \param v Second coordinate of a parameter point.
+	 * \param x A reference to the first coordinate of the point on the
+	 * surface.
+	 * \param y A reference to the second coordinate of the point on the
+	 * surface.
+	 * \param z A reference to the third coordinate of the point on the
+	 * surface.
+	 *
+	 */
+	void
+		NurbsSurface::GetPoint(
+			double u,
+			double v,
+			double& x,
+			double& y,
+			double& z
+		)
+		const
+	{
+		double point[3], du[3], dv[3];
+
+		Evaluate(u, v, point, du, dv);
+
+		x = point[0];
+		y = point[1];
+		z = point[2];
+	}
+
+
+	/**
+	 * \fn void NurbsSurface::GetDu(double u, double v, double& x, double& y, double& z) const
+	 *
+	 * \brief Computes the first derivative vector at a given parameter
+	 * point in direction u.
+	 *
+	 * \param u First coordinate of a parameter point.
+	 * \param v Second coordinate of a parameter point.
+	 * \param x A reference to the first coordinate of the first
+	 * derivative vector in direction \c u.
+	 * \param y A reference to the second coordinate of the first
+	 * derivative vector in direction \c u.
+	 * \param z A reference to the third coordinate of the first
+	 * derivative vector in direction \c u.
+	 *
+	 */
+	void
+		NurbsSurface::GetDu(
+			double u,
+			double v,
+			double& x,
+			double& y,
+			double& z
+		)
+		const
+	{
+		double point[3], du[3], dv[3];
+
+		Evaluate(u, v, point, du, dv);
+
+		x = du[0];
+		y = du[1];
+		z = du[2];
+	}
+
+
+	/**
+	 * \fn void NurbsSurface::GetDv(double u, double v, double& x, double& y, double& z) const
+	 *
+	 * \brief Computes the first derivative vector at a given parameter
+	 * point in direction v.
+	 *
+	 * \param u First coordinate of a parameter point.
+	 * \param v Second coordinate of a parameter point.
+	 * \param x A reference to the first coordinate of the first
+	 * derivative vector in direction \c v.
+	 * \param y A reference to the second coordinate of the first
+	 * derivative vector in direction \c v.
+	 * \param z A reference to the third coordinate of the first
+	 * derivative vector in direction \c v.
+	 *
+	 */
+	void
+		NurbsSurface::GetDv(
+			double u,
+			double v,
+			double& x,
+			double& y,
+			double& z
+		)
+		const
+	{
+		double point[3], du[3], dv[3];
+
+		Evaluate(u, v, point, du, dv);
+
+		x = dv[0];
+		y = dv[1];
+		z = dv[2];
+	}
+
+
+	/**
+	 * \fn void NurbsSurface::GetRow(double v, size_t count, const double* u, double* points, double* du, double* dv) const
+	 *
+	 * \brief Computes the points and the first derivative vectors at a
+	 * row of parameter points sharing their second coordinate.
+	 *
+	 * \param v Second coordinate of the parameter points.
+	 * \param count Number of parameter points.
+	 * \param u An array with the first coordinate of each parameter
+	 * point.
+	 * \param points An array receiving the three coordinates of each
+	 * point on the surface (may be null).
+	 * \param du An array receiving the three coordinates of each first
+	 * derivative vector in direction \c u (may be null).
+	 * \param dv An array receiving the three coordinates of each first
+	 * derivative vector in direction \c v (may be null).
+	 *
+	 */
+	void
+		NurbsSurface::GetRow(
+			double v,
+			size_t count,
+			const double* u,
+			double* points,
+			double* du,
+			double* dv
+		)
+		const
+	{
+		if (count == 0)
+		{
+			return;
+		}
+
+		// The basis functions along v, shared by the whole row.
+		size_t spanV = FindSpan(_knotsV, _degreeV, _countV, v, lastEvaluation._spanV);
+
+		double basisV[MaxDegree + 1], derivativesV[MaxDegree + 1];
+		EvaluateBasis(_knotsV, _degreeV, spanV, v, basisV, derivativesV);
+
+		// The span of each parameter along u, each one tried first
+		// for the next, as the parameters of a row are usually sorted.
+		std::vector<size_t> spansU(count);
+
+		size_t hint = lastEvaluation._spanU;
+		size_t firstSpan = _countU;
+		size_t lastSpan = 0;
+
+		for (size_t k = 0; k < count; k++)
+		{
+			hint = spansU[k] = FindSpan(_knotsU, _degreeU, _countU, u[k], hint);
+			firstSpan = std::min(firstSpan, hint);
+			lastSpan = std::max(lastSpan, hint);
+		}
+
+		// The control net contracted along v, for the rows of control
+		// points the spans visit: the homogeneous control points of the
+		// curve of the row, and of its derivative along v.
+		const size_t firstRow = firstSpan - _degreeU;
+		const size_t numberOfRows = lastSpan + 1 - firstRow;
+
+		std::vector<double> curve(4 * numberOfRows, 0);
+		std::vector<double> curveV(4 * numberOfRows, 0);
+
+		for (size_t r = 0; r < numberOfRows; r++)
+		{
+			const double* row = &_controlPoints[4 * ((firstRow + r) * _countV + spanV - _degreeV)];
+
+			for (size_t l = 0; l <= _degreeV; l++)
+			{
+				for (size_t d = 0; d < 4; d++)
+				{
+					curve[4 * r + d] += basisV[l] * row[4 * l + d];
+					curveV[4 * r + d] += derivativesV[l] * row[4 * l + d];
+				}
+			}
+		}
+
+		// Each point of the row is a point of a curve.
+		for (size_t k = 0; k < count; k++)
+		{
+			double basisU[MaxDegree + 1], derivativesU[MaxDegree + 1];
+			EvaluateBasis(_knotsU, _degreeU, spansU[k], u[k], basisU, derivativesU);
+
+			double a[4] = { 0, 0, 0, 0 };
+			double au[4] = { 0, 0, 0, 0 };
+			double av[4] = { 0, 0, 0, 0 };
+
+			const size_t first = spansU[k] - _degreeU - firstRow;
+
+			for (size_t l = 0; l <= _degreeU; l++)
+			{
+				for (size_t d = 0; d < 4; d++)
+				{
+					a[d] += basisU[l] * curve[4 * (first + l) + d];
+					au[d] += derivativesU[l] * curve[4 * (first + l) + d];
+					av[d] += basisU[l] * curveV[4 * (first + l) + d];
+				}
+			}
+
+			for (size_t d = 0; d < 3; d++)
+			{
+				double p = a[d] / a[3];
+
+				if (points != nullptr)
+				{
+					points[3 * k + d] = p;
+				}
+
+				if (du != nullptr)
+				{
+					du[3 * k + d] = (au[d] - au[3] * p) / a[3];
+				}
+
+				if (dv != nullptr)
+				{
+					dv[3 * k + d] = (av[d] - av[3] * p) / a[3];
+				}
+			}
+		}
+
+		lastEvaluation._spanU = spansU[count - 1];
+		lastEvaluation._spanV = spanV;
+
+		return;
+	}
+
+
+	/**
+	 * \fn void NurbsSurface::GetFirstFundamentalForm(double u, double v, double& e, double& f, double& g) const
+	 *
+	 * \brief Computes the coefficients of the first fundamental form at
+	 * a given parameter point, from both derivative vectors computed in
+	 * a single evaluation.
+	 *
+	 * \param u First coordinate of a parameter point.
+	 * \param v Second coordinate of a parameter point.
+	 * \param e A reference to the dot product of the derivative in
+	 * direction \c u with itself.
+	 * \param f A reference to the dot product of the derivatives in
+	 * directions \c u and \c v.
+	 * \param g A reference to the dot product of the derivative in
+	 * direction \c v with itself.
+	 *
+	 */
+	void
+		NurbsSurface::GetFirstFundamentalForm(
+			double u,
+			double v,
+			double& e,
+			double& f,
+			double& g
+		)
+		const
+	{
+		double point[3], du[3], dv[3];
+
+		Evaluate(u, v, point, du, dv);
+
+		e = du[0] * du[0] + du[1] * du[1] + du[2] * du[2];
+		f = du[0] * dv[0] + du[1] * dv[1] + du[2] * dv[2];
+		g = dv[0] * dv[0] + dv[1] * dv[1] + dv[2] * dv[2];
+	}
+
+
+	/**
+	 * \fn void NurbsSurface::Evaluate(double u, double v, double* point, double* du, double* dv) const
+	 *
+	 * \brief Computes the point and both first derivative vectors at a
+	 * parameter point, or takes them from the last evaluation of the
+	 * calling thread if it was at the same parameter point of this
+	 * surface.
+	 *
+	 * \param u First coordinate of a parameter point.
+	 * \param v Second coordinate of a parameter point.
+	 * \param point An array receiving the three coordinates of the
+	 * point.
+	 * \param du An array receiving the three coordinates of the first
+	 * derivative vector in direction \c u.
+	 * \param dv An array receiving the three coordinates of the first
+	 * derivative vector in direction \c v.
+	 *
+	 */
+	void
+		NurbsSurface::Evaluate(
+			double u,
+			double v,
+			double* point,
+			double* du,
+			double* dv
+		)
+		const
+	{
+		Evaluation& last = lastEvaluation;
+
+		if ((last._id != _id) || (last._u != u) || (last._v != v))
+		{
+			size_t spanU = FindSpan(_knotsU, _degreeU, _countU, u, last._spanU);
+			size_t spanV = FindSpan(_knotsV, _degreeV, _countV, v, last._spanV);
+
+			double basisU[MaxDegree + 1], derivativesU[MaxDegree + 1];
+			double basisV[MaxDegree + 1], derivativesV[MaxDegree + 1];
+
+			EvaluateBasis(_knotsU, _degreeU, spanU, u, basisU, derivativesU);
+			EvaluateBasis(_knotsV, _degreeV, spanV, v, basisV, derivativesV);
+
+			// The homogeneous point and its derivatives, in one pass
+			// over the control points.
+			double a[4] = { 0, 0, 0, 0 };
+			double au[4] = { 0, 0, 0, 0 };
+			double av[4] = { 0, 0, 0, 0 };
+
+			for (size_t k = 0; k <= _degreeU; k++)
+			{
+				const double* row = &_controlPoints[4 * ((spanU - _degreeU + k) * _countV + spanV - _degreeV)];
+
+				double b[4] = { 0, 0, 0, 0 };
+				double bv[4] = { 0, 0, 0, 0 };
+
+				for (size_t l = 0; l <= _degreeV; l++)
+				{
+					for (size_t d = 0; d < 4; d++)
+					{
+						b[d] += basisV[l] * row[4 * l + d];
+						bv[d] += derivativesV[l] * row[4 * l + d];
+					}
+				}
+
+				for (size_t d = 0; d < 4; d++)
+				{
+					a[d] += basisU[k] * b[d];
+					au[d] += derivativesU[k] * b[d];
+					av[d] += basisU[k] * bv[d];
+				}
+			}
+
+			// The rational point and its derivatives, by the quotient
+			// rule.
+			for (size_t d = 0; d < 3; d++)
+			{
+				last._point[d] = a[d] / a[3];
+				last._du[d] = (au[d] - au[3] * last._point[d]) / a[3];
+				last._dv[d] = (av[d] - av[3] * last._point[d]) / a[3];
+			}
+
+			last._id = _id;
+			last._u = u;
+			last._v = v;
+			last._spanU = spanU;
+			last._spanV = spanV;
+		}
+
+		for (size_t d = 0; d < 3; d++)
+		{
+			point[d] = last._point[d];
+			du[d] = last._du[d];
+			dv[d] = last._dv[d];
+		}
+
+		return;
+	}
+
+
+	/**
+	 * \fn size_t NurbsSurface::FindSpan(const std::vector<double>& knots, size_t degree, size_t count, double t, size_t hint)
+	 *
+	 * \brief Finds the knot span holding a parameter, clamping the
+	 * parameter to the domain.
+	 *
+	 * \param knots The knots.
+	 * \param degree The degree.
+	 * \param count The number of control points.
+	 * \param t The parameter.
+	 * \param hint A span likely to hold the parameter.
+	 *
+	 * \return The index of the span.
+	 *
+	 */
+	size_t
+		NurbsSurface::FindSpan(
+			const std::vector<double>& knots,
+			size_t degree,
+			size_t count,
+			double t,
+			size_t hint
+		)
+	{
+		// The last span is closed, and parameters outside the domain
+		// fall in the first or the last span.
+		if (t >= knots[count])
+		{
+			size_t span = count - 1;
+
+			while (knots[span] == knots[span + 1])
+			{
+				span--;
+			}
+
+			return span;
+		}
+
+		if (t <= knots[degree])
+		{
+			size_t span = degree;
+
+			while (knots[span] == knots[span + 1])
+			{
+				span++;
+			}
+
+			return span;
+		}
+
+		// The span of the last query and its neighbours.
+		if ((hint >= degree) && (hint < count))
+		{
+			if ((knots[hint] <= t) && (t < knots[hint + 1]))
+			{
+				return hint;
+			}
+
+			if ((hint + 1 < count) && (knots[hint + 1] <= t) && (t < knots[hint + 2]))
+			{
+				return hint + 1;
+			}
+
+			if ((hint > degree) && (knots[hint - 1] <= t) && (t < knots[hint]))
+			{
+				return hint - 1;
+			}
+		}
+
+		size_t low = degree;
+		size_t high = count;
+
+		// knots[low] <= t < knots[high]
+		while (high - low > 1)
+		{
+			size_t middle = (low + high) / 2;
+
+			if (t < knots[middle])
+			{
+				high = middle;
+			}
+			else
+			{
+				low = middle;
+			}
+		}
+
+		return low;
+	}
+
+
+	/**
+	 * \fn void NurbsSurface::EvaluateBasis(const std::vector<double>& knots, size_t degree, size_t span, double t, double* basis, double* derivatives)
+	 *
+	 * \brief Computes the basis functions that do not vanish on a knot
+	 * span, and their first derivatives, in a single pass.
+	 *
+	 * \param knots The knots.
+	 * \param degree The degree.
+	 * \param span The index of the knot span holding the parameter.
+	 * \param t The parameter.
+	 * \param basis An array receiving the values of the basis functions
+	 * of indices span - degree to span.
+	 * \param derivatives An array receiving their first derivatives.
+	 *
+	 */
+	void
+		NurbsSurface::EvaluateBasis(
+			const std::vector<double>& knots,
+			size_t degree,
+			size_t span,
+			double t,
+			double* basis,
+			double* derivatives
+		)
+	{
+		// The triangle of the basis functions of each degree, in the
+		// upper part, and of the knot differences, in the lower part.
+		double table[MaxDegree + 1][MaxDegree + 1];
+		double left[MaxDegree + 1];
+		double right[MaxDegree + 1];
+
+		table[0][0] = 1;
+
+		for (size_t j = 1; j <= degree; j++)
+		{
+			left[j] = t - knots[span + 1 - j];
+			right[j] = knots[span + j] - t;
+
+			double saved = 0;
+
+			for (size_t r = 0; r < j; r++)
+			{
+				table[j][r] = right[r + 1] + left[j - r];
+
+				double temp = table[r][j - 1] / table[j][r];
+
+				table[r][j] = saved + right[r + 1] * temp;
+				saved = left[j - r] * temp;
+			}
+
+			table[j][j] = saved;
+		}
+
+		// The derivative of each function of the degree from the two
+		// functions of one degree less it is made of.
+		for (size_t r = 0; r <= degree; r++)
+		{
+			basis[r] = table[r][degree];
+
+			double d = 0;
+
+			if (r > 0)
+			{
+				d += table[r - 1][degree - 1] / table[degree][r - 1];
+			}
+
+			if (r < degree)
+			{
+				d -= table[r][degree - 1] / table[degree][r];
+			}
+
+			derivatives[r] = degree * d;
+		}
+
+		return;
+	}
+
+}
+
+/** @} */ //end of group class.
@@ -0,0 +1,540 @@
+/**
+ * \file NurbsSurface.h
+ *
+ * \brief This file contains the definition of a class to represent a
+ * tensor-product rational B-spline (NURBS) surface patch.
+ *
+ * \author
+ * Adelino Afonso e Irene Ginani \n
+ * Universidade Federal do Rio Grande do Norte, \n
+ * Instituto Metr&oacute;pole Digital, \n
+ * Adelino Afonso at imd (dot) ufrn (dot) br, \n
+ * Irene Ginani at imd (dot) ufrn (dot) br
+ *
+ * \version 1.0
+ * \date October 2026
+ *
+ * \attention This program is distributed WITHOUT ANY WARRANTY, and it
+ *            may be freely redistributed under the condition that the
+ *            copyright notices  are not removed,  and no compensation
+ *            is received. Private, research, and institutional use is
+ *            free. Distribution of this  code as part of a commercial
+ *            system  is permissible ONLY  BY DIRECT  ARRANGEMENT WITH
+ *            THE AUTHOR.
+ */
+
+#pragma once
+
+#include "Surface.h"           // Surface
+
+#include <memory>              // std::shared_ptr
+#include <string>              // std::string
+#include <vector>              // std::vector
+
+
+/**
+ * \defgroup MAT309NameSpace Namespace MAT309.
+ * @{
+ */
+
+/**
+ * \namespace MAT309
+ *
+ * \brief Global namespace for MAT309 software.
+ *
+ */
+
+namespace MAT309
+{
+
+	/**
+	 * \class NurbsSurface
+	 *
+	 * \brief This class represents a tensor-product rational B-spline
+	 * (NURBS) surface patch, given by its degrees, its clamped knot
+	 * vectors, and its net of weighted control points.  The domain is
+	 * the rectangle spanned by the knots where the basis functions sum
+	 * to one.  The surface is periodic along a coordinate when the
+	 * first and last rows of control points along it coincide.
+	 *
+	 * The knot span of a parameter is found by binary search, after
+	 * trying the span of the last query of the same thread and its
+	 * neighbours, which nearby queries hit.  The basis functions and
+	 * their derivatives are computed together (de Boor and Cox), and a
+	 * point and both first derivative vectors come from a single pass
+	 * over the control points.  Each thread keeps its last evaluation,
+	 * so GetPoint(), GetDu(), and GetDv() at the same parameter point
+	 * share their work.  GetRow() contracts the control net along v
+	 * once per row, so each point of the row costs as much as a point
+	 * of a curve.
+	 *
+	 * A patch is read from a text file holding the two degrees,
+	 * the numbers of control points along u and v, the knots along u
+	 * and along v, and then x, y, z, and the weight of each control
+	 * point, the points sharing their index along u being consecutive.
+	 *
+	 */
+	class NurbsSurface : public Surface
+	{
+	public:
+
+		// -----------------------------------------------------------
+		//
+		// Type definitions
+		//
+		// -----------------------------------------------------------
+
+		/**
+		 * \typedef spNurbsSurface
+		 *
+		 * \brief Alias for a shared pointer to NurbsSurface objects.
+		 *
+		 */
+		typedef std::shared_ptr<NurbsSurface> spNurbsSurface;
+
+
+		// -----------------------------------------------------------
+		//
+		// Constants
+		//
+		// -----------------------------------------------------------
+
+		static const size_t MaxDegree = 9;    ///< The largest degree along either coordinate.
+
+
+	private:
+
+		// -----------------------------------------------------------
+		//
+		// Private data members
+		//
+		// -----------------------------------------------------------
+
+		size_t _degreeU;                      ///< The degree along u.
+		size_t _degreeV;                      ///< The degree along v.
+		size_t _countU;                       ///< The number of control points along u.
+		size_t _countV;                       ///< The number of control points along v.
+		std::vector<double> _knotsU;          ///< The knots along u.
+		std::vector<double> _knotsV;          ///< The knots along v.
+		std::vector<double> _controlPoints;   ///< The homogeneous coordinates (w x, w y, w z, w) of each control point, the row of index i along u first.
+		bool _periodicU;                      ///< Whether the surface closes up along u.
+		bool _periodicV;                      ///< Whether the surface closes up along v.
+		size_t _id;                           ///< A number telling this surface apart in the evaluations kept by each thread.
+
+
+	public:
+
+		// -----------------------------------------------------------
+		//
+		// Public methods
+		//
+		// -----------------------------------------------------------
+
+		/**
+		 * \fn NurbsSurface(size_t degreeU, size_t degreeV, size_t countU, size_t countV, const std::vector<double>& knotsU, const std::vector<double>& knotsV, const std::vector<double>& controlPoints)
+		 *
+		 * \brief Creates an instance of this class.
+		 *
+		 * \param degreeU The degree along u.
+		 * \param degreeV The degree along v.
+		 * \param countU The number of control points along u.
+		 * \param countV The number of control points along v.
+		 * \param knotsU The countU + degreeU + 1 knots along u.
+		 * \param knotsV The countV + degreeV + 1 knots along v.
+		 * \param controlPoints The x, y, z, and weight of each control
+		 * point, the point of indices i along u and j along v at
+		 * position i * countV + j.
+		 *
+		 */
+		NurbsSurface(
+			size_t degreeU,
+			size_t degreeV,
+			size_t countU,
+			size_t countV,
+			const std::vector<double>& knotsU,
+			const std::vector<double>& knotsV,
+			const std::vector<double>& controlPoints
+		);
+
+
+		/**
+		 * \fn virtual ~NurbsSurface()
+		 *
+		 * \brief  Releases the  memory held  by an  instance of  this
+		 * class.
+		 */
+		virtual ~NurbsSurface()
+		{
+		}
+
+
+		/**
+		 * \fn static spNurbsSurface Load(const std::string& filename)
+		 *
+		 * \brief Reads a patch from a text file.
+		 *
+		 * \param filename The name of the file.
+		 *
+		 * \return A pointer to the patch.
+		 *
+		 */
+		static spNurbsSurface
+			Load(
+				const std::string& filename
+			);
+
+
+		/**
+		 * \fn static spNurbsSurface MakeTorus(double majorRadius, double minorRadius)
+		 *
+		 * \brief Creates the exact biquadratic patch of a torus around
+		 * the z axis, which closes up along both coordinates.
+		 *
+		 * \param majorRadius The distance from the axis to the center
+		 * of the tube.
+		 * \param minorRadius The radius of the tube.
+		 *
+		 * \return A pointer to the patch.
+		 *
+		 */
+		static spNurbsSurface
+			MakeTorus(
+				double majorRadius,
+				double minorRadius
+			);
+
+
+		/**
+		 * \fn double GetUMin() const
+		 *
+		 * \brief Returns the lower bound  for the first coordinate of
+		 * a domain point.
+		 *
+		 * \return  The lower  bound  for the  first  coordinate of  a
+		 * domain point.
+		 *
+		 */
+		double GetUMin() const
+		{
+			return _knotsU[_degreeU];
+		}
+
+
+		/**
+		 * \fn double GetUMax() const
+		 *
+		 * \brief Returns the upper bound  for the first coordinate of
+		 * a domain point.
+		 *
+		 * \return  The upper  bound  for the  first  coordinate of  a
+		 * domain point.
+		 *
+		 */
+		double GetUMax() const
+		{
+			return _knotsU[_countU];
+		}
+
+
+		/**
+		 * \fn double GetVMin() const
+		 *
+		 * \brief Returns the lower bound  for the second coordinate of
+		 * a domain point.
+		 *
+		 * \return  The lower  bound for  the second  coordinate of  a
+		 * domain point.
+		 *
+		 */
+		double GetVMin() const
+		{
+			return _knotsV[_degreeV];
+		}
+
+
+		/**
+		 * \fn double GetVMax() const
+		 *
+		 * \brief Returns the upper bound for the second coordinate of
+		 * a domain point.
+		 *
+		 * \return  The upper  bound for  the second  coordinate of  a
+		 * domain point.
+		 *
+		 */
+		double GetVMax() const
+		{
+			return _knotsV[_countV];
+		}
+
+
+		/**
+		 * \fn bool IsPeriodicInU() const
+		 *
+		 * \brief Tells whether the surface closes up along the first
+		 * coordinate, that is, whether the first and last rows of
+		 * control points along it coincide.
+		 *
+		 * \return True if the surface closes up along u, and false
+		 * otherwise.
+		 *
+		 */
+		bool IsPeriodicInU() const
+		{
+			return _periodicU;
+		}
+
+
+		/**
+		 * \fn bool IsPeriodicInV() const
+		 *
+		 * \brief Tells whether the surface closes up along the second
+		 * coordinate, that is, whether the first and last rows of
+		 * control points along it coincide.
+		 *
+		 * \return True if the surface closes up along v, and false
+		 * otherwise.
+		 *
+		 */
+		bool IsPeriodicInV() const
+		{
+			return _periodicV;
+		}
+
+
+		/**
+		 * \fn void GetPoint(double u, double v, double& x, double& y, double& z) const
+		 *
+		 * \brief Computes a point on the surface at a given parameter
+		 * point.
+		 *
+		 * \param u First coordinate of a parameter point.
+		 * \param v Second coordinate of a parameter point.
+		 * \param x A  reference to the first coordinate  of the point
+		 * on the surface.
+		 * \param y A reference to  the second coordinate of the point
+		 * on the surface.
+		 * \param z A  reference to the third coordinate  of the point
+		 * on the surface.
+		 *
+		 */
+		void
+		    GetPoint(
+				double u,
+				double v,
+				double& x,
+				double& y,
+				double& z
+			)
+		    const;
+
+
+		/**
+		 * \fn void GetDu(double u, double v, double& x, double& y, double& z) const
+		 *
+		 * \brief  Computes the  first  derivative vector  at a  given
+		 * parameter point in direction u.
+		 *
+		 * \param u First coordinate of a parameter point.
+		 * \param v Second coordinate of a parameter point.
+		 * \param x A  reference to the first coordinate  of the first
+		 * derivative vector in direction \c u.
+		 * \param y A reference to  the second coordinate of the first
+		 * derivative vector in direction \c u.
+		 * \param z A  reference to the third coordinate  of the first
+		 * derivative vector in direction \c u.
+		 *
+		 */
+		void
+		    GetDu(
+				double u,
+				double v,
+				double& x,
+				double& y,
+				double& z
+			)
+		    const;
+
+
+		/**
+		 * \fn void GetDv(double u, double v, double& x, double& y, double& z) const
+		 *
+		 * \brief  Computes the  first  derivative vector  at a  given
+		 * parameter point in direction v.
+		 *
+		 * \param u First coordinate of a parameter point.
+		 * \param v Second coordinate of a parameter point.
+		 * \param x A  reference to the first coordinate  of the first
+		 * derivative vector in direction \c v.
+		 * \param y A reference to  the second coordinate of the first
+		 * derivative vector in direction \c v.
+		 * \param z A  reference to the third coordinate  of the first
+		 * derivative vector in direction \c v.
+		 *
+		 */
+		void
+		    GetDv(
+				double u,
+				double v,
+				double& x,
+				double& y,
+				double& z
+			)
+		    const;
+
+
+		/**
+		 * \fn void GetRow(double v, size_t count, const double* u, double* points, double* du, double* dv) const
+		 *
+		 * \brief Computes the points and the first derivative vectors
+		 * at a row of parameter points sharing their second coordinate.
+		 * The basis functions along v are computed once, and the control
+		 * net is contracted along v once, for the spans the row visits.
+		 *
+		 * \param v Second coordinate of the parameter points.
+		 * \param count Number of parameter points.
+		 * \param u An array with the first coordinate of each
+		 * parameter point.
+		 * \param points An array receiving the three coordinates of
+		 * each point on the surface (may be null).
+		 * \param du An array receiving the three coordinates of each
+		 * first derivative vector in direction \c u (may be null).
+		 * \param dv An array receiving the three coordinates of each
+		 * first derivative vector in direction \c v (may be null).
+		 *
+		 */
+		void
+		    GetRow(
+				double v,
+				size_t count,
+				const double* u,
+				double* points,
+				double* du,
+				double* dv
+			)
+		    const;
+
+
+		/**
+		 * \fn void GetFirstFundamentalForm(double u, double v, double& e, double& f, double& g) const
+		 *
+		 * \brief Computes the coefficients  of the first fundamental
+		 * form  at  a given  parameter  point, from both derivative
+		 * vectors computed in a single evaluation.
+		 *
+		 * \param u First coordinate of a parameter point.
+		 * \param v Second coordinate of a parameter point.
+		 * \param e A reference to the dot product of the derivative in
+		 * direction \c u with itself.
+		 * \param f A reference to the dot product of the derivatives in
+		 * directions \c u and \c v.
+		 * \param g A reference to the dot product of the derivative in
+		 * direction \c v with itself.
+		 *
+		 */
+		void
+		    GetFirstFundamentalForm(
+				double u,
+				double v,
+				double& e,
+				double& f,
+				double& g
+			)
+		    const;
+
+
+	private:
+
+		// -----------------------------------------------------------
+		//
+		// Private methods
+		//
+		// -----------------------------------------------------------
+
+		/**
+		 * \fn void Evaluate(double u, double v, double* point, double* du, double* dv) const
+		 *
+		 * \brief Computes the point and both first derivative vectors
+		 * at a parameter point, or takes them from the last evaluation
+		 * of the calling thread if it was at the same parameter point
+		 * of this surface.
+		 *
+		 * \param u First coordinate of a parameter point.
+		 * \param v Second coordinate of a parameter point.
+		 * \param point An array receiving the three coordinates of the
+		 * point.
+		 * \param du An array receiving the three coordinates of the
+		 * first derivative vector in direction \c u.
+		 * \param dv An array receiving the three coordinates of the
+		 * first derivative vector in direction \c v.
+		 *
+		 */
+		void
+			Evaluate(
+				double u,
+				double v,
+				double* point,
+				double* du,
+				double* dv
+			)
+			const;
+
+
+		/**
+		 * \fn static size_t FindSpan(const std::vector<double>& knots, size_t degree, size_t count, double t, size_t hint)
+		 *
+		 * \brief Finds the knot span holding a parameter, that is, the
+		 * index k such that knots[k] <= t < knots[k + 1], clamping the
+		 * parameter to the domain.  The span given as a hint and its
+		 * neighbours are tried before the binary search.
+		 *
+		 * \param knots The knots.
+		 * \param degree The degree.
+		 * \param count The number of control points.
+		 * \param t The parameter.
+		 * \param hint A span likely to hold the parameter.
+		 *
+		 * \return The index of the span.
+		 *
+		 */
+		static size_t
+			FindSpan(
+				const std::vector<double>& knots,
+				size_t degree,
+				size_t count,
+				double t,
+				size_t hint
+			);
+
+
+		/**
+		 * \fn static void EvaluateBasis(const std::vector<double>& knots, size_t degree, size_t span, double t, double* basis, double* derivatives)
+		 *
+		 * \brief Computes the degree + 1 basis functions that do not
+		 * vanish on a knot span, and their first derivatives, in a
+		 * single pass.
+		 *
+		 * \param knots The knots.
+		 * \param degree The degree.
+		 * \param span The index of the knot span holding the parameter.
+		 * \param t The parameter.
+		 * \param basis An array receiving the values of the basis
+		 * functions of indices span - degree to span.
+		 * \param derivatives An array receiving their first
+		 * derivatives.
+		 *
+		 */
+		static void
+			EvaluateBasis(
+				const std::vector<double>& knots,
+				size_t degree,
+				size_t span,
+				double t,
+				double* basis,
+				double* derivatives
+			);
+	};
+
+}
+
+/** @} */ //end of group class.
@@ -0,0 +1,640 @@
+/**
+ * \file OffReader.cpp
+ *
+ * \brief Implementation of the class OffReader, which reads triangle
+ * meshes from memory-mapped OFF files.
+ *
+ * \author
+ * Adelino Afonso e Irene Ginani \n
+ * Universidade Federal do Rio Grande do Norte, \n
+ * Instituto Metr&oacute;pole Digital, \n
+ * Adelino Afonso at imd (dot) ufrn (dot) br, \n
+ * Irene Ginani at imd (dot) ufrn (dot) br
+ *
+ * \version 1.0
+ * \date October 2026
+ *
+ * \attention This program is distributed WITHOUT ANY WARRANTY, and it
+ *            may be freely redistributed under the condition that the
+ *            copyright notices  are not removed,  and no compensation
+ *            is received. Private, research, and institutional use is
+ *            free. Distribution of this  code as part of a commercial
+ *            system  is permissible ONLY  BY DIRECT  ARRANGEMENT WITH
+ *            THE AUTHOR.
+ */
+
+#include "OffReader.h"     // OffReader
+#include "SamplePoint.h"   // SamplePoint
+#include "Parallel.h"      // ParallelFor
+
+#include <algorithm>       // std::min, std::max
+#include <cctype>          // isspace
+#include <cmath>           // sqrt
+#include <cstdlib>         // strtod
+#include <cstring>         // memchr, strncmp
+#include <stdexcept>       // std::runtime_error
+
+#include <fcntl.h>         // open
+#include <sys/mman.h>      // mmap, munmap, madvise
+#include <sys/stat.h>      // fstat
+#include <unistd.h>        // close
+
+
+/**
+ * \defgroup MAT309NameSpace Namespace MAT309.
+ * @{
+ */
+
+/**
+ * \namespace MAT309
+ *
+ * \brief Global namespace for MAT309 software.
+ */
+
+namespace MAT309
+{
+
+	/**
+	 * \fn void OffReader::Read(const std::string& filename, OffMesh& mesh)
+	 *
+	 * \brief Reads an OFF or STOFF file. Only triangular faces are
+	 * accepted.
+	 *
+	 * \param filename The name of the file to be read.
+	 * \param mesh A reference to the mesh read from the file.
+	 *
+	 */
+	void
+		OffReader::Read(
+			const std::string& filename,
+			OffMesh& mesh
+		)
+	{
+		int fd = open(filename.c_str(), O_RDONLY);
+
+		if (fd < 0)
+		{
+			throw std::runtime_error("Input file cannot be opened.");
+		}
+
+		struct stat info;
+
+		if ((fstat(fd, &info) != 0) || (info.st_size == 0))
+		{
+			close(fd);
+			throw std::runtime_error("Input file is empty or cannot be inspected.");
+		}
+
+		size_t size = size_t(info.st_size);
+
+		void* data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+		// The mapping keeps the file alive, so the descriptor is no
+		// longer needed.
+		close(fd);
+
+		if (data == MAP_FAILED)
+		{
+			throw std::runtime_error("Input file cannot be mapped into memory.");
+		}
+
+		// The whole file is read once from beginning to end.  The
+		// advice values are not flags, so each is given on its own.
+		madvise(data, size, MADV_SEQUENTIAL);
+		madvise(data, size, MADV_WILLNEED);
+
+		try
+		{
+			Parse(static_cast<const char*>(data), size, mesh);
+		}
+		catch (...)
+		{
+			munmap(data, size);
+			throw;
+		}
+
+		munmap(data, size);
+
+		return;
+	}
+
+
+	/**
+	 * \fn void OffReader::GetSamplePoints(const OffMesh& mesh, size_t& numberOfPoints, std::vector<spPoint>& points) const
+	 *
+	 * \brief Turns the vertices of a mesh read from an STOFF file into
+	 * sample points.
+	 *
+	 * \param mesh A mesh whose vertices have parameter coordinates.
+	 * \param numberOfPoints A reference to the number of sample points.
+	 * \param points A reference to an array of sample points.
+	 *
+	 */
+	void
+		OffReader::GetSamplePoints(
+			const OffMesh& mesh,
+			size_t& numberOfPoints,
+			std::vector<spPoint>& points
+		)
+		const
+	{
+		if (!mesh._hasParameters)
+		{
+			throw std::runtime_error("The sample file has no parameter coordinates (an STOFF file is expected).");
+		}
+
+		points.clear();
+		points.reserve(mesh._numberOfVertices);
+
+		for (size_t i = 0; i < mesh._numberOfVertices; i++)
+		{
+			SamplePoint::Point pos(
+				mesh._coordinates[3 * i],
+				mesh._coordinates[3 * i + 1],
+				mesh._coordinates[3 * i + 2]
+			);
+
+			points.push_back(
+				std::make_shared<SamplePoint>(
+					mesh._parameters[2 * i],
+					mesh._parameters[2 * i + 1],
+					pos
+				)
+			);
+		}
+
+		numberOfPoints = points.size();
+
+		return;
+	}
+
+
+	/**
+	 * \fn bool OffReader::Compare(const OffMesh& mesh, const OffMesh& golden, double tolerance, double& maxDeviation, size_t& numberOfMismatchedTriangles) const
+	 *
+	 * \brief Compares a mesh against a golden (reference) mesh, index
+	 * by index.
+	 *
+	 * \param mesh The mesh to be checked.
+	 * \param golden The reference mesh.
+	 * \param tolerance The largest distance allowed between two
+	 * corresponding vertices.
+	 * \param maxDeviation A reference to the largest distance found
+	 * between two corresponding vertices.
+	 * \param numberOfMismatchedTriangles A reference to the number of
+	 * triangles whose vertex indices differ.
+	 *
+	 * \return The Boolean value true if the meshes match.
+	 *
+	 */
+	bool
+		OffReader::Compare(
+			const OffMesh& mesh,
+			const OffMesh& golden,
+			double tolerance,
+			double& maxDeviation,
+			size_t& numberOfMismatchedTriangles
+		)
+		const
+	{
+		maxDeviation = 0;
+		numberOfMismatchedTriangles = 0;
+
+		size_t nv = std::min(mesh._numberOfVertices, golden._numberOfVertices);
+
+		for (size_t i = 0; i < nv; i++)
+		{
+			double dx = mesh._coordinates[3 * i    ] - golden._coordinates[3 * i    ];
+			double dy = mesh._coordinates[3 * i + 1] - golden._coordinates[3 * i + 1];
+			double dz = mesh._coordinates[3 * i + 2] - golden._coordinates[3 * i + 2];
+
+			double d = sqrt(dx * dx + dy * dy + dz * dz);
+
+			if (d > maxDeviation)
+			{
+				maxDeviation = d;
+			}
+		}
+
+		size_t nt = std::min(mesh._numberOfTriangles, golden._numberOfTriangles);
+
+		for (size_t i = 0; i < 3 * nt; i += 3)
+		{
+			if (
+				(mesh._triangles[i    ] != golden._triangles[i    ]) ||
+				(mesh._triangles[i + 1] != golden._triangles[i + 1]) ||
+				(mesh._triangles[i + 2] != golden._triangles[i + 2])
+			   )
+			{
+				++numberOfMismatchedTriangles;
+			}
+		}
+
+		// Triangles missing from either mesh count as mismatches.
+		numberOfMismatchedTriangles += std::max(mesh._numberOfTriangles, golden._numberOfTriangles) - nt;
+
+		return
+			(mesh._numberOfVertices == golden._numberOfVertices) &&
+			(numberOfMismatchedTriangles == 0) &&
+			(maxDeviation <= tolerance);
+	}
+
+
+	/**
+	 * \fn void OffReader::Parse(const char* data, size_t size, OffMesh& mesh) const
+	 *
+	 * \brief Parses the contents of an OFF file held in memory.
+	 *
+	 * \param data A pointer to the first character of the file.
+	 * \param size The number of characters of the file.
+	 * \param mesh A reference to the mesh read from the file.
+	 *
+	 */
+	void
+		OffReader::Parse(
+			const char* data,
+			size_t size,
+			OffMesh& mesh
+		)
+		const
+	{
+		const char* end = data + size;
+		const char* p = data;
+
+		// Skip blank lines and comments before the header keyword.
+		while ((p < end) && ((*p == '#') || isspace(*p)))
+		{
+			if (*p == '#')
+			{
+				const char* eol = static_cast<const char*>(memchr(p, '\n', end - p));
+				p = (eol == nullptr) ? end : eol;
+			}
+			++p;
+		}
+
+		// Read the header keyword, which must be a whole token (so,
+		// say, "OFFSET" is not taken for "OFF"). "STOFF" means every
+		// vertex carries two texture coordinates, which hold the
+		// parameter coordinates of a sample point.
+		const char* keyword = p;
+
+		while ((p < end) && (*p != '#') && !isspace(*p))
+		{
+			++p;
+		}
+
+		if ((p - keyword == 5) && (strncmp(keyword, "STOFF", 5) == 0))
+		{
+			mesh._hasParameters = true;
+		}
+		else if ((p - keyword == 3) && (strncmp(keyword, "OFF", 3) == 0))
+		{
+			mesh._hasParameters = false;
+		}
+		else
+		{
+			throw std::runtime_error("Input file is not an OFF file.");
+		}
+
+		// Read the number of vertices, faces, and edges.  They may be
+		// on the same line as the keyword or on the following lines.
+		size_t counts[3];
+
+		for (unsigned i = 0; i < 3; i++)
+		{
+			while ((p < end) && ((*p == '#') || isspace(*p)))
+			{
+				if (*p == '#')
+				{
+					const char* eol = static_cast<const char*>(memchr(p, '\n', end - p));
+					p = (eol == nullptr) ? end : eol;
+				}
+				++p;
+			}
+
+			if (!ParseIndex(p, end, counts[i]))
+			{
+				throw std::runtime_error("Failed to read the header of the OFF file.");
+			}
+		}
+
+		// The records start on the line following the counts.
+		const char* eol = static_cast<const char*>(memchr(p, '\n', end - p));
+		p = (eol == nullptr) ? end : eol + 1;
+
+		mesh._numberOfVertices = counts[0];
+		mesh._numberOfTriangles = counts[1];
+		mesh._coordinates.resize(3 * counts[0]);
+		mesh._parameters.resize(mesh._hasParameters ? 2 * counts[0] : 0);
+		mesh._triangles.resize(3 * counts[1]);
+
+		// Split the records into line-aligned blocks, one per thread.
+		// Small files are not worth spreading over threads.
+		size_t numberOfBlocks = (_numberOfThreads == 0) ? DefaultNumberOfThreads() : _numberOfThreads;
+		size_t minimumBlockSize = 1 << 16;
+
+		if (size_t(end - p) / minimumBlockSize + 1 < numberOfBlocks)
+		{
+			numberOfBlocks = size_t(end - p) / minimumBlockSize + 1;
+		}
+
+		std::vector<const char*> bounds(numberOfBlocks + 1);
+		bounds[0] = p;
+		bounds[numberOfBlocks] = end;
+
+		for (size_t k = 1; k < numberOfBlocks; k++)
+		{
+			const char* q = p + k * (size_t(end - p) / numberOfBlocks);
+
+			if (q < bounds[k - 1])
+			{
+				q = bounds[k - 1];
+			}
+
+			const char* nl = static_cast<const char*>(memchr(q, '\n', end - q));
+			bounds[k] = (nl == nullptr) ? end : nl + 1;
+		}
+
+		// First pass: count the records of each block, so each thread
+		// knows the index of its first record.
+		std::vector<size_t> firstRecord(numberOfBlocks + 1, 0);
+
+		ParallelFor(
+			0,
+			numberOfBlocks,
+			numberOfBlocks,
+			[&](size_t first, size_t last)
+			{
+				for (size_t k = first; k < last; k++)
+				{
+					firstRecord[k + 1] = CountRecords(bounds[k], bounds[k + 1]);
+				}
+			}
+		);
+
+		for (size_t k = 0; k < numberOfBlocks; k++)
+		{
+			firstRecord[k + 1] += firstRecord[k];
+		}
+
+		if (firstRecord[numberOfBlocks] < counts[0] + counts[1])
+		{
+			throw std::runtime_error("The OFF file has fewer records than its header announces.");
+		}
+
+		// Second pass: parse the records of each block.
+		ParallelFor(
+			0,
+			numberOfBlocks,
+			numberOfBlocks,
+			[&](size_t first, size_t last)
+			{
+				for (size_t k = first; k < last; k++)
+				{
+					ParseRecords(bounds[k], bounds[k + 1], firstRecord[k], mesh);
+				}
+			}
+		);
+
+		return;
+	}
+
+
+	/**
+	 * \fn void OffReader::ParseRecords(const char* first, const char* last, size_t record, OffMesh& mesh) const
+	 *
+	 * \brief Parses the vertex and face records of a block of lines.
+	 *
+	 * \param first A pointer to the first character of the block.
+	 * \param last A pointer past the last character of the block.
+	 * \param record The index of the first record of the block.
+	 * \param mesh A reference to the mesh whose arrays are filled.
+	 *
+	 */
+	void
+		OffReader::ParseRecords(
+			const char* first,
+			const char* last,
+			size_t record,
+			OffMesh& mesh
+		)
+		const
+	{
+		size_t nv = mesh._numberOfVertices;
+		size_t nr = nv + mesh._numberOfTriangles;
+
+		const char* p = first;
+
+		while ((p < last) && (record < nr))
+		{
+			const char* eol = static_cast<const char*>(memchr(p, '\n', last - p));
+
+			if (eol == nullptr)
+			{
+				eol = last;
+			}
+
+			// Skip leading white space, blank lines, and comments.
+			while ((p < eol) && isspace(*p))
+			{
+				++p;
+			}
+
+			if ((p < eol) && (*p != '#'))
+			{
+				if (record < nv)
+				{
+					// A vertex record: x y z [u v]
+					double* xyz = &mesh._coordinates[3 * record];
+
+					bool ok =
+						ParseNumber(p, eol, xyz[0]) &&
+						ParseNumber(p, eol, xyz[1]) &&
+						ParseNumber(p, eol, xyz[2]);
+
+					if (ok && mesh._hasParameters)
+					{
+						double* uv = &mesh._parameters[2 * record];
+						ok = ParseNumber(p, eol, uv[0]) && ParseNumber(p, eol, uv[1]);
+					}
+
+					if (!ok)
+					{
+						throw std::runtime_error("Failed to read a vertex record of the OFF file.");
+					}
+				}
+				else
+				{
+					// A face record: 3 a b c
+					size_t count;
+					size_t* abc = &mesh._triangles[3 * (record - nv)];
+
+					if (!ParseIndex(p, eol, count) || (count != 3))
+					{
+						throw std::runtime_error("Only triangular faces are supported.");
+					}
+
+					bool ok =
+						ParseIndex(p, eol, abc[0]) &&
+						ParseIndex(p, eol, abc[1]) &&
+						ParseIndex(p, eol, abc[2]);
+
+					if (!ok || (abc[0] >= nv) || (abc[1] >= nv) || (abc[2] >= nv))
+					{
+						throw std::runtime_error("Failed to read a face record of the OFF file.");
+					}
+				}
+
+				++record;
+			}
+
+			p = eol + 1;
+		}
+
+		return;
+	}
+
+
+	/**
+	 * \fn size_t OffReader::CountRecords(const char* first, const char* last)
+	 *
+	 * \brief Counts the lines of a block that hold a record.
+	 *
+	 * \param first A pointer to the first character of the block.
+	 * \param last A pointer past the last character of the block.
+	 *
+	 * \return The number of records of the block.
+	 *
+	 */
+	size_t
+		OffReader::CountRecords(
+			const char* first,
+			const char* last
+		)
+	{
+		size_t count = 0;
+		const char* p = first;
+
+		while (p < last)
+		{
+			const char* eol = static_cast<const char*>(memchr(p, '\n', last - p));
+
+			if (eol == nullptr)
+			{
+				eol = last;
+			}
+
+			while ((p < eol) && isspace(*p))
+			{
+				++p;
+			}
+
+			if ((p < eol) && (*p != '#'))
+			{
+				++count;
+			}
+
+			p = eol + 1;
+		}
+
+		return count;
+	}
+
+
+	/**
+	 * \fn bool OffReader::ParseNumber(const char*& p, const char* last, double& value)
+	 *
+	 * \brief Parses a floating-point number and advances \c p past it.
+	 *
+	 * \param p A reference to a pointer to the current character.
+	 * \param last A pointer past the last character of the line.
+	 * \param value A reference to the number parsed.
+	 *
+	 * \return The Boolean value true if a number was parsed.
+	 *
+	 */
+	bool
+		OffReader::ParseNumber(
+			const char*& p,
+			const char* last,
+			double& value
+		)
+	{
+		while ((p < last) && ((*p == ' ') || (*p == '\t') || (*p == '\r')))
+		{
+			++p;
+		}
+
+		// The mapped file is not null-terminated, so the token is copied
+		// to a small buffer before it is handed to strtod.
+		char token[64];
+		size_t length = 0;
+
+		while ((p + length < last) && (length < sizeof(token) - 1) && !isspace(p[length]))
+		{
+			token[length] = p[length];
+			++length;
+		}
+
+		token[length] = '\0';
+
+		char* tail;
+		value = strtod(token, &tail);
+
+		if ((length == 0) || (tail != token + length))
+		{
+			return false;
+		}
+
+		p += length;
+
+		return true;
+	}
+
+
+	/**
+	 * \fn bool OffReader::ParseIndex(const char*& p, const char* last, size_t& value)
+	 *
+	 * \brief Parses a nonnegative integer and advances \c p past it.
+	 *
+	 * \param p A reference to a pointer to the current character.
+	 * \param last A pointer past the last character of the line.
+	 * \param value A reference to the integer parsed.
+	 *
+	 * \return The Boolean value true if an integer was parsed.
+	 *
+	 */
+	bool
+		OffReader::ParseIndex(
+			const char*& p,
+			const char* last,
+			size_t& value
+		)
+	{
+		while ((p < last) && ((*p == ' ') || (*p == '\t') || (*p == '\r')))
+		{
+			++p;
+		}
+
+		const char* q = p;
+		value = 0;
+
+		while ((q < last) && (*q >= '0') && (*q <= '9'))
+		{
+			value = 10 * value + size_t(*q - '0');
+			++q;
+		}
+
+		if ((q == p) || ((q < last) && !isspace(*q)))
+		{
+			return false;
+		}
+
+		p = q;
+
+		return true;
+	}
+
+}
+
+/** @} */ //end of group class.
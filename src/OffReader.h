@@ -0,0 +1,334 @@
+/**
+ * \file OffReader.h
+ *
+ * \brief This  file contains the  definition of a class  that reads
+ * triangle meshes  and sample sets  from OFF files by  mapping them
+ * into memory and parsing their vertex and face blocks in parallel.
+ *
+ * \author
+ * Adelino Afonso e Irene Ginani \n
+ * Universidade Federal do Rio Grande do Norte, \n
+ * Instituto Metr&oacute;pole Digital, \n
+ * Adelino Afonso at imd (dot) ufrn (dot) br, \n
+ * Irene Ginani at imd (dot) ufrn (dot) br
+ *
+ * \version 1.0
+ * \date October 2026
+ *
+ * \attention This program is distributed WITHOUT ANY WARRANTY, and it
+ *            may be freely redistributed under the condition that the
+ *            copyright notices  are not removed,  and no compensation
+ *            is received. Private, research, and institutional use is
+ *            free. Distribution of this  code as part of a commercial
+ *            system  is permissible ONLY  BY DIRECT  ARRANGEMENT WITH
+ *            THE AUTHOR.
+ */
+
+#pragma once
+
+#include "DtPoint.h"           // cdt::DtPoint
+
+#include <string>              // std::string
+#include <vector>              // std::vector
+
+
+/**
+ * \defgroup MAT309NameSpace Namespace MAT309.
+ * @{
+ */
+
+/**
+ * \namespace MAT309
+ *
+ * \brief Global namespace for MAT309 software.
+ *
+ */
+
+namespace MAT309
+{
+
+	/**
+	 * \struct OffMesh
+	 *
+	 * \brief This struct stores the contents of an OFF file in flat,
+	 * contiguous arrays.  If the file is an STOFF file, the texture
+	 * coordinates of each vertex hold its parameter coordinates.
+	 *
+	 */
+	struct OffMesh
+	{
+		size_t _numberOfVertices;           ///< Number of vertices of the mesh.
+		size_t _numberOfTriangles;          ///< Number of triangles of the mesh.
+		bool _hasParameters;                ///< A flag to indicate whether the vertices have parameter coordinates.
+		std::vector<double> _coordinates;   ///< The 3D coordinates of the vertices (three per vertex).
+		std::vector<double> _parameters;    ///< The parameter coordinates of the vertices (two per vertex).
+		std::vector<size_t> _triangles;     ///< The vertex indices of the triangles (three per triangle).
+
+		/**
+		 * \fn OffMesh()
+		 *
+		 * \brief Creates an empty mesh.
+		 *
+		 */
+		OffMesh() : _numberOfVertices(0), _numberOfTriangles(0), _hasParameters(false)
+		{
+		}
+	};
+
+
+	/**
+	 * \class OffReader
+	 *
+	 * \brief  This  class reads  triangle  meshes  from OFF  and STOFF
+	 * files.  The file is mapped into memory, split into line-aligned
+	 * blocks, and each block is parsed by its own thread.
+	 *
+	 */
+	class OffReader
+	{
+	public:
+
+		// -----------------------------------------------------------
+		//
+		// Type definition
+		//
+		// -----------------------------------------------------------
+
+		/**
+		 * \typedef spPoint
+		 *
+		 * \brief Alias for a shared pointer to DtPoint objects.
+		 *
+		 */
+		typedef cdt::DtPoint::spPoint spPoint;
+
+
+	private:
+
+		// -----------------------------------------------------------
+		//
+		// Private data members
+		//
+		// -----------------------------------------------------------
+
+		size_t _numberOfThreads;   ///< Number of threads used to parse a file (0 means one per hardware thread).
+
+
+	public:
+
+		// -----------------------------------------------------------
+		//
+		// Public methods
+		//
+		// -----------------------------------------------------------
+
+		/**
+		 * \fn OffReader(size_t numberOfThreads = 0)
+		 *
+		 * \brief Creates an instance of this class.
+		 *
+		 * \param numberOfThreads Number of threads used to parse a
+		 * file (0 means one per hardware thread).
+		 *
+		 */
+		OffReader(size_t numberOfThreads = 0) : _numberOfThreads(numberOfThreads)
+		{
+		}
+
+
+		/**
+		 * \fn virtual ~OffReader()
+		 *
+		 * \brief  Releases the  memory held  by an  instance of  this
+		 * class.
+		 */
+		virtual ~OffReader()
+		{
+		}
+
+
+		/**
+		 * \fn void Read(const std::string& filename, OffMesh& mesh)
+		 *
+		 * \brief Reads an OFF or STOFF file.  Only triangular faces are
+		 * accepted.
+		 *
+		 * \param filename The name of the file to be read.
+		 * \param mesh A reference to the mesh read from the file.
+		 *
+		 */
+		void
+			Read(
+				const std::string& filename,
+				OffMesh& mesh
+			);
+
+
+		/**
+		 * \fn void GetSamplePoints(const OffMesh& mesh, size_t& numberOfPoints, std::vector<spPoint>& points) const
+		 *
+		 * \brief Turns the vertices of a  mesh read from an STOFF file
+		 * into sample points, so that they can be handed to the CDT
+		 * without sampling the surface again.
+		 *
+		 * \param mesh A mesh whose vertices have parameter coordinates.
+		 * \param numberOfPoints A reference to the number of sample points.
+		 * \param points A reference to an array of sample points.
+		 *
+		 */
+		void
+			GetSamplePoints(
+				const OffMesh& mesh,
+				size_t& numberOfPoints,
+				std::vector<spPoint>& points
+			)
+			const;
+
+
+		/**
+		 * \fn bool Compare(const OffMesh& mesh, const OffMesh& golden, double tolerance, double& maxDeviation, size_t& numberOfMismatchedTriangles) const
+		 *
+		 * \brief Compares a mesh against a golden (reference) mesh.  The
+		 * vertices  and triangles  are  compared index  by index,  so
+		 * both meshes must come from runs with the same sampler seed.
+		 *
+		 * \param mesh The mesh to be checked.
+		 * \param golden The reference mesh.
+		 * \param tolerance The largest distance allowed between two
+		 * corresponding vertices.
+		 * \param maxDeviation A reference to  the largest distance found
+		 * between two corresponding vertices.
+		 * \param numberOfMismatchedTriangles A reference to the number
+		 * of triangles whose vertex indices differ.
+		 *
+		 * \return The Boolean value true if both meshes have the same
+		 * number of vertices and triangles, all triangles match, and
+		 * no vertex deviates more than the tolerance.
+		 *
+		 */
+		bool
+			Compare(
+				const OffMesh& mesh,
+				const OffMesh& golden,
+				double tolerance,
+				double& maxDeviation,
+				size_t& numberOfMismatchedTriangles
+			)
+			const;
+
+
+	private:
+
+		// -----------------------------------------------------------
+		//
+		// Private methods
+		//
+		// -----------------------------------------------------------
+
+		/**
+		 * \fn void Parse(const char* data, size_t size, OffMesh& mesh) const
+		 *
+		 * \brief Parses the contents of an OFF file held in memory.
+		 *
+		 * \param data A pointer to the first character of the file.
+		 * \param size The number of characters of the file.
+		 * \param mesh A reference to the mesh read from the file.
+		 *
+		 */
+		void
+			Parse(
+				const char* data,
+				size_t size,
+				OffMesh& mesh
+			)
+			const;
+
+
+		/**
+		 * \fn void ParseRecords(const char* first, const char* last, size_t record, OffMesh& mesh) const
+		 *
+		 * \brief  Parses the  vertex and  face records  of a  block of
+		 * lines.
+		 *
+		 * \param first A pointer to the first character of the block.
+		 * \param last A pointer past the last character of the block.
+		 * \param record The index of the first record of the block.
+		 * \param mesh A reference to the mesh whose arrays are filled.
+		 *
+		 */
+		void
+			ParseRecords(
+				const char* first,
+				const char* last,
+				size_t record,
+				OffMesh& mesh
+			)
+			const;
+
+
+		/**
+		 * \fn static size_t CountRecords(const char* first, const char* last)
+		 *
+		 * \brief Counts  the lines of  a block that hold  a record, that
+		 * is, lines that are neither blank nor comments.
+		 *
+		 * \param first A pointer to the first character of the block.
+		 * \param last A pointer past the last character of the block.
+		 *
+		 * \return The number of records of the block.
+		 *
+		 */
+		static
+		size_t
+			CountRecords(
+				const char* first,
+				const char* last
+			);
+
+
+		/**
+		 * \fn static bool ParseNumber(const char*& p, const char* last, double& value)
+		 *
+		 * \brief Parses a floating-point number and advances \c p past
+		 * it.
+		 *
+		 * \param p A reference to a pointer to the current character.
+		 * \param last A pointer past the last character of the line.
+		 * \param value A reference to the number parsed.
+		 *
+		 * \return The Boolean value true if a number was parsed.
+		 *
+		 */
+		static
+		bool
+			ParseNumber(
+				const char*& p,
+				const char* last,
+				double& value
+			);
+
+
+		/**
+		 * \fn static bool ParseIndex(const char*& p, const char* last, size_t& value)
+		 *
+		 * \brief Parses a nonnegative integer and advances \c p past it.
+		 *
+		 * \param p A reference to a pointer to the current character.
+		 * \param last A pointer past the last character of the line.
+		 * \param value A reference to the integer parsed.
+		 *
+		 * \return The Boolean value true if an integer was parsed.
+		 *
+		 */
+		static
+		bool
+			ParseIndex(
+				const char*& p,
+				const char* last,
+				size_t& value
+			);
+	};
+
+}
+
+/** @} */ //end of group class.
@@ -0,0 +1,424 @@
+/**
+ * \file OffWriter.cpp
+ *
+ * \brief Implementation of  the class OffWriter, which  writes triangle
+ * meshes to OFF files using a background writer thread.
+ *
+ * \author
+ * Adelino Afonso e Irene Ginani \n
+ * Universidade Federal do Rio Grande do Norte, \n
+ * Instituto Metr&oacute;pole Digital, \n
+ * Adelino Afonso at imd (dot) ufrn (dot) br, \n
+ * Irene Ginani at imd (dot) ufrn (dot) br
+ *
+ * \version 1.0
+ * \date October 2026
+ *
+ * \attention This program is distributed WITHOUT ANY WARRANTY, and it
+ *            may be freely redistributed under the condition that the
+ *            copyright notices  are not removed,  and no compensation
+ *            is received. Private, research, and institutional use is
+ *            free. Distribution of this  code as part of a commercial
+ *            system  is permissible ONLY  BY DIRECT  ARRANGEMENT WITH
+ *            THE AUTHOR.
+ */
+
+#include "OffWriter.h"     // OffWriter
+
+#include <stdexcept>       // std::runtime_error
+
+
+/**
+ * \defgroup MAT309NameSpace Namespace MAT309.
+ * @{
+ */
+
+/**
+ * \namespace MAT309
+ *
+ * \brief Global namespace for MAT309 software.
+ */
+
+namespace MAT309
+{
+
+	/**
+	 * \fn OffWriter::OffWriter(size_t chunkSize)
+	 *
+	 * \brief Creates an instance of this class.
+	 *
+	 * \param chunkSize The number of bytes of a chunk handed to the
+	 * writer thread.
+	 *
+	 */
+	OffWriter::OffWriter(
+		size_t chunkSize
+	)
+		:
+		_file(nullptr),
+		_chunkSize(chunkSize),
+		_fill(&_buffers[0]),
+		_pending(nullptr),
+		_closing(false),
+		_failed(false)
+	{
+		// A record is at most a few hundred bytes long, so make sure
+		// a chunk can always hold one.
+		if (_chunkSize < 4096)
+		{
+			_chunkSize = 4096;
+		}
+	}
+
+
+	/**
+	 * \fn OffWriter::~OffWriter()
+	 *
+	 * \brief Releases the memory held by an instance of this class.
+	 *
+	 */
+	OffWriter::~OffWriter()
+	{
+		if (_file != nullptr)
+		{
+			try
+			{
+				Close();
+			}
+			catch (const std::exception&)
+			{
+				// Destructors must not throw.
+			}
+		}
+	}
+
+
+	/**
+	 * \fn void OffWriter::Open(const std::string& filename, size_t numberOfVertices, size_t numberOfTriangles, bool withParameters)
+	 *
+	 * \brief Creates an OFF file, writes its header, and starts the
+	 * writer thread.
+	 *
+	 * \param filename The name of the file to be written to.
+	 * \param numberOfVertices Number of vertex records to follow.
+	 * \param numberOfTriangles Number of triangle records to follow.
+	 * \param withParameters A flag to indicate whether an STOFF file
+	 * is written.
+	 *
+	 */
+	void
+		OffWriter::Open(
+			const std::string& filename,
+			size_t numberOfVertices,
+			size_t numberOfTriangles,
+			bool withParameters
+		)
+	{
+		if (_file != nullptr)
+		{
+			throw std::runtime_error("The OFF writer is already attached to a file.");
+		}
+
+		_file = std::fopen(filename.c_str(), "w");
+
+		if (_file == nullptr)
+		{
+			throw std::runtime_error("Output file cannot be created.");
+		}
+
+		// Reserve both chunks up front, so no allocation happens while
+		// the records are written.
+		_buffers[0].clear();
+		_buffers[1].clear();
+		_buffers[0].reserve(_chunkSize + 512);
+		_buffers[1].reserve(_chunkSize + 512);
+
+		_fill = &_buffers[0];
+		_pending = nullptr;
+		_closing = false;
+		_failed = false;
+
+		// Print out the file header.
+		char record[128];
+		int length = std::snprintf(
+			record,
+			sizeof(record),
+			"%s\n%zu\t%zu\t0\n",
+			withParameters ? "STOFF" : "OFF",
+			numberOfVertices,
+			numberOfTriangles
+		);
+
+		_fill->append(record, length);
+
+		// Start the writer thread.
+		_writer = std::thread(&OffWriter::Run, this);
+
+		return;
+	}
+
+
+	/**
+	 * \fn void OffWriter::WriteVertex(double x, double y, double z)
+	 *
+	 * \brief Appends a vertex record to the current chunk.
+	 *
+	 * \param x First Cartesian coordinate of the vertex.
+	 * \param y Second Cartesian coordinate of the vertex.
+	 * \param z Third Cartesian coordinate of the vertex.
+	 *
+	 */
+	void
+		OffWriter::WriteVertex(
+			double x,
+			double y,
+			double z
+		)
+	{
+		// Same format as std::setprecision(18) and std::fixed.
+		char record[384];
+		int length = std::snprintf(
+			record,
+			sizeof(record),
+			"%.18f\t%.18f\t%.18f\n",
+			x,
+			y,
+			z
+		);
+
+		Append(record, length, sizeof(record));
+
+		return;
+	}
+
+
+	/**
+	 * \fn void OffWriter::WriteVertex(double x, double y, double z, double u, double v)
+	 *
+	 * \brief Appends a vertex record with parameter coordinates to the
+	 * current chunk.
+	 *
+	 * \param x First Cartesian coordinate of the vertex.
+	 * \param y Second Cartesian coordinate of the vertex.
+	 * \param z Third Cartesian coordinate of the vertex.
+	 * \param u First parameter coordinate of the vertex.
+	 * \param v Second parameter coordinate of the vertex.
+	 *
+	 */
+	void
+		OffWriter::WriteVertex(
+			double x,
+			double y,
+			double z,
+			double u,
+			double v
+		)
+	{
+		// The parameter coordinates go in the texture coordinate slots
+		// of the STOFF format, so other OFF readers still load the file.
+		char record[640];
+		int length = std::snprintf(
+			record,
+			sizeof(record),
+			"%.18f\t%.18f\t%.18f\t%.18f\t%.18f\n",
+			x,
+			y,
+			z,
+			u,
+			v
+		);
+
+		Append(record, length, sizeof(record));
+
+		return;
+	}
+
+
+	/**
+	 * \fn void OffWriter::WriteTriangle(size_t a, size_t b, size_t c)
+	 *
+	 * \brief Appends a triangle record to the current chunk.
+	 *
+	 * \param a Index of the first vertex of the triangle.
+	 * \param b Index of the second vertex of the triangle.
+	 * \param c Index of the third vertex of the triangle.
+	 *
+	 */
+	void
+		OffWriter::WriteTriangle(
+			size_t a,
+			size_t b,
+			size_t c
+		)
+	{
+		char record[96];
+		int length = std::snprintf(
+			record,
+			sizeof(record),
+			"3 %zu\t%zu\t%zu\n",
+			a,
+			b,
+			c
+		);
+
+		Append(record, length, sizeof(record));
+
+		return;
+	}
+
+
+	/**
+	 * \fn void OffWriter::Close()
+	 *
+	 * \brief Hands the last chunk to the writer thread, waits for it
+	 * to finish, and closes the file.
+	 *
+	 */
+	void OffWriter::Close()
+	{
+		if (_file == nullptr)
+		{
+			return;
+		}
+
+		// Hand the (possibly partial) last chunk to the writer thread
+		// and tell it to stop once the chunk is written.
+		{
+			std::unique_lock<std::mutex> lock(_mutex);
+			_cond.wait(lock, [this] { return _pending == nullptr; });
+
+			if (!_fill->empty())
+			{
+				_pending = _fill;
+			}
+
+			_closing = true;
+		}
+
+		_cond.notify_all();
+		_writer.join();
+
+		bool failed = _failed || (std::fclose(_file) != 0);
+		_file = nullptr;
+
+		if (failed)
+		{
+			throw std::runtime_error("Failed to write the OFF file.");
+		}
+
+		return;
+	}
+
+
+	/**
+	 * \fn void OffWriter::Append(const char* record, int length, size_t size)
+	 *
+	 * \brief Appends a formatted record to the current chunk, and hands
+	 * the chunk to the writer thread once it is full.
+	 *
+	 * \param record The formatted record.
+	 * \param length The value returned by snprintf for the record.
+	 * \param size The size of the buffer holding the record.
+	 *
+	 */
+	void
+		OffWriter::Append(
+			const char* record,
+			int length,
+			size_t size
+		)
+	{
+		// snprintf returns the length the record would have had, so a
+		// huge coordinate printed with %.18f can exceed the buffer.
+		if ((length < 0) || (size_t(length) >= size))
+		{
+			throw std::runtime_error("A record does not fit in the OFF writer buffer.");
+		}
+
+#ifdef DEBUGMODE
+		if (_file == nullptr)
+		{
+			throw std::runtime_error("Attempt to write a record to an OFF writer that is not open.");
+		}
+#endif
+
+		_fill->append(record, length);
+
+		if (_fill->size() >= _chunkSize)
+		{
+			Submit();
+		}
+
+		return;
+	}
+
+
+	/**
+	 * \fn void OffWriter::Submit()
+	 *
+	 * \brief Waits until the writer thread is idle, hands it the
+	 * current chunk, and starts filling the other buffer.
+	 *
+	 */
+	void OffWriter::Submit()
+	{
+		{
+			std::unique_lock<std::mutex> lock(_mutex);
+
+			// Wait for the writer thread to release the other buffer.
+			_cond.wait(lock, [this] { return _pending == nullptr; });
+
+			if (_failed)
+			{
+				throw std::runtime_error("Failed to write the OFF file.");
+			}
+
+			_pending = _fill;
+			_fill = (_fill == &_buffers[0]) ? &_buffers[1] : &_buffers[0];
+		}
+
+		_cond.notify_all();
+
+		return;
+	}
+
+
+	/**
+	 * \fn void OffWriter::Run()
+	 *
+	 * \brief Body of the writer thread.
+	 *
+	 */
+	void OffWriter::Run()
+	{
+		std::unique_lock<std::mutex> lock(_mutex);
+
+		while (true)
+		{
+			_cond.wait(lock, [this] { return (_pending != nullptr) || _closing; });
+
+			if (_pending == nullptr)
+			{
+				// Nothing left to write.
+				return;
+			}
+
+			// Write the chunk without holding the lock, so the caller
+			// can keep filling the other buffer.
+			std::string* chunk = _pending;
+			lock.unlock();
+
+			size_t written = std::fwrite(chunk->data(), 1, chunk->size(), _file);
+			bool failed = (written != chunk->size());
+			chunk->clear();
+
+			lock.lock();
+			_failed = _failed || failed;
+			_pending = nullptr;
+			_cond.notify_all();
+		}
+	}
+
+}
+
+/** @} */ //end of group class.
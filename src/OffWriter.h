@@ -0,0 +1,266 @@
+/**
+ * \file OffWriter.h
+ *
+ * \brief This  file contains  the definition of  a class  that writes
+ * triangle meshes to OFF files  using a background writer thread, so
+ * that formatting the records and the disk I/O overlap.
+ *
+ * \author
+ * Adelino Afonso e Irene Ginani \n
+ * Universidade Federal do Rio Grande do Norte, \n
+ * Instituto Metr&oacute;pole Digital, \n
+ * Adelino Afonso at imd (dot) ufrn (dot) br, \n
+ * Irene Ginani at imd (dot) ufrn (dot) br
+ *
+ * \version 1.0
+ * \date October 2026
+ *
+ * \attention This program is distributed WITHOUT ANY WARRANTY, and it
+ *            may be freely redistributed under the condition that the
+ *            copyright notices  are not removed,  and no compensation
+ *            is received. Private, research, and institutional use is
+ *            free. Distribution of this  code as part of a commercial
+ *            system  is permissible ONLY  BY DIRECT  ARRANGEMENT WITH
+ *            THE AUTHOR.
+ */
+
+#pragma once
+
+#include <cstdio>              // std::FILE
+#include <string>              // std::string
+#include <thread>              // std::thread
+#include <mutex>               // std::mutex
+#include <condition_variable>  // std::condition_variable
+
+
+/**
+ * \defgroup MAT309NameSpace Namespace MAT309.
+ * @{
+ */
+
+/**
+ * \namespace MAT309
+ *
+ * \brief Global namespace for MAT309 software.
+ *
+ */
+
+namespace MAT309
+{
+
+	/**
+	 * \class OffWriter
+	 *
+	 * \brief This class writes a triangle mesh  to an OFF file.  The
+	 * caller formats  vertex and  triangle records into  a fixed-size
+	 * chunk while a background thread writes the previous chunk.  At
+	 * most two chunks exist at any time (double buffering), so memory
+	 * use does not depend on the size of the mesh.  The counts of the
+	 * header are written first, so the mesh must be known in full
+	 * before it is written; what overlaps with the disk I/O is the
+	 * formatting, not the extraction of the mesh.
+	 *
+	 */
+	class OffWriter
+	{
+	private:
+
+		// -----------------------------------------------------------
+		//
+		// Private data members
+		//
+		// -----------------------------------------------------------
+
+		std::FILE* _file;                 ///< The output file.
+		size_t _chunkSize;                ///< Number of bytes of a chunk handed to the writer thread.
+		std::string _buffers[2];          ///< The two chunk buffers.
+		std::string* _fill;               ///< The buffer being filled by the caller.
+		std::string* _pending;            ///< The buffer being written by the writer thread (or null).
+		bool _closing;                    ///< A flag to tell the writer thread no more chunks will come.
+		bool _failed;                     ///< A flag to indicate that a write operation failed.
+		std::thread _writer;              ///< The writer thread.
+		std::mutex _mutex;                ///< A mutex protecting the chunk hand-off.
+		std::condition_variable _cond;    ///< A condition variable signaling chunk hand-offs.
+
+	public:
+
+		// -----------------------------------------------------------
+		//
+		// Public methods
+		//
+		// -----------------------------------------------------------
+
+		/**
+		 * \fn OffWriter(size_t chunkSize = 1 << 20)
+		 *
+		 * \brief Creates an instance of this class.
+		 *
+		 * \param chunkSize The number  of bytes of a chunk  handed to
+		 * the writer thread.
+		 *
+		 */
+		OffWriter(size_t chunkSize = 1 << 20);
+
+
+		/**
+		 * \fn virtual ~OffWriter()
+		 *
+		 * \brief  Releases the  memory held  by an  instance of  this
+		 * class.  If the file  is still open, the pending records are
+		 * flushed and the file is closed.
+		 */
+		virtual ~OffWriter();
+
+
+		/**
+		 * \fn void Open(const std::string& filename, size_t numberOfVertices, size_t numberOfTriangles, bool withParameters = false)
+		 *
+		 * \brief  Creates an  OFF file,  writes its  header, and starts
+		 * the writer thread.
+		 *
+		 * \param filename The name of the file to be written to.
+		 * \param numberOfVertices Number of vertex records to follow.
+		 * \param numberOfTriangles Number of triangle records to follow.
+		 * \param withParameters A flag to indicate whether an STOFF file
+		 * is written, in which  every vertex record also carries the
+		 * parameter coordinates of the vertex.
+		 *
+		 */
+		void
+			Open(
+				const std::string& filename,
+				size_t numberOfVertices,
+				size_t numberOfTriangles,
+				bool withParameters = false
+			);
+
+
+		/**
+		 * \fn void WriteVertex(double x, double y, double z)
+		 *
+		 * \brief Appends a vertex record to the current chunk.
+		 *
+		 * \param x First Cartesian coordinate of the vertex.
+		 * \param y Second Cartesian coordinate of the vertex.
+		 * \param z Third Cartesian coordinate of the vertex.
+		 *
+		 */
+		void
+			WriteVertex(
+				double x,
+				double y,
+				double z
+			);
+
+
+		/**
+		 * \fn void WriteVertex(double x, double y, double z, double u, double v)
+		 *
+		 * \brief Appends a vertex  record with parameter coordinates to
+		 * the current chunk (STOFF files only).
+		 *
+		 * \param x First Cartesian coordinate of the vertex.
+		 * \param y Second Cartesian coordinate of the vertex.
+		 * \param z Third Cartesian coordinate of the vertex.
+		 * \param u First parameter coordinate of the vertex.
+		 * \param v Second parameter coordinate of the vertex.
+		 *
+		 */
+		void
+			WriteVertex(
+				double x,
+				double y,
+				double z,
+				double u,
+				double v
+			);
+
+
+		/**
+		 * \fn void WriteTriangle(size_t a, size_t b, size_t c)
+		 *
+		 * \brief Appends a triangle record to the current chunk.
+		 *
+		 * \param a Index of the first vertex of the triangle.
+		 * \param b Index of the second vertex of the triangle.
+		 * \param c Index of the third vertex of the triangle.
+		 *
+		 */
+		void
+			WriteTriangle(
+				size_t a,
+				size_t b,
+				size_t c
+			);
+
+
+		/**
+		 * \fn void Close()
+		 *
+		 * \brief Hands the last chunk to  the writer thread, waits for
+		 * it to finish, and closes the file.
+		 *
+		 */
+		void Close();
+
+
+	private:
+
+		// -----------------------------------------------------------
+		//
+		// Private methods
+		//
+		// -----------------------------------------------------------
+
+		/**
+		 * \fn OffWriter(const OffWriter& w)
+		 *
+		 * \brief Copying a writer is not allowed.
+		 *
+		 * \param w An instance of this class.
+		 *
+		 */
+		OffWriter(const OffWriter& w) = delete;
+
+
+		/**
+		 * \fn void Append(const char* record, int length, size_t size)
+		 *
+		 * \brief Appends a formatted record to the current chunk, and
+		 * hands the chunk to the writer thread once it is full.
+		 *
+		 * \param record The formatted record.
+		 * \param length The value returned by snprintf for the record.
+		 * \param size The size of the buffer holding the record.
+		 *
+		 */
+		void
+			Append(
+				const char* record,
+				int length,
+				size_t size
+			);
+
+
+		/**
+		 * \fn void Submit()
+		 *
+		 * \brief Waits until the writer thread is idle, hands it the
+		 * current chunk, and starts filling the other buffer.
+		 *
+		 */
+		void Submit();
+
+
+		/**
+		 * \fn void Run()
+		 *
+		 * \brief Body of the writer thread.
+		 *
+		 */
+		void Run();
+	};
+
+}
+
+/** @} */ //end of group class.
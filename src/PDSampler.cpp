@@ -24,7 +24,10 @@
 
 #include "PDSampler.h"     // PDSampler
 #include "Random.h"        // Random
+#include "BoundarySampler.h"  // BoundarySampler
 #include <cmath>
+#include <algorithm>       // std::min, std::max
+#include <stdexcept>       // std::runtime_error
 
 /**
  * \defgroup MAT309NameSpace Namespace MAT309.
@@ -57,11 +60,65 @@ namespace MAT309
 			std::vector<spPoint>& points
 		)
 	{
+		sample(surface, numberOfPoints, points, 0, BatchCallback());
+	}
+
+
+    /**
+	 * \fn void PDSampler::sample(const spSurface& surface, size_t& numberOfPoints, std::vector<spPoint>& points, size_t batchSize, const BatchCallback& emit)
+	 *
+	 * \brief Função para espalhar a amostragem de pontos, entregando os
+	 * pontos aceitos em lotes
+	 *
+	 * \param surface A pointer to the surface to be sampled.
+	 * \param numberOfPoints A reference to the number of sample points.
+	 * \param points A reference to an array of sample points.
+	 * \param batchSize Number of accepted points per batch.
+	 * \param emit A function receiving each batch (may be empty).
+	 *
+	 */
+	void
+	    PDSampler::sample(
+		    const spSurface& surface,
+			size_t& numberOfPoints,
+			std::vector<spPoint>& points,
+			size_t batchSize,
+			const BatchCallback& emit
+		)
+	{
+		levelEnds.clear();
+		segments.clear();
+
+		if (((trim != nullptr) || boundaryFirst) && ((maxError > 0) || (levels > 1)))
+		{
+			throw std::runtime_error("Trimming and boundary-first sampling are only supported with a fixed radius and a single level.");
+		}
+
+		if (maxError > 0)
+		{
+			sampleAdaptive(surface, numberOfPoints, points, batchSize, emit);
+			return;
+		}
+
+		if (levels > 1)
+		{
+			sampleProgressive(surface, numberOfPoints, points, batchSize, emit);
+			return;
+		}
 
 		this->surface = surface;
 
+		// Accepted points not yet handed to emit.
+		std::vector<spPoint> batch;
+
 		points.clear(); 
 
+		// The parameter points of the accepted samples.  When the points
+		// are handed to emit, this is all the sampler keeps of them.
+		SampleIndex index(surface, getAlpha());
+
+		std::vector<size_t> found;
+
 		SamplePoint::Point pos, pos1, pos2, pos3;
 
 		surface->GetPoint(surface->GetUMin(), surface->GetVMin(), pos._x, pos._y, pos._z );
@@ -78,15 +135,34 @@ namespace MAT309
 
 		double trials = 0;
 
-		bool conflicted;
+		// A trimmed patch starts with the samples of its trimming
+		// curves, which bound it, instead of the corners, and a
+		// boundary-first sample with the samples of the boundary.
+		if (trim != nullptr)
+		{
+			trim->SampleBoundary(surface, 2 * getAlpha(), points, segments);
+		}
+		else if (boundaryFirst)
+		{
+			BoundarySampler(surface, 2 * getAlpha()).SampleDomain(points, segments);
+		}
+		else
+		{
+			points.push_back(Min0);
+			points.push_back(Min1);
+			points.push_back(Max0);
+			points.push_back(Max1);
+		}
 
-		points.push_back(Min0);
-		points.push_back(Min1);
-		points.push_back(Max0);
-		points.push_back(Max1);
-		
+		for (size_t i = 0; i < points.size(); i++)
+		{
+			index.Insert(points[i]->GetU(), points[i]->GetV(), getAlpha());
+		}
 
-		
+		if (emit)
+		{
+			batch.swap(points);
+		}
 
 		while (trials < getMT()){
 
@@ -94,20 +170,34 @@ namespace MAT309
 
 			GerarAleatorio(p);
 
-			spSamplePoint pontoAleatorioF = std::make_shared<SamplePoint>(p);
-			
-			conflicted = false;
+			// Darts trimmed away are rejected before any distance test.
+			if ((trim != nullptr) && !trim->IsKept(p.GetU(), p.GetV()))
+			{
+				trials++;
+				continue;
+			}
+
+			if (!conflicts(index, p, getAlpha(), found)){
+
+				spSamplePoint pontoAleatorioF = std::make_shared<SamplePoint>(p);
+
+				index.Insert(p.GetU(), p.GetV(), getAlpha());
 
-			for (unsigned int i = 0; i < points.size(); i++){
-				if ((calcularDistancia(*pontoAleatorioF,*points[i]) < 2*getAlpha()) or (calcularDistancia(*points[i],*pontoAleatorioF) < 2*getAlpha())){
-					conflicted = true;
+				if (emit)
+				{
+					batch.push_back(pontoAleatorioF);
+
+					if (batch.size() >= batchSize)
+					{
+						emit(batch);
+						batch.clear();
+					}
+				}
+				else
+				{
+					points.push_back(pontoAleatorioF);
 				}
-			}
-			if (!conflicted){
 
-				//points.push_back(pontoAleatorio);
-				points.push_back(pontoAleatorioF);
-				//std::cout << "entrou"<< points.size();	
 				trials = 0;
 
 			}else {
@@ -117,53 +207,12 @@ namespace MAT309
 			
 		}
 
-	    // INSIRA CÓDIGO AQUI!
-
-		// -----------------------------------------------------------
-		//
-		// Observe que a lista "points" é uma lista de shared pointers
-		// para objectos da classe cdt::DtPoint.,  mas você vai ter de
-		// criar pontos que são objetos  da classe SamplePoint. Isto é
-		// feito assim:
-		//
-		// spSamplePoint myPoint = std::make_shared<SamplePoint>( SamplePoint( ARGUMENTOS DO CONSTRUTOR ) );
-		//
-		// Quando você  for inserir myPoint  na lista de  pontos, você
-		// vai simplesmente fazer isso como se myPoint fosse um shared
-		// pointer para  instâncias da  classe cdt::DtPoint  (isso vai
-		// funcionar graças ao mecanismo de polimorfismo do C++):
-		//
-		// points.push_back( myPoint );
-		//
-		// A manipulação de shared_pointer é idêntica a de apontadores
-		// comuns:
-		//
-		// Quero saber se o apontador é NULL:
-		//
-		// myPoint == nullptr
-		//
-		// Quero acessar o objeto apontador por myPOint:
-		//
-		// *myPoint  OU myPoint->ALGUM MEMBRO DA CLASSE cdt::DtPoint
-		//
-		// Você não  deve ter  nenhuma necessidade  para isso,  mas se
-		// você quiser, poe fazer um cast dinâmico para obter o objeto
-		// SamplePoint apontado por myPoint. Em geral, se você precisa
-		// disso, há  algo não  muito adequado com  a sua  solução. De
-		// todo jeito,
-		//
-		// spSamplePoint p = std::dynamic_pointer_cast<SamplePoint>(myPoint);
-		//
-		// Eu  mesmo  fiz  uso  disso   na  função  que  escreve  para
-		// arquivo. Eu poderia ter evitado se tivesse sobrecarregado o
-		// operador << de SamplePoint,  mas preferi terminar logo este
-		// código.
-		//
-		// -----------------------------------------------------------
-
-		// REMOVE A LINHA ABAIXO:
-		
-		numberOfPoints = points.size();
+		if (emit && !batch.empty())
+		{
+			emit(batch);
+		}
+
+		numberOfPoints = index.GetSize();
 
 	}
 
@@ -177,14 +226,26 @@ namespace MAT309
 		 */	
 	void PDSampler::GerarAleatorio(MAT309::SamplePoint &p){
 
-			MAT309::Random *r = nullptr;
-			double x = getSurface()->GetUMin() + (r->draw()*(getSurface()->GetUMax()-getSurface()->GetUMin()));
-			double y = getSurface()->GetVMin() + (r->draw()*(getSurface()->GetVMax()-getSurface()->GetVMin()));
+			double x, y;
+
+			// On a trimmed patch, darts are only thrown in the cells of
+			// the trim region that are not wholly trimmed away.
+			if (trim != nullptr)
+			{
+				double a = random.draw();
+				double b = random.draw();
+				double c = random.draw();
+
+				trim->Draw(a, b, c, x, y);
+			}
+			else
+			{
+				x = getSurface()->GetUMin() + (random.draw()*(getSurface()->GetUMax()-getSurface()->GetUMin()));
+				y = getSurface()->GetVMin() + (random.draw()*(getSurface()->GetVMax()-getSurface()->GetVMin()));
+			}
+
 			getSurface()->GetPoint(x,y, p._pos._x,p._pos._y, p._pos._z);
 			p.SetParameterCoordinates(x, y);
-
-			
-			//delete r;
 		
 		}
 		/**
@@ -207,11 +268,27 @@ namespace MAT309
 			double resultado_final;
 			double x,y,z,x1,y1,z1;
 
-			pp1[0][0] = p1.GetU()- p.GetU();
-			pp1[0][1] = p1.GetV() - p.GetV();
+			// Along a periodic coordinate, take the shorter way around.
+			double du = p1.GetU() - p.GetU();
+			double dv = p1.GetV() - p.GetV();
+
+			if (getSurface()->IsPeriodicInU())
+			{
+				double period = getSurface()->GetUMax() - getSurface()->GetUMin();
+				du -= period * std::round(du / period);
+			}
+
+			if (getSurface()->IsPeriodicInV())
+			{
+				double period = getSurface()->GetVMax() - getSurface()->GetVMin();
+				dv -= period * std::round(dv / period);
+			}
+
+			pp1[0][0] = du;
+			pp1[0][1] = dv;
 
-			pp1t[0][0] = p1.GetU()- p.GetU();
-			pp1t[1][0] = p1.GetV() - p.GetV();
+			pp1t[0][0] = du;
+			pp1t[1][0] = dv;
 
 
 			getSurface()->GetDu(p.GetU(),p.GetV(),x,y,z);
@@ -252,5 +329,297 @@ namespace MAT309
 			
 
 		}
+
+
+    /**
+	 * \fn void PDSampler::sampleAdaptive(const spSurface& surface, size_t& numberOfPoints, std::vector<spPoint>& points, size_t batchSize, const BatchCallback& emit)
+	 *
+	 * \brief Samples a surface with a radius that varies with the
+	 * curvature.
+	 *
+	 * \param surface A pointer to the surface to be sampled.
+	 * \param numberOfPoints A reference to the number of sample points.
+	 * \param points A reference to an array of sample points.
+	 * \param batchSize Number of accepted points per batch.
+	 * \param emit A function receiving each batch (may be empty).
+	 *
+	 */
+	void
+	    PDSampler::sampleAdaptive(
+		    const spSurface& surface,
+			size_t& numberOfPoints,
+			std::vector<spPoint>& points,
+			size_t batchSize,
+			const BatchCallback& emit
+		)
+	{
+		this->surface = surface;
+
+		// Accepted points not yet handed to emit.
+		std::vector<spPoint> batch;
+
+		points.clear();
+
+		// The parameter points and radii of the accepted samples.  A
+		// candidate of radius r conflicts with a sample of radius r_j if
+		// calcularDistancia(), the distance under the first fundamental
+		// form at either of them, is smaller than r + r_j, as in the
+		// uniform sampler.
+		SampleIndex index(surface, getAlpha());
+
+		std::vector<size_t> found;
+
+		auto accept = [&](const spSamplePoint& p, double r)
+		{
+			index.Insert(p->GetU(), p->GetV(), r);
+
+			if (emit)
+			{
+				batch.push_back(p);
+
+				if (batch.size() >= batchSize)
+				{
+					emit(batch);
+					batch.clear();
+				}
+			}
+			else
+			{
+				points.push_back(p);
+			}
+		};
+
+		// The corners of the domain are always samples.
+		double corners[4][2] = {
+			{ surface->GetUMin(), surface->GetVMin() },
+			{ surface->GetUMax(), surface->GetVMin() },
+			{ surface->GetUMin(), surface->GetVMax() },
+			{ surface->GetUMax(), surface->GetVMax() }
+		};
+
+		for (int c = 0; c < 4; c++)
+		{
+			SamplePoint::Point pos;
+			surface->GetPoint(corners[c][0], corners[c][1], pos._x, pos._y, pos._z);
+
+			accept(
+				std::make_shared<SamplePoint>(SamplePoint(corners[c][0], corners[c][1], pos)),
+				localRadius(corners[c][0], corners[c][1])
+			);
+		}
+
+		double trials = 0;
+
+		while (trials < getMT())
+		{
+			SamplePoint p;
+
+			GerarAleatorio(p);
+
+			double r = localRadius(p.GetU(), p.GetV());
+
+			if (!conflicts(index, p, r, found))
+			{
+				accept(std::make_shared<SamplePoint>(p), r);
+				trials = 0;
+			}
+			else
+			{
+				trials++;
+			}
+		}
+
+		if (emit && !batch.empty())
+		{
+			emit(batch);
+		}
+
+		numberOfPoints = index.GetSize();
+	}
+
+
+    /**
+	 * \fn void PDSampler::sampleProgressive(const spSurface& surface, size_t& numberOfPoints, std::vector<spPoint>& points, size_t batchSize, const BatchCallback& emit)
+	 *
+	 * \brief Samples a surface level by level, halving the radius
+	 * from one level to the next, down to alpha.
+	 *
+	 * \param surface A pointer to the surface to be sampled.
+	 * \param numberOfPoints A reference to the number of sample points.
+	 * \param points A reference to an array of sample points.
+	 * \param batchSize Number of accepted points per batch.
+	 * \param emit A function receiving each batch (may be empty).
+	 *
+	 */
+	void
+	    PDSampler::sampleProgressive(
+		    const spSurface& surface,
+			size_t& numberOfPoints,
+			std::vector<spPoint>& points,
+			size_t batchSize,
+			const BatchCallback& emit
+		)
+	{
+		this->surface = surface;
+
+		// Accepted points not yet handed to emit.
+		std::vector<spPoint> batch;
+
+		points.clear();
+		levelEnds.clear();
+
+		double radius = ldexp(getAlpha(), int(levels - 1));
+
+		// The parameter points of the accepted samples.  A candidate
+		// conflicts with a sample if calcularDistancia() at either of
+		// them is smaller than twice the radius of the current level, as
+		// in the uniform sampler: the candidate is given that distance as
+		// its radius, and the samples a radius of zero.
+		SampleIndex index(surface, 2 * radius);
+
+		std::vector<size_t> found;
+
+		auto accept = [&](const spSamplePoint& p)
+		{
+			index.Insert(p->GetU(), p->GetV(), 0);
+
+			if (emit)
+			{
+				batch.push_back(p);
+
+				if (batch.size() >= batchSize)
+				{
+					emit(batch);
+					batch.clear();
+				}
+			}
+			else
+			{
+				points.push_back(p);
+			}
+		};
+
+		// The corners of the domain are samples of the first level.
+		double corners[4][2] = {
+			{ surface->GetUMin(), surface->GetVMin() },
+			{ surface->GetUMax(), surface->GetVMin() },
+			{ surface->GetUMin(), surface->GetVMax() },
+			{ surface->GetUMax(), surface->GetVMax() }
+		};
+
+		for (int c = 0; c < 4; c++)
+		{
+			SamplePoint::Point pos;
+			surface->GetPoint(corners[c][0], corners[c][1], pos._x, pos._y, pos._z);
+
+			accept(std::make_shared<SamplePoint>(SamplePoint(corners[c][0], corners[c][1], pos)));
+		}
+
+		for (size_t level = 0; level < levels; level++, radius /= 2)
+		{
+			// The reach of the samples shrinks with the radius.
+			index.SetBound(2 * radius);
+
+			double trials = 0;
+
+			while (trials < getMT())
+			{
+				SamplePoint p;
+
+				GerarAleatorio(p);
+
+				if (!conflicts(index, p, 2 * radius, found))
+				{
+					accept(std::make_shared<SamplePoint>(p));
+					trials = 0;
+				}
+				else
+				{
+					trials++;
+				}
+			}
+
+			levelEnds.push_back(index.GetSize());
+		}
+
+		if (emit && !batch.empty())
+		{
+			emit(batch);
+		}
+
+		numberOfPoints = index.GetSize();
+	}
+
+
+    /**
+	 * \fn bool PDSampler::conflicts(SampleIndex& index, SamplePoint& p, double r, std::vector<size_t>& found)
+	 *
+	 * \brief Checks whether a candidate conflicts with an accepted
+	 * sample, that is, whether calcularDistancia() at either of them is
+	 * smaller than the sum of their radii.
+	 *
+	 * \param index The index of the accepted samples.
+	 * \param p The candidate.
+	 * \param r The radius of the candidate.
+	 * \param found A scratch array for the samples found in the index.
+	 *
+	 * \return True if the candidate conflicts with a sample.
+	 *
+	 */
+	bool
+	    PDSampler::conflicts(
+			SampleIndex& index,
+			SamplePoint& p,
+			double r,
+			std::vector<size_t>& found
+		)
+	{
+		index.Find(p.GetU(), p.GetV(), r, found);
+
+		for (size_t k : found)
+		{
+			cdt::DtPoint q(index.GetU(k), index.GetV(k));
+
+			double d = r + index.GetRadius(k);
+
+			if ((calcularDistancia(p, q) < d) || (calcularDistancia(q, p) < d))
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+
+    /**
+	 * \fn double PDSampler::localRadius(double u, double v)
+	 *
+	 * \brief Computes the radius of a sample from the largest
+	 * principal curvature at it.
+	 *
+	 * \param u First coordinate of a parameter point.
+	 * \param v Second coordinate of a parameter point.
+	 *
+	 * \return The radius of a sample at the parameter point.
+	 *
+	 */
+	double PDSampler::localRadius(double u, double v)
+	{
+		double k1, k2;
+		getSurface()->GetPrincipalCurvatures(u, v, k1, k2);
+
+		double k = fabs(k1);
+
+		double largest = getAlpha();
+		double smallest = (minAlpha > 0) ? std::min(minAlpha, largest) : largest / 10;
+
+		if (k * largest * largest <= 2 * maxError)
+		{
+			return largest;
+		}
+
+		return std::max(smallest, sqrt(2 * maxError / k));
+	}
 }
 /** @} */ //end of group class.
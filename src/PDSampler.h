@@ -26,8 +26,13 @@
 #include "Surface.h"           // Surface
 #include "DtPoint.h"           // cdt::DtPoint
 #include "SamplePoint.h"       // SamplePoint
+#include "TrimRegion.h"        // TrimRegion
+#include "../common/Random.h"  // Random
+#include "SampleIndex.h"       // SampleIndex
 
 #include <vector>              // std::vector
+#include <functional>          // std::function
+#include <memory>              // std::shared_ptr
 
 
 /**
@@ -88,6 +93,16 @@ namespace MAT309
 		typedef std::shared_ptr<Surface> spSurface;
 
 
+		/**
+		 * \typedef BatchCallback
+		 *
+		 * \brief Alias for a function receiving a batch of accepted
+		 * sample points.
+		 *
+		 */
+		typedef std::function<void (std::vector<spPoint>& batch)> BatchCallback;
+
+
 	private:
 
 		// -----------------------------------------------------------
@@ -96,13 +111,17 @@ namespace MAT309
 		//
 		// -----------------------------------------------------------
 
-	    //
-	    // DEFINA OS DADOS PRIVADOS AQUI
 			double alpha = 0.1;
 	    	double MT = 100;
 	     	spSurface surface;
-	
-	    //
+			Random random{1};
+			double maxError = 0;      ///< Largest distance allowed between the surface and a triangle (0 means a fixed radius alpha).
+			double minAlpha = 0;      ///< Smallest radius of a sample when the radius varies (0 means alpha / 10).
+			size_t levels = 1;        ///< Number of levels of a progressive sample (1 means a single radius alpha).
+			std::vector<size_t> levelEnds;   ///< Number of points of each level of the last progressive sample.
+			std::shared_ptr<const TrimRegion> trim;   ///< Trimming curves of the patch (null means the whole domain is sampled).
+			bool boundaryFirst = false;      ///< Whether the boundary of the domain is sampled first, and bounded by segments.
+			std::vector<size_t> segments;    ///< Indices of the two samples of each boundary segment of the last trimmed or boundary-first sample.
 
 	public:
 
@@ -168,6 +187,34 @@ namespace MAT309
 		);
 
 
+		/**
+		 * \fn void sample(const spSurface& surface, size_t& numberOfPoints, std::vector<spPoint>& points, size_t batchSize, const BatchCallback& emit)
+		 *
+		 * \brief Samples a surface like the method above, but hands the
+		 * accepted points to a callback in batches of \c batchSize
+		 * points (the last batch may be smaller) as sampling goes on, so
+		 * that they can be triangulated while sampling continues.  The
+		 * sampler then keeps only the parameter points of the samples,
+		 * for the conflict tests, and leaves \c points empty.
+		 *
+		 * \param surface A pointer to the surface to be sampled.
+		 * \param numberOfPoints A reference to the number of sample points.
+		 * \param points A reference to an array of sample points, left
+		 * empty if \c emit is given.
+		 * \param batchSize Number of accepted points per batch.
+		 * \param emit A function receiving each batch.  It may keep the
+		 * batch by swapping it with another array.
+		 *
+		 */
+		void sample(
+			const spSurface& surface,
+			size_t& numberOfPoints,
+			std::vector<spPoint>& points,
+			size_t batchSize,
+			const BatchCallback& emit
+		);
+
+
 	
 		spSurface getSurface(){
 			return surface;
@@ -181,6 +228,116 @@ namespace MAT309
 			return MT;
 		}
 
+		void setAlpha(double alpha){
+			this->alpha = alpha;
+		}
+
+		void setMT(double MT){
+			this->MT = MT;
+		}
+
+		void setSeed(unsigned seed){
+			random.seed(seed);
+		}
+
+		double getMaxError(){
+			return maxError;
+		}
+
+		void setMaxError(double maxError){
+			this->maxError = maxError;
+		}
+
+		double getMinAlpha(){
+			return minAlpha;
+		}
+
+		void setMinAlpha(double minAlpha){
+			this->minAlpha = minAlpha;
+		}
+
+		size_t getLevels(){
+			return levels;
+		}
+
+		void setLevels(size_t levels){
+			this->levels = (levels > 0) ? levels : 1;
+		}
+
+		/**
+		 * \fn const std::vector<size_t>& getLevelEnds() const
+		 *
+		 * \brief Returns, for each level of the last progressive
+		 * sample, the number of points up to and including that level.
+		 * The first n points of the array of sample points, for any of
+		 * these numbers n, are a Poisson disk sample of their own.
+		 *
+		 * \return The number of points up to and including each level.
+		 *
+		 */
+		const std::vector<size_t>& getLevelEnds() const {
+			return levelEnds;
+		}
+
+		const std::shared_ptr<const TrimRegion>& getTrim() const {
+			return trim;
+		}
+
+		/**
+		 * \fn void setTrim(const std::shared_ptr<const TrimRegion>& trim)
+		 *
+		 * \brief Sets the trimming curves of the patch.  The samples of
+		 * a trimmed patch start with the samples of its trimming curves
+		 * (see getSegments()), instead of the corners of the domain,
+		 * and darts are only thrown where the trim region keeps them.
+		 * Only the sampler with a fixed radius and a single level
+		 * supports trimming.
+		 *
+		 * \param trim The trimming curves, or a null pointer to sample
+		 * the whole domain.
+		 *
+		 */
+		void setTrim(const std::shared_ptr<const TrimRegion>& trim){
+			this->trim = trim;
+		}
+
+		bool getBoundaryFirst() const {
+			return boundaryFirst;
+		}
+
+		/**
+		 * \fn void setBoundaryFirst(bool boundaryFirst)
+		 *
+		 * \brief Sets whether the boundary of the domain is sampled
+		 * first.  The samples then start with samples of the boundary
+		 * at a spacing of 2 alpha on the surface (see getSegments()),
+		 * instead of the corners, and darts fill the interior.  The
+		 * sides of the domain are sampled the same way in every patch
+		 * that shares them.  Only the sampler with a fixed radius and a
+		 * single level supports it, and trimming curves take its place.
+		 *
+		 * \param boundaryFirst True to sample the boundary first.
+		 *
+		 */
+		void setBoundaryFirst(bool boundaryFirst){
+			this->boundaryFirst = boundaryFirst;
+		}
+
+		/**
+		 * \fn const std::vector<size_t>& getSegments() const
+		 *
+		 * \brief Returns the segments of the trimming curves, or of the
+		 * boundary of the domain, of the last trimmed or boundary-first
+		 * sample, as the indices of their two samples, to be handed to
+		 * the CDT of a set of points and segments.
+		 *
+		 * \return The indices of the two samples of each segment.
+		 *
+		 */
+		const std::vector<size_t>& getSegments() const {
+			return segments;
+		}
+
 	private:
 
 		// ---------------------------------------------------------------
@@ -209,6 +366,104 @@ namespace MAT309
 		 * 
 		 */
 		double calcularDistancia(MAT309::cdt::DtPoint &p, MAT309::cdt::DtPoint &p1);
+
+		/**
+		 * \fn void sampleAdaptive(const spSurface& surface, size_t& numberOfPoints, std::vector<spPoint>& points, size_t batchSize, const BatchCallback& emit)
+		 *
+		 * \brief Samples a surface with a radius that varies with the
+		 * curvature (see localRadius()).  Two samples conflict if their
+		 * distance, measured by calcularDistancia() as in the uniform
+		 * sampler, is smaller than the sum of their radii, so with a
+		 * large maxError the two samplers give the same density.  The
+		 * parameter points of the accepted samples are kept in a
+		 * kd-tree, and each candidate is only checked against the
+		 * samples close enough in the parameter plane for the metric
+		 * at either of them to bring them within the sum of the radii.
+		 *
+		 * \param surface A pointer to the surface to be sampled.
+		 * \param numberOfPoints A reference to the number of sample points.
+		 * \param points A reference to an array of sample points.
+		 * \param batchSize Number of accepted points per batch.
+		 * \param emit A function receiving each batch (may be empty).
+		 *
+		 */
+		void sampleAdaptive(
+			const spSurface& surface,
+			size_t& numberOfPoints,
+			std::vector<spPoint>& points,
+			size_t batchSize,
+			const BatchCallback& emit
+		);
+
+		/**
+		 * \fn void sampleProgressive(const spSurface& surface, size_t& numberOfPoints, std::vector<spPoint>& points, size_t batchSize, const BatchCallback& emit)
+		 *
+		 * \brief Samples a surface level by level, the radius being
+		 * alpha 2^(levels - 1) in the first level and halving in each
+		 * level after it, down to alpha.  Each level keeps the samples
+		 * of the levels before it and adds samples until dart throwing
+		 * fails, so the points up to the end of any level are a Poisson
+		 * disk sample with the radius of that level.  Two samples
+		 * conflict if calcularDistancia() at either of them is smaller
+		 * than twice the radius of the current level, as in the
+		 * uniform sampler, so the finest level has the density of a
+		 * single-level sample with radius alpha.
+		 *
+		 * \param surface A pointer to the surface to be sampled.
+		 * \param numberOfPoints A reference to the number of sample points.
+		 * \param points A reference to an array of sample points.
+		 * \param batchSize Number of accepted points per batch.
+		 * \param emit A function receiving each batch (may be empty).
+		 *
+		 */
+		void sampleProgressive(
+			const spSurface& surface,
+			size_t& numberOfPoints,
+			std::vector<spPoint>& points,
+			size_t batchSize,
+			const BatchCallback& emit
+		);
+
+		/**
+		 * \fn bool conflicts(SampleIndex& index, SamplePoint& p, double r, std::vector<size_t>& found)
+		 *
+		 * \brief Checks whether a candidate conflicts with an accepted
+		 * sample, that is, whether calcularDistancia() at either of
+		 * them is smaller than the sum of their radii.  Only the
+		 * samples the index finds for the candidate are checked.
+		 *
+		 * \param index The index of the accepted samples.
+		 * \param p The candidate.
+		 * \param r The radius of the candidate.
+		 * \param found A scratch array for the samples found in the
+		 * index.
+		 *
+		 * \return True if the candidate conflicts with a sample.
+		 *
+		 */
+		bool conflicts(
+			SampleIndex& index,
+			SamplePoint& p,
+			double r,
+			std::vector<size_t>& found
+		);
+
+		/**
+		 * \fn double localRadius(double u, double v)
+		 *
+		 * \brief Computes the radius of a sample from the largest
+		 * principal curvature k at it.  A chord of length 2r of a
+		 * circle of curvature k is about k r^2 / 2 away from the
+		 * circle, so the radius is sqrt(2 maxError / k), clamped to
+		 * [minAlpha, alpha].
+		 *
+		 * \param u First coordinate of a parameter point.
+		 * \param v Second coordinate of a parameter point.
+		 *
+		 * \return The radius of a sample at the parameter point.
+		 *
+		 */
+		double localRadius(double u, double v);
 	};
 
 }
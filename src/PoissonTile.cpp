@@ -0,0 +1,274 @@
+/**
+ * \file PoissonTile.cpp
+ *
+ * \brief Implementation of the class PoissonTile, which holds a
+ * periodic Poisson disk tile.
+ *
+ * \author
+ * Adelino Afonso e Irene Ginani \n
+ * Universidade Federal do Rio Grande do Norte, \n
+ * Instituto Metr&oacute;pole Digital, \n
+ * Adelino Afonso at imd (dot) ufrn (dot) br, \n
+ * Irene Ginani at imd (dot) ufrn (dot) br
+ *
+ * \version 1.0
+ * \date October 2026
+ *
+ * \attention This program is distributed WITHOUT ANY WARRANTY, and it
+ *            may be freely redistributed under the condition that the
+ *            copyright notices  are not removed,  and no compensation
+ *            is received. Private, research, and institutional use is
+ *            free. Distribution of this  code as part of a commercial
+ *            system  is permissible ONLY  BY DIRECT  ARRANGEMENT WITH
+ *            THE AUTHOR.
+ */
+
+#include "PoissonTile.h"         // PoissonTile
+
+#include <algorithm>             // std::min, std::max
+#include <cmath>                 // sqrt, acos, floor
+#include <cstdlib>               // std::abs
+#include <cstdio>                // std::FILE, std::fopen, std::fread, std::fwrite
+#include <random>                // std::mt19937
+#include <stdexcept>             // std::runtime_error
+
+
+/**
+ * \defgroup MAT309NameSpace Namespace MAT309.
+ * @{
+ */
+
+/**
+ * \namespace MAT309
+ *
+ * \brief Global namespace for MAT309 software.
+ */
+
+namespace MAT309
+{
+
+	/**
+	 * \fn void PoissonTile::Generate(size_t numberOfPoints, unsigned seed)
+	 *
+	 * \brief Replaces the points of the tile with a new periodic Poisson
+	 * disk sample of about a given number of points.
+	 *
+	 * \param numberOfPoints The desired number of points.
+	 * \param seed The seed of the dart thrower.
+	 *
+	 */
+	void
+		PoissonTile::Generate(
+			size_t numberOfPoints,
+			unsigned seed
+		)
+	{
+		if ((numberOfPoints < 1) || (numberOfPoints > 65536))
+		{
+			throw std::runtime_error("A Poisson tile holds from 1 to 65536 points.");
+		}
+
+		// A nearly full dart throwing sample covers about 55% of the
+		// plane with disks of half the spacing.
+		const double pi = acos(-1.0);
+		const double spacing = 2 * sqrt(0.55 / (pi * numberOfPoints));
+
+		_spacing = uint32_t(floor(spacing * 65536));
+		_coordinates.clear();
+
+		if (_spacing == 0)
+		{
+			_spacing = 1;
+		}
+
+		// A background grid whose cells hold at most one point each, so
+		// a dart is only checked against the points of the cells
+		// around it, on the torus.  The number of cells along a side
+		// is a power of two, so that the cells tile the torus exactly.
+		const int64_t d = _spacing;
+
+		int64_t n = 1;
+
+		while ((n < 65536) && (65536 / n) * 1.4142135623730951 > d)
+		{
+			n *= 2;
+		}
+
+		const int64_t cellSize = 65536 / n;
+		const int64_t reach = (d + cellSize - 1) / cellSize;
+
+		std::vector<int32_t> grid(size_t(n * n), -1);
+
+		std::mt19937 engine(seed);
+
+		// Throw darts until many fail in a row.
+		const size_t maxFailures = 20 * numberOfPoints + 1000;
+
+		size_t failures = 0;
+
+		while (failures < maxFailures)
+		{
+			int64_t x = int64_t(engine() & 0xFFFF);
+			int64_t y = int64_t(engine() & 0xFFFF);
+
+			int64_t cx = x / cellSize;
+			int64_t cy = y / cellSize;
+
+			bool conflicted = false;
+
+			for (int64_t i = -reach; (i <= reach) && !conflicted; i++)
+			{
+				for (int64_t j = -reach; (j <= reach) && !conflicted; j++)
+				{
+					int32_t k = grid[size_t(((cx + i + n) % n) * n + ((cy + j + n) % n))];
+
+					if (k < 0)
+					{
+						continue;
+					}
+
+					// The shortest offset between the points on the torus.
+					int64_t dx = std::abs(x - int64_t(_coordinates[2 * k]));
+					int64_t dy = std::abs(y - int64_t(_coordinates[2 * k + 1]));
+
+					dx = std::min(dx, 65536 - dx);
+					dy = std::min(dy, 65536 - dy);
+
+					conflicted = (dx * dx + dy * dy) < (d * d);
+				}
+			}
+
+			if (conflicted)
+			{
+				failures++;
+				continue;
+			}
+
+			grid[size_t(cx * n + cy)] = int32_t(GetSize());
+
+			_coordinates.push_back(uint16_t(x));
+			_coordinates.push_back(uint16_t(y));
+
+			failures = 0;
+		}
+
+		return;
+	}
+
+
+	/**
+	 * \fn void PoissonTile::Load(const std::string& filename)
+	 *
+	 * \brief Reads the tile from a binary file.
+	 *
+	 * \param filename The name of the file.
+	 *
+	 */
+	void
+		PoissonTile::Load(
+			const std::string& filename
+		)
+	{
+		std::FILE* file = std::fopen(filename.c_str(), "rb");
+
+		if (file == nullptr)
+		{
+			throw std::runtime_error("Poisson tile file cannot be opened.");
+		}
+
+		unsigned char header[12];
+
+		bool ok = (std::fread(header, 1, sizeof(header), file) == sizeof(header)) &&
+			(header[0] == 'P') && (header[1] == 'D') && (header[2] == 'T') && (header[3] == 'L');
+
+		uint32_t size = 0;
+		uint32_t spacing = 0;
+
+		for (int b = 3; ok && (b >= 0); b--)
+		{
+			size = (size << 8) | header[4 + b];
+			spacing = (spacing << 8) | header[8 + b];
+		}
+
+		ok = ok && (size > 0) && (size <= 65536) && (spacing > 0);
+
+		std::vector<unsigned char> bytes(ok ? 4 * size_t(size) : 0);
+
+		ok = ok && (std::fread(bytes.data(), 1, bytes.size(), file) == bytes.size());
+
+		std::fclose(file);
+
+		if (!ok)
+		{
+			throw std::runtime_error("The file is not a Poisson tile file, or is truncated.");
+		}
+
+		_coordinates.resize(2 * size_t(size));
+
+		for (size_t i = 0; i < _coordinates.size(); i++)
+		{
+			_coordinates[i] = uint16_t(bytes[2 * i] | (bytes[2 * i + 1] << 8));
+		}
+
+		_spacing = spacing;
+
+		return;
+	}
+
+
+	/**
+	 * \fn void PoissonTile::Save(const std::string& filename) const
+	 *
+	 * \brief Writes the tile to a binary file.
+	 *
+	 * \param filename The name of the file.
+	 *
+	 */
+	void
+		PoissonTile::Save(
+			const std::string& filename
+		)
+		const
+	{
+		std::vector<unsigned char> bytes = { 'P', 'D', 'T', 'L' };
+
+		uint32_t size = uint32_t(GetSize());
+
+		for (int b = 0; b < 4; b++)
+		{
+			bytes.push_back((unsigned char)(size >> (8 * b)));
+		}
+
+		for (int b = 0; b < 4; b++)
+		{
+			bytes.push_back((unsigned char)(_spacing >> (8 * b)));
+		}
+
+		for (uint16_t c : _coordinates)
+		{
+			bytes.push_back((unsigned char)(c & 0xFF));
+			bytes.push_back((unsigned char)(c >> 8));
+		}
+
+		std::FILE* file = std::fopen(filename.c_str(), "wb");
+
+		if (file == nullptr)
+		{
+			throw std::runtime_error("Poisson tile file cannot be created.");
+		}
+
+		bool ok = (std::fwrite(bytes.data(), 1, bytes.size(), file) == bytes.size());
+
+		ok = (std::fclose(file) == 0) && ok;
+
+		if (!ok)
+		{
+			throw std::runtime_error("Failed to write the Poisson tile file.");
+		}
+
+		return;
+	}
+
+}
+
+/** @} */ //end of group class.
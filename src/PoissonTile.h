@@ -0,0 +1,192 @@
+/**
+ * \file PoissonTile.h
+ *
+ * \brief This file contains the definition of a class that holds a
+ * periodic Poisson disk tile, a set of points in the unit square that
+ * can be repeated over the plane without breaking its spacing.
+ *
+ * \author
+ * Adelino Afonso e Irene Ginani \n
+ * Universidade Federal do Rio Grande do Norte, \n
+ * Instituto Metr&oacute;pole Digital, \n
+ * Adelino Afonso at imd (dot) ufrn (dot) br, \n
+ * Irene Ginani at imd (dot) ufrn (dot) br
+ *
+ * \version 1.0
+ * \date October 2026
+ *
+ * \attention This program is distributed WITHOUT ANY WARRANTY, and it
+ *            may be freely redistributed under the condition that the
+ *            copyright notices  are not removed,  and no compensation
+ *            is received. Private, research, and institutional use is
+ *            free. Distribution of this  code as part of a commercial
+ *            system  is permissible ONLY  BY DIRECT  ARRANGEMENT WITH
+ *            THE AUTHOR.
+ */
+
+#pragma once
+
+#include <cstdint>             // uint16_t
+#include <string>              // std::string
+#include <vector>              // std::vector
+
+
+/**
+ * \defgroup MAT309NameSpace Namespace MAT309.
+ * @{
+ */
+
+/**
+ * \namespace MAT309
+ *
+ * \brief Global namespace for MAT309 software.
+ *
+ */
+
+namespace MAT309
+{
+
+	/**
+	 * \class PoissonTile
+	 *
+	 * \brief This class holds a periodic Poisson disk tile: points of
+	 * the unit square no closer than a given distance to each other,
+	 * distances being measured on the torus, so that copies of the
+	 * tile laid side by side keep the spacing across their sides.
+	 *
+	 * The coordinates are multiples of 1/65536, so a tile is stored as
+	 * a compact binary file: the magic "PDTL", the number of points
+	 * and the spacing in units of 1/65536 as 32-bit integers, and two
+	 * 16-bit integers per point, all little-endian.  A tile of a
+	 * thousand points takes 4 kB.
+	 *
+	 */
+	class PoissonTile
+	{
+	private:
+
+		// -----------------------------------------------------------
+		//
+		// Private data members
+		//
+		// -----------------------------------------------------------
+
+		std::vector<uint16_t> _coordinates;   ///< The two coordinates of each point, in units of 1/65536.
+		uint32_t _spacing;                    ///< The smallest distance between two points, in units of 1/65536.
+
+
+	public:
+
+		// -----------------------------------------------------------
+		//
+		// Public methods
+		//
+		// -----------------------------------------------------------
+
+		/**
+		 * \fn PoissonTile()
+		 *
+		 * \brief Creates an empty tile.
+		 *
+		 */
+		PoissonTile() : _spacing(0)
+		{
+		}
+
+
+		/**
+		 * \fn size_t GetSize() const
+		 *
+		 * \brief Returns the number of points of the tile.
+		 *
+		 * \return The number of points of the tile.
+		 *
+		 */
+		size_t GetSize() const
+		{
+			return _coordinates.size() / 2;
+		}
+
+
+		/**
+		 * \fn double GetSpacing() const
+		 *
+		 * \brief Returns the smallest distance between two points of
+		 * the tile, or of copies of the tile laid side by side.
+		 *
+		 * \return The smallest distance between two points.
+		 *
+		 */
+		double GetSpacing() const
+		{
+			return _spacing / 65536.0;
+		}
+
+
+		/**
+		 * \fn void GetPoint(size_t i, double& s, double& t) const
+		 *
+		 * \brief Returns the coordinates of a point of the tile.
+		 *
+		 * \param i The index of the point.
+		 * \param s A reference to the first coordinate, in [0,1).
+		 * \param t A reference to the second coordinate, in [0,1).
+		 *
+		 */
+		void GetPoint(size_t i, double& s, double& t) const
+		{
+			s = _coordinates[2 * i] / 65536.0;
+			t = _coordinates[2 * i + 1] / 65536.0;
+		}
+
+
+		/**
+		 * \fn void Generate(size_t numberOfPoints, unsigned seed)
+		 *
+		 * \brief Replaces the points of the tile with a new periodic
+		 * Poisson disk sample of about a given number of points, thrown
+		 * until the tile is nearly full.
+		 *
+		 * \param numberOfPoints The desired number of points.
+		 * \param seed The seed of the dart thrower.
+		 *
+		 */
+		void
+			Generate(
+				size_t numberOfPoints,
+				unsigned seed
+			);
+
+
+		/**
+		 * \fn void Load(const std::string& filename)
+		 *
+		 * \brief Reads the tile from a binary file.
+		 *
+		 * \param filename The name of the file.
+		 *
+		 */
+		void
+			Load(
+				const std::string& filename
+			);
+
+
+		/**
+		 * \fn void Save(const std::string& filename) const
+		 *
+		 * \brief Writes the tile to a binary file.
+		 *
+		 * \param filename The name of the file.
+		 *
+		 */
+		void
+			Save(
+				const std::string& filename
+			)
+			const;
+	};
+
+}
+
+/** @} */ //end of group class.
@@ -0,0 +1,71 @@
+/**
+ * \file RunBuffers.h
+ *
+ * \brief This  file contains the  definition of a struct  that holds the
+ * arrays filled by a run of the driver.
+ *
+ * \author
+ * Adelino Afonso e Irene Ginani \n
+ * Universidade Federal do Rio Grande do Norte, \n
+ * Instituto Metr&oacute;pole Digital, \n
+ * Adelino Afonso at imd (dot) ufrn (dot) br, \n
+ * Irene Ginani at imd (dot) ufrn (dot) br
+ *
+ * \version 1.0
+ * \date October 2026
+ *
+ * \attention This program is distributed WITHOUT ANY WARRANTY, and it
+ *            may be freely redistributed under the condition that the
+ *            copyright notices  are not removed,  and no compensation
+ *            is received. Private, research, and institutional use is
+ *            free. Distribution of this  code as part of a commercial
+ *            system  is permissible ONLY  BY DIRECT  ARRANGEMENT WITH
+ *            THE AUTHOR.
+ */
+
+#pragma once
+
+#include "DtPoint.h"           // cdt::DtPoint
+#include "FaceVisitor.h"       // cdt::FaceVisitor
+#include "PDSampler.h"         // PDSampler
+
+#include <vector>              // std::vector
+
+
+/**
+ * \defgroup MAT309NameSpace Namespace MAT309.
+ * @{
+ */
+
+/**
+ * \namespace MAT309
+ *
+ * \brief Global namespace for MAT309 software.
+ *
+ */
+
+namespace MAT309
+{
+
+	/**
+	 * \struct RunBuffers
+	 *
+	 * \brief This struct holds the arrays  filled by each run.  They are
+	 * kept alive across the runs of a sweep, so later runs reuse the
+	 * memory already allocated by earlier ones.  In batch mode, each
+	 * worker thread owns one instance.
+	 *
+	 */
+	struct RunBuffers
+	{
+		PDSampler _sampler;                                      ///< The sampler.
+		std::vector<cdt::DtPoint::spPoint> _points;              ///< The sample points.
+		std::vector<cdt::DtPoint::spPoint> _vertices;            ///< The vertices of the CDT.
+		std::vector<size_t> _edges;                              ///< The vertex indices of the edges of the CDT.
+		std::vector<size_t> _triangles;                          ///< The vertex indices of the triangles of the CDT.
+		std::vector<cdt::FaceVisitor::EdgeType> _edgeType;       ///< The type of each edge of the CDT.
+	};
+
+}
+
+/** @} */ //end of group class.
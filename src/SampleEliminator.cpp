@@ -0,0 +1,358 @@
+/**
+ * \file SampleEliminator.cpp
+ *
+ * \brief Implementation of the class SampleEliminator, which samples a
+ * surface with an exact number of points by weighted sample
+ * elimination.
+ *
+ * \author
+ * Adelino Afonso e Irene Ginani \n
+ * Universidade Federal do Rio Grande do Norte, \n
+ * Instituto Metr&oacute;pole Digital, \n
+ * Adelino Afonso at imd (dot) ufrn (dot) br, \n
+ * Irene Ginani at imd (dot) ufrn (dot) br
+ *
+ * \version 1.0
+ * \date October 2026
+ *
+ * \attention This program is distributed WITHOUT ANY WARRANTY, and it
+ *            may be freely redistributed under the condition that the
+ *            copyright notices  are not removed,  and no compensation
+ *            is received. Private, research, and institutional use is
+ *            free. Distribution of this  code as part of a commercial
+ *            system  is permissible ONLY  BY DIRECT  ARRANGEMENT WITH
+ *            THE AUTHOR.
+ */
+
+#include "SampleEliminator.h"    // SampleEliminator
+#include "SamplePoint.h"         // SamplePoint
+#include "Random.h"              // Random
+#include "KdTree.h"              // KdTree
+#include "Parallel.h"            // ParallelFor, DefaultNumberOfThreads
+
+#include <algorithm>             // std::min, std::max
+#include <cmath>                 // sqrt, pow, ceil
+#include <stdexcept>             // std::runtime_error
+
+
+/**
+ * \defgroup MAT309NameSpace Namespace MAT309.
+ * @{
+ */
+
+/**
+ * \namespace MAT309
+ *
+ * \brief Global namespace for MAT309 software.
+ */
+
+namespace MAT309
+{
+
+	/**
+	 * \fn void SampleEliminator::Sample(const spSurface& surface, size_t numberOfSamples, size_t& numberOfPoints, std::vector<spPoint>& points) const
+	 *
+	 * \brief Samples a surface with an exact number of points.
+	 *
+	 * \param surface A pointer to the surface to be sampled.
+	 * \param numberOfSamples The number of sample points wanted (at
+	 * least 4, for the corners of the domain).
+	 * \param numberOfPoints A reference to the number of sample points
+	 * (always \c numberOfSamples).
+	 * \param points A reference to an array of sample points.
+	 *
+	 */
+	void
+		SampleEliminator::Sample(
+			const spSurface& surface,
+			size_t numberOfSamples,
+			size_t& numberOfPoints,
+			std::vector<spPoint>& points
+		)
+		const
+	{
+		if (numberOfSamples < 4)
+		{
+			throw std::runtime_error("At least four sample points (the corners of the domain) are needed.");
+		}
+
+		const double umin = surface->GetUMin();
+		const double umax = surface->GetUMax();
+		const double vmin = surface->GetVMin();
+		const double vmax = surface->GetVMax();
+
+		// Draw the candidates: the four corners of the domain, which
+		// are never eliminated, and uniform parameter points.
+		const size_t numberOfCorners = 4;
+		const size_t m = std::max(numberOfSamples, size_t(ceil(_candidatesPerSample * numberOfSamples)));
+
+		std::vector<double> uv(2 * m);
+
+		uv[0] = umin; uv[1] = vmin;
+		uv[2] = umax; uv[3] = vmin;
+		uv[4] = umin; uv[5] = vmax;
+		uv[6] = umax; uv[7] = vmax;
+
+		Random random(_seed);
+
+		for (size_t i = numberOfCorners; i < m; i++)
+		{
+			uv[2 * i] = umin + random.draw() * (umax - umin);
+			uv[2 * i + 1] = vmin + random.draw() * (vmax - vmin);
+		}
+
+		// Evaluate the candidates on the surface, with the area element
+		// at each of them to estimate the area of the surface.
+		std::vector<double> xyz(3 * m);
+		std::vector<double> jacobian(m);
+
+		ParallelFor(
+			0,
+			m,
+			_numberOfThreads,
+			[&](size_t first, size_t last)
+			{
+				for (size_t i = first; i < last; i++)
+				{
+					surface->GetPoint(uv[2 * i], uv[2 * i + 1], xyz[3 * i], xyz[3 * i + 1], xyz[3 * i + 2]);
+
+					double e, f, g;
+					surface->GetFirstFundamentalForm(uv[2 * i], uv[2 * i + 1], e, f, g);
+
+					jacobian[i] = sqrt(std::max(0.0, e * g - f * f));
+				}
+			}
+		);
+
+		double area = 0;
+
+		for (size_t i = numberOfCorners; i < m; i++)
+		{
+			area += jacobian[i];
+		}
+
+		area *= (umax - umin) * (vmax - vmin) / std::max(size_t(1), m - numberOfCorners);
+
+		// Weights fall from 1 to 0 as the distance grows from rmin to
+		// 2 rmax, rmax being the radius of a hexagonal packing of the
+		// samples over the area, and rmin keeping clusters of close
+		// candidates from dominating the weights (Yuksel's defaults).
+		const double rmax = sqrt(area / (2 * sqrt(3.0) * numberOfSamples));
+		const double rmin = rmax * (1 - pow(double(numberOfSamples) / double(m), 1.5)) * 0.65;
+		const double reach = 2 * rmax;
+
+		auto Weight = [rmin, reach](double d)
+		{
+			return pow(1 - std::max(d, rmin) / reach, 8);
+		};
+
+		// Find the neighbours of each candidate within 2 rmax,  in
+		// blocks of candidates, one block per thread.
+		KdTree<3> tree;
+		tree.Build(m, xyz.data());
+
+		size_t numberOfThreads = (_numberOfThreads == 0) ? DefaultNumberOfThreads() : _numberOfThreads;
+		size_t numberOfBlocks = std::max(size_t(1), std::min(numberOfThreads, m));
+
+		std::vector< std::vector<size_t> > blockNeighbours(numberOfBlocks);
+		std::vector< std::vector<double> > blockWeights(numberOfBlocks);
+		std::vector<size_t> offsets(m + 1);
+		std::vector<double> weights(m, 0);
+
+		auto blockBegin = [&](size_t b) { return (b * m) / numberOfBlocks; };
+
+		ParallelFor(
+			0,
+			numberOfBlocks,
+			numberOfBlocks,
+			[&](size_t firstBlock, size_t lastBlock)
+			{
+				std::vector<size_t> found;
+
+				for (size_t b = firstBlock; b < lastBlock; b++)
+				{
+					for (size_t i = blockBegin(b); i < blockBegin(b + 1); i++)
+					{
+						const double* x = tree.GetPoint(i);
+
+						tree.FindInRadius(x, reach, found);
+
+						size_t count = 0;
+
+						for (size_t j : found)
+						{
+							if (j == i)
+							{
+								continue;
+							}
+
+							const double* y = tree.GetPoint(j);
+
+							double dx = x[0] - y[0];
+							double dy = x[1] - y[1];
+							double dz = x[2] - y[2];
+
+							double w = Weight(sqrt(dx * dx + dy * dy + dz * dz));
+
+							blockNeighbours[b].push_back(j);
+							blockWeights[b].push_back(w);
+
+							weights[i] += w;
+							count++;
+						}
+
+						offsets[i] = count;
+					}
+				}
+			}
+		);
+
+		size_t total = 0;
+
+		for (size_t i = 0; i < m; i++)
+		{
+			size_t count = offsets[i];
+			offsets[i] = total;
+			total += count;
+		}
+
+		offsets[m] = total;
+
+		std::vector<size_t> neighbours;
+		std::vector<double> neighbourWeights;
+
+		neighbours.reserve(total);
+		neighbourWeights.reserve(total);
+
+		for (size_t b = 0; b < numberOfBlocks; b++)
+		{
+			neighbours.insert(neighbours.end(), blockNeighbours[b].begin(), blockNeighbours[b].end());
+			neighbourWeights.insert(neighbourWeights.end(), blockWeights[b].begin(), blockWeights[b].end());
+
+			std::vector<size_t>().swap(blockNeighbours[b]);
+			std::vector<double>().swap(blockWeights[b]);
+		}
+
+		// Keep the candidates other than the corners in a max-heap of
+		// their weights, ties going to the later candidate.
+		const size_t NONE = size_t(-1);
+
+		std::vector<size_t> heap;
+		std::vector<size_t> position(m, NONE);
+
+		heap.reserve(m - numberOfCorners);
+
+		auto Heavier = [&](size_t a, size_t b)
+		{
+			return (weights[a] > weights[b]) || ((weights[a] == weights[b]) && (a > b));
+		};
+
+		auto SiftDown = [&](size_t k)
+		{
+			size_t n = heap.size();
+			size_t i = heap[k];
+
+			for (;;)
+			{
+				size_t child = 2 * k + 1;
+
+				if (child >= n)
+				{
+					break;
+				}
+
+				if ((child + 1 < n) && Heavier(heap[child + 1], heap[child]))
+				{
+					child++;
+				}
+
+				if (!Heavier(heap[child], i))
+				{
+					break;
+				}
+
+				heap[k] = heap[child];
+				position[heap[k]] = k;
+				k = child;
+			}
+
+			heap[k] = i;
+			position[i] = k;
+		};
+
+		for (size_t i = numberOfCorners; i < m; i++)
+		{
+			position[i] = heap.size();
+			heap.push_back(i);
+		}
+
+		for (size_t k = heap.size() / 2; k-- > 0; )
+		{
+			SiftDown(k);
+		}
+
+		// Remove the heaviest candidate until the number of samples is
+		// reached.  Removing a candidate only lowers the weights of its
+		// neighbours, so they only need to sift down.
+		std::vector<bool> removed(m, false);
+
+		for (size_t r = m; r > numberOfSamples; r--)
+		{
+			size_t i = heap[0];
+
+			removed[i] = true;
+			position[i] = NONE;
+
+			heap[0] = heap.back();
+			heap.pop_back();
+
+			if (!heap.empty())
+			{
+				position[heap[0]] = 0;
+				SiftDown(0);
+			}
+
+			for (size_t k = offsets[i]; k < offsets[i + 1]; k++)
+			{
+				size_t j = neighbours[k];
+
+				if (removed[j])
+				{
+					continue;
+				}
+
+				weights[j] -= neighbourWeights[k];
+
+				if (position[j] != NONE)
+				{
+					SiftDown(position[j]);
+				}
+			}
+		}
+
+		// The candidates left, in the order they were drawn.
+		points.clear();
+		points.reserve(numberOfSamples);
+
+		for (size_t i = 0; i < m; i++)
+		{
+			if (!removed[i])
+			{
+				SamplePoint::Point pos;
+
+				pos._x = xyz[3 * i];
+				pos._y = xyz[3 * i + 1];
+				pos._z = xyz[3 * i + 2];
+
+				points.push_back(std::make_shared<SamplePoint>(SamplePoint(uv[2 * i], uv[2 * i + 1], pos)));
+			}
+		}
+
+		numberOfPoints = points.size();
+
+		return;
+	}
+
+}
+
+/** @} */ //end of group class.
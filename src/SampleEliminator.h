@@ -0,0 +1,168 @@
+/**
+ * \file SampleEliminator.h
+ *
+ * \brief This file contains the definition of a class that samples a
+ * surface with an exact number of points by weighted sample
+ * elimination.
+ *
+ * \author
+ * Adelino Afonso e Irene Ginani \n
+ * Universidade Federal do Rio Grande do Norte, \n
+ * Instituto Metr&oacute;pole Digital, \n
+ * Adelino Afonso at imd (dot) ufrn (dot) br, \n
+ * Irene Ginani at imd (dot) ufrn (dot) br
+ *
+ * \version 1.0
+ * \date October 2026
+ *
+ * \attention This program is distributed WITHOUT ANY WARRANTY, and it
+ *            may be freely redistributed under the condition that the
+ *            copyright notices  are not removed,  and no compensation
+ *            is received. Private, research, and institutional use is
+ *            free. Distribution of this  code as part of a commercial
+ *            system  is permissible ONLY  BY DIRECT  ARRANGEMENT WITH
+ *            THE AUTHOR.
+ */
+
+#pragma once
+
+#include "Surface.h"           // Surface
+#include "DtPoint.h"           // cdt::DtPoint
+
+#include <memory>              // std::shared_ptr
+#include <vector>              // std::vector
+
+
+/**
+ * \defgroup MAT309NameSpace Namespace MAT309.
+ * @{
+ */
+
+/**
+ * \namespace MAT309
+ *
+ * \brief Global namespace for MAT309 software.
+ *
+ */
+
+namespace MAT309
+{
+
+	/**
+	 * \class SampleEliminator
+	 *
+	 * \brief This class samples a surface with exactly a given number
+	 * N of points, spread like a Poisson disk sample (Yuksel, "Sample
+	 * Elimination for Generating Poisson Disk Sample Sets", 2015).
+	 *
+	 * About 5N candidates are drawn uniformly in the parameter domain
+	 * and evaluated on the surface in parallel.  Each candidate gets
+	 * a weight that adds up how close its neighbours are on the
+	 * surface, the neighbours being found with a kd-tree of the
+	 * surface points.  The heaviest candidate is then removed, and
+	 * the weights of its neighbours lowered, until N candidates are
+	 * left.  The four corners of the domain are always kept, as the
+	 * Poisson disk sampler keeps them.  The running time is O(N log N)
+	 * and does not depend on how the candidates fall.
+	 *
+	 */
+	class SampleEliminator
+	{
+	public:
+
+		// -----------------------------------------------------------
+		//
+		// Type definitions
+		//
+		// -----------------------------------------------------------
+
+		/**
+		 * \typedef spPoint
+		 *
+		 * \brief Alias for a shared pointer to DtPoint objects.
+		 *
+		 */
+		typedef cdt::DtPoint::spPoint spPoint;
+
+
+		/**
+		 * \typedef spSurface
+		 *
+		 * \brief Alias for a shared pointer to a surface.
+		 *
+		 */
+		typedef std::shared_ptr<Surface> spSurface;
+
+
+	private:
+
+		// -----------------------------------------------------------
+		//
+		// Private data members
+		//
+		// -----------------------------------------------------------
+
+		unsigned _seed;                  ///< Seed of the candidate generator.
+		double _candidatesPerSample;     ///< Number of candidates per sample point.
+		size_t _numberOfThreads;         ///< Number of threads (0 means one per hardware thread).
+
+
+	public:
+
+		// -----------------------------------------------------------
+		//
+		// Public methods
+		//
+		// -----------------------------------------------------------
+
+		/**
+		 * \fn SampleEliminator(unsigned seed = 1, double candidatesPerSample = 5, size_t numberOfThreads = 0)
+		 *
+		 * \brief Creates an instance of this class.
+		 *
+		 * \param seed Seed of the candidate generator.
+		 * \param candidatesPerSample Number of candidates per sample
+		 * point (at least 1).
+		 * \param numberOfThreads Number of threads (0 means one per
+		 * hardware thread).
+		 *
+		 */
+		SampleEliminator(
+			unsigned seed = 1,
+			double candidatesPerSample = 5,
+			size_t numberOfThreads = 0
+		)
+			:
+			_seed(seed),
+			_candidatesPerSample((candidatesPerSample > 1) ? candidatesPerSample : 1),
+			_numberOfThreads(numberOfThreads)
+		{
+		}
+
+
+		/**
+		 * \fn void Sample(const spSurface& surface, size_t numberOfSamples, size_t& numberOfPoints, std::vector<spPoint>& points) const
+		 *
+		 * \brief Samples a surface with an exact number of points.
+		 *
+		 * \param surface A pointer to the surface to be sampled.
+		 * \param numberOfSamples The number of sample points wanted
+		 * (at least 4, for the corners of the domain).
+		 * \param numberOfPoints A reference to the number of sample
+		 * points (always \c numberOfSamples).
+		 * \param points A reference to an array of sample points.
+		 *
+		 */
+		void
+			Sample(
+				const spSurface& surface,
+				size_t numberOfSamples,
+				size_t& numberOfPoints,
+				std::vector<spPoint>& points
+			)
+			const;
+	};
+
+}
+
+/** @} */ //end of group class.
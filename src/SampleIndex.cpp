@@ -0,0 +1,255 @@
+/**
+ * \file SampleIndex.cpp
+ *
+ * \brief Implementation of the class SampleIndex, which indexes the
+ * parameter points of the accepted samples of a Poisson disk sampler.
+ *
+ * \author
+ * Adelino Afonso e Irene Ginani \n
+ * Universidade Federal do Rio Grande do Norte, \n
+ * Instituto Metr&oacute;pole Digital, \n
+ * Adelino Afonso at imd (dot) ufrn (dot) br, \n
+ * Irene Ginani at imd (dot) ufrn (dot) br
+ *
+ * \version 1.0
+ * \date October 2026
+ *
+ * \attention This program is distributed WITHOUT ANY WARRANTY, and it
+ *            may be freely redistributed under the condition that the
+ *            copyright notices  are not removed,  and no compensation
+ *            is received. Private, research, and institutional use is
+ *            free. Distribution of this  code as part of a commercial
+ *            system  is permissible ONLY  BY DIRECT  ARRANGEMENT WITH
+ *            THE AUTHOR.
+ */
+
+#include "SampleIndex.h"     // SampleIndex
+
+#include <algorithm>         // std::max
+#include <cmath>             // sqrt, std::hypot
+
+
+/**
+ * \defgroup MAT309NameSpace Namespace MAT309.
+ * @{
+ */
+
+/**
+ * \namespace MAT309
+ *
+ * \brief Global namespace for MAT309 software.
+ */
+
+namespace MAT309
+{
+
+	/**
+	 * \fn SampleIndex::SampleIndex(const spSurface& surface, double bound)
+	 *
+	 * \brief Creates an empty index.
+	 *
+	 * \param surface The sampled surface.
+	 * \param bound The largest radius of a candidate.
+	 *
+	 */
+	SampleIndex::SampleIndex(
+		const spSurface& surface,
+		double bound
+	)
+		:
+		_surface(surface),
+		_bound(bound),
+		_largest(0),
+		_farthest(0)
+	{
+		_cap = std::hypot(surface->GetUMax() - surface->GetUMin(), surface->GetVMax() - surface->GetVMin()) / 16;
+
+		_uPeriod = surface->IsPeriodicInU() ? surface->GetUMax() - surface->GetUMin() : 0;
+		_vPeriod = surface->IsPeriodicInV() ? surface->GetVMax() - surface->GetVMin() : 0;
+	}
+
+
+	/**
+	 * \fn void SampleIndex::SetBound(double bound)
+	 *
+	 * \brief Changes the largest radius of a candidate, and sorts the
+	 * samples into the tree again by their new reach.
+	 *
+	 * \param bound The largest radius of a candidate.
+	 *
+	 */
+	void
+		SampleIndex::SetBound(
+			double bound
+		)
+	{
+		_bound = bound;
+
+		_tree.Clear();
+		_indices.clear();
+		_distant.clear();
+		_farthest = 0;
+
+		for (size_t i = 0; i < _radii.size(); i++)
+		{
+			Place(i);
+		}
+
+		return;
+	}
+
+
+	/**
+	 * \fn size_t SampleIndex::Insert(double u, double v, double r)
+	 *
+	 * \brief Adds a sample to the index.
+	 *
+	 * \param u First parameter coordinate of the sample.
+	 * \param v Second parameter coordinate of the sample.
+	 * \param r The radius of the sample.
+	 *
+	 * \return The index of the sample.
+	 *
+	 */
+	size_t
+		SampleIndex::Insert(
+			double u,
+			double v,
+			double r
+		)
+	{
+		size_t i = _radii.size();
+
+		_coordinates.push_back(u);
+		_coordinates.push_back(v);
+		_radii.push_back(r);
+		_largest = std::max(_largest, r);
+
+		Place(i);
+
+		return i;
+	}
+
+
+	/**
+	 * \fn void SampleIndex::Find(double u, double v, double r, std::vector<size_t>& found)
+	 *
+	 * \brief Finds the samples a candidate may conflict with.
+	 *
+	 * \param u First parameter coordinate of the candidate.
+	 * \param v Second parameter coordinate of the candidate.
+	 * \param r The radius of the candidate, at most the bound.
+	 * \param found A reference to an array receiving the indices of the
+	 * samples, in no particular order.
+	 *
+	 */
+	void
+		SampleIndex::Find(
+			double u,
+			double v,
+			double r,
+			std::vector<size_t>& found
+		)
+	{
+		double reach = std::max((r + _largest) / Stretch(u, v), _farthest);
+
+		if (!(reach <= _cap))
+		{
+			// Near a point where the parametrization degenerates, the
+			// candidate is checked against every sample.
+			found.resize(_radii.size());
+
+			for (size_t i = 0; i < found.size(); i++)
+			{
+				found[i] = i;
+			}
+
+			return;
+		}
+
+		found.assign(_distant.begin(), _distant.end());
+
+		// Across a periodic side, the samples near the other side are
+		// found around a copy of the candidate.
+		for (int i = (_uPeriod > 0) ? -1 : 0; i <= ((_uPeriod > 0) ? 1 : 0); i++)
+		{
+			for (int j = (_vPeriod > 0) ? -1 : 0; j <= ((_vPeriod > 0) ? 1 : 0); j++)
+			{
+				double x[2] = { u + i * _uPeriod, v + j * _vPeriod };
+
+				_tree.FindInRadius(x, reach, _shifted);
+
+				for (size_t k : _shifted)
+				{
+					found.push_back(_indices[k]);
+				}
+			}
+		}
+
+		return;
+	}
+
+
+	/**
+	 * \fn double SampleIndex::Stretch(double u, double v) const
+	 *
+	 * \brief Computes the square root of the smallest eigenvalue of the
+	 * first fundamental form at a parameter point.
+	 *
+	 * \param u First coordinate of the parameter point.
+	 * \param v Second coordinate of the parameter point.
+	 *
+	 * \return The square root of the smallest eigenvalue, zero where
+	 * the parametrization degenerates.
+	 *
+	 */
+	double
+		SampleIndex::Stretch(
+			double u,
+			double v
+		)
+		const
+	{
+		double e, f, g;
+		_surface->GetFirstFundamentalForm(u, v, e, f, g);
+
+		double smallest = 0.5 * (e + g) - sqrt(0.25 * (e - g) * (e - g) + f * f);
+
+		return sqrt(std::max(0.0, smallest));
+	}
+
+
+	/**
+	 * \fn void SampleIndex::Place(size_t i)
+	 *
+	 * \brief Puts a sample in the tree, or in the list of distant
+	 * samples if its reach exceeds the cap.
+	 *
+	 * \param i The index of the sample.
+	 *
+	 */
+	void
+		SampleIndex::Place(
+			size_t i
+		)
+	{
+		const double* x = &_coordinates[2 * i];
+		double reach = (_bound + _radii[i]) / Stretch(x[0], x[1]);
+
+		if (!(reach <= _cap))
+		{
+			_distant.push_back(i);
+		}
+		else
+		{
+			_tree.Insert(x);
+			_indices.push_back(i);
+			_farthest = std::max(_farthest, reach);
+		}
+
+		return;
+	}
+
+}
+
+/** @} */ //end of group class.
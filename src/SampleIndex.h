@@ -0,0 +1,304 @@
+/**
+ * \file SampleIndex.h
+ *
+ * \brief This file contains the definition of a class that indexes the
+ * parameter points of the accepted samples of a Poisson disk sampler,
+ * so that a candidate is only checked against the samples it may
+ * conflict with.
+ *
+ * \author
+ * Adelino Afonso e Irene Ginani \n
+ * Universidade Federal do Rio Grande do Norte, \n
+ * Instituto Metr&oacute;pole Digital, \n
+ * Adelino Afonso at imd (dot) ufrn (dot) br, \n
+ * Irene Ginani at imd (dot) ufrn (dot) br
+ *
+ * \version 1.0
+ * \date October 2026
+ *
+ * \attention This program is distributed WITHOUT ANY WARRANTY, and it
+ *            may be freely redistributed under the condition that the
+ *            copyright notices  are not removed,  and no compensation
+ *            is received. Private, research, and institutional use is
+ *            free. Distribution of this  code as part of a commercial
+ *            system  is permissible ONLY  BY DIRECT  ARRANGEMENT WITH
+ *            THE AUTHOR.
+ */
+
+#pragma once
+
+#include "Surface.h"           // Surface
+#include "../common/KdTree.h"  // KdTree
+
+#include <memory>              // std::shared_ptr
+#include <vector>              // std::vector
+
+
+/**
+ * \defgroup MAT309NameSpace Namespace MAT309.
+ * @{
+ */
+
+/**
+ * \namespace MAT309
+ *
+ * \brief Global namespace for MAT309 software.
+ *
+ */
+
+namespace MAT309
+{
+
+	/**
+	 * \class SampleIndex
+	 *
+	 * \brief This class keeps the parameter point and the radius of
+	 * each accepted sample of a Poisson disk sampler, and finds the
+	 * samples a candidate may conflict with.
+	 *
+	 * Two samples conflict if their distance under the first
+	 * fundamental form at either of them is smaller than the sum of
+	 * their radii.  That distance is at least the square root of the
+	 * smallest eigenvalue of the form, the stretch, times the distance
+	 * in the parameter plane.  So a sample can only conflict with a
+	 * candidate within its reach, (bound + its radius) over the stretch
+	 * at it, where the bound is the largest radius of a candidate, and
+	 * a candidate only with the samples within (its radius + the
+	 * largest radius of a sample) over the stretch at it.  The
+	 * parameter points are kept in a kd-tree, except those of the
+	 * samples whose reach is more than a sixteenth of the diagonal of
+	 * the domain, near a point where the parametrization degenerates
+	 * (such as a pole), which are returned for every candidate so that
+	 * they do not widen the search around all the others.
+	 *
+	 */
+	class SampleIndex
+	{
+	public:
+
+		// -----------------------------------------------------------
+		//
+		// Type definitions
+		//
+		// -----------------------------------------------------------
+
+		/**
+		 * \typedef spSurface
+		 *
+		 * \brief Alias for a shared pointer to a surface.
+		 *
+		 */
+		typedef std::shared_ptr<Surface> spSurface;
+
+
+	private:
+
+		// -----------------------------------------------------------
+		//
+		// Private data members
+		//
+		// -----------------------------------------------------------
+
+		spSurface _surface;                 ///< The sampled surface.
+		double _bound;                      ///< The largest radius of a candidate.
+		double _cap;                        ///< The largest reach of a sample kept in the tree.
+		double _uPeriod;                    ///< The period along u (0 if the surface is not periodic in u).
+		double _vPeriod;                    ///< The period along v (0 if the surface is not periodic in v).
+		std::vector<double> _coordinates;   ///< The u and v coordinates of each sample.
+		std::vector<double> _radii;         ///< The radius of each sample.
+		double _largest;                    ///< The largest radius of a sample.
+		KdTree<2> _tree;                    ///< The parameter points of the samples within the cap.
+		std::vector<size_t> _indices;       ///< The sample of each point of the tree.
+		std::vector<size_t> _distant;       ///< The samples whose reach exceeds the cap.
+		double _farthest;                   ///< The largest reach of a sample of the tree.
+		std::vector<size_t> _shifted;       ///< The points of the tree found around a copy of a candidate.
+
+
+	public:
+
+		// -----------------------------------------------------------
+		//
+		// Public methods
+		//
+		// -----------------------------------------------------------
+
+		/**
+		 * \fn SampleIndex(const spSurface& surface, double bound)
+		 *
+		 * \brief Creates an empty index.
+		 *
+		 * \param surface The sampled surface.
+		 * \param bound The largest radius of a candidate.
+		 *
+		 */
+		SampleIndex(
+			const spSurface& surface,
+			double bound
+		);
+
+
+		/**
+		 * \fn void SetBound(double bound)
+		 *
+		 * \brief Changes the largest radius of a candidate, and sorts
+		 * the samples into the tree again by their new reach.
+		 *
+		 * \param bound The largest radius of a candidate.
+		 *
+		 */
+		void
+			SetBound(
+				double bound
+			);
+
+
+		/**
+		 * \fn size_t Insert(double u, double v, double r)
+		 *
+		 * \brief Adds a sample to the index.
+		 *
+		 * \param u First parameter coordinate of the sample.
+		 * \param v Second parameter coordinate of the sample.
+		 * \param r The radius of the sample.
+		 *
+		 * \return The index of the sample.
+		 *
+		 */
+		size_t
+			Insert(
+				double u,
+				double v,
+				double r
+			);
+
+
+		/**
+		 * \fn void Find(double u, double v, double r, std::vector<size_t>& found)
+		 *
+		 * \brief Finds the samples a candidate may conflict with.
+		 *
+		 * \param u First parameter coordinate of the candidate.
+		 * \param v Second parameter coordinate of the candidate.
+		 * \param r The radius of the candidate, at most the bound.
+		 * \param found A reference to an array receiving the indices of
+		 * the samples, in no particular order.
+		 *
+		 */
+		void
+			Find(
+				double u,
+				double v,
+				double r,
+				std::vector<size_t>& found
+			);
+
+
+		/**
+		 * \fn size_t GetSize() const
+		 *
+		 * \brief Returns the number of samples of the index.
+		 *
+		 * \return The number of samples of the index.
+		 *
+		 */
+		size_t GetSize() const
+		{
+			return _radii.size();
+		}
+
+
+		/**
+		 * \fn double GetU(size_t i) const
+		 *
+		 * \brief Returns the first parameter coordinate of a sample.
+		 *
+		 * \param i The index of the sample.
+		 *
+		 * \return The first parameter coordinate of the sample.
+		 *
+		 */
+		double GetU(size_t i) const
+		{
+			return _coordinates[2 * i];
+		}
+
+
+		/**
+		 * \fn double GetV(size_t i) const
+		 *
+		 * \brief Returns the second parameter coordinate of a sample.
+		 *
+		 * \param i The index of the sample.
+		 *
+		 * \return The second parameter coordinate of the sample.
+		 *
+		 */
+		double GetV(size_t i) const
+		{
+			return _coordinates[2 * i + 1];
+		}
+
+
+		/**
+		 * \fn double GetRadius(size_t i) const
+		 *
+		 * \brief Returns the radius of a sample.
+		 *
+		 * \param i The index of the sample.
+		 *
+		 * \return The radius of the sample.
+		 *
+		 */
+		double GetRadius(size_t i) const
+		{
+			return _radii[i];
+		}
+
+
+	private:
+
+		// -----------------------------------------------------------
+		//
+		// Private methods
+		//
+		// -----------------------------------------------------------
+
+		/**
+		 * \fn double Stretch(double u, double v) const
+		 *
+		 * \brief Computes the square root of the smallest eigenvalue of
+		 * the first fundamental form at a parameter point.
+		 *
+		 * \param u First coordinate of the parameter point.
+		 * \param v Second coordinate of the parameter point.
+		 *
+		 * \return The square root of the smallest eigenvalue, zero
+		 * where the parametrization degenerates.
+		 *
+		 */
+		double
+			Stretch(
+				double u,
+				double v
+			)
+			const;
+
+
+		/**
+		 * \fn void Place(size_t i)
+		 *
+		 * \brief Puts a sample in the tree, or in the list of distant
+		 * samples if its reach exceeds the cap.
+		 *
+		 * \param i The index of the sample.
+		 *
+		 */
+		void
+			Place(
+				size_t i
+			);
+	};
+
+}
+
+/** @} */ //end of group class.
@@ -0,0 +1,421 @@
+/**
+ * \file SeamWrapper.cpp
+ *
+ * \brief Implementation of the class SeamWrapper, which makes the CDT
+ * of the samples of a periodic surface wrap around its seams.
+ *
+ * \author
+ * Adelino Afonso e Irene Ginani \n
+ * Universidade Federal do Rio Grande do Norte, \n
+ * Instituto Metr&oacute;pole Digital, \n
+ * Adelino Afonso at imd (dot) ufrn (dot) br, \n
+ * Irene Ginani at imd (dot) ufrn (dot) br
+ *
+ * \version 1.0
+ * \date October 2026
+ *
+ * \attention This program is distributed WITHOUT ANY WARRANTY, and it
+ *            may be freely redistributed under the condition that the
+ *            copyright notices  are not removed,  and no compensation
+ *            is received. Private, research, and institutional use is
+ *            free. Distribution of this  code as part of a commercial
+ *            system  is permissible ONLY  BY DIRECT  ARRANGEMENT WITH
+ *            THE AUTHOR.
+ */
+
+#include "SeamWrapper.h"         // SeamWrapper
+#include "SamplePoint.h"         // SamplePoint
+#include "AlphaEstimator.h"      // AlphaEstimator
+
+#include <algorithm>             // std::min, std::max
+#include <cmath>                 // sqrt
+#include <set>                   // std::set
+#include <utility>               // std::pair
+
+
+/**
+ * \defgroup MAT309NameSpace Namespace MAT309.
+ * @{
+ */
+
+/**
+ * \namespace MAT309
+ *
+ * \brief Global namespace for MAT309 software.
+ */
+
+namespace MAT309
+{
+
+	/**
+	 * \fn size_t SeamWrapper::RemoveDuplicates(size_t& numberOfPoints, std::vector<spPoint>& points, std::vector<size_t>& ends) const
+	 *
+	 * \brief Removes the samples on the upper side of a seam that have
+	 * a sample at the same place on the lower side.
+	 *
+	 * \param numberOfPoints A reference to the number of samples.
+	 * \param points A reference to an array of samples.
+	 * \param ends A reference to an array with the indices past the
+	 * last sample of ranges of samples, which are moved back past the
+	 * samples removed.
+	 *
+	 * \return The number of samples removed.
+	 *
+	 */
+	size_t
+		SeamWrapper::RemoveDuplicates(
+			size_t& numberOfPoints,
+			std::vector<spPoint>& points,
+			std::vector<size_t>& ends
+		)
+		const
+	{
+		const bool periodicU = _surface->IsPeriodicInU();
+		const bool periodicV = _surface->IsPeriodicInV();
+
+		const double umin = _surface->GetUMin();
+		const double umax = _surface->GetUMax();
+		const double vmin = _surface->GetVMin();
+		const double vmax = _surface->GetVMax();
+
+		// The samples on the lower sides.
+		std::set< std::pair<double, double> > lower;
+
+		for (size_t i = 0; i < numberOfPoints; i++)
+		{
+			double u = points[i]->GetU();
+			double v = points[i]->GetV();
+
+			if ((periodicU && (u == umin)) || (periodicV && (v == vmin)))
+			{
+				lower.insert(std::make_pair(u, v));
+			}
+		}
+
+		// The number of samples kept before each sample.
+		std::vector<size_t> before(numberOfPoints + 1);
+
+		size_t kept = 0;
+
+		for (size_t i = 0; i < numberOfPoints; i++)
+		{
+			before[i] = kept;
+
+			double u = points[i]->GetU();
+			double v = points[i]->GetV();
+
+			if ((periodicU && (u == umax)) || (periodicV && (v == vmax)))
+			{
+				double su = (periodicU && (u == umax)) ? umin : u;
+				double sv = (periodicV && (v == vmax)) ? vmin : v;
+
+				if (lower.count(std::make_pair(su, sv)) > 0)
+				{
+					continue;
+				}
+			}
+
+			points[kept++] = points[i];
+		}
+
+		before[numberOfPoints] = kept;
+
+		for (size_t& end : ends)
+		{
+			end = before[std::min(end, numberOfPoints)];
+		}
+
+		size_t removed = numberOfPoints - kept;
+
+		points.erase(points.begin() + kept, points.begin() + numberOfPoints);
+		numberOfPoints = kept;
+
+		return removed;
+	}
+
+
+	/**
+	 * \fn void SeamWrapper::AddGhosts(size_t first, size_t last, const std::vector<spPoint>& points, std::vector<spPoint>& ghosts)
+	 *
+	 * \brief Makes the ghosts of a range of samples.
+	 *
+	 * \param first The index of the first sample of the range.
+	 * \param last The index past the last sample of the range.
+	 * \param points An array of samples.
+	 * \param ghosts A reference to an array to which the ghosts are
+	 * appended.
+	 *
+	 */
+	void
+		SeamWrapper::AddGhosts(
+			size_t first,
+			size_t last,
+			const std::vector<spPoint>& points,
+			std::vector<spPoint>& ghosts
+		)
+	{
+		const bool periodicU = _surface->IsPeriodicInU();
+		const bool periodicV = _surface->IsPeriodicInV();
+
+		const double umin = _surface->GetUMin();
+		const double umax = _surface->GetUMax();
+		const double vmin = _surface->GetVMin();
+		const double vmax = _surface->GetVMax();
+
+		const double periodU = umax - umin;
+		const double periodV = vmax - vmin;
+
+		// The samples may be farther apart than alpha tells, as when
+		// they were loaded or drawn by sample elimination, so take the
+		// radius a dart throwing sample of as many points would have
+		// if it is larger.
+		double radius = _alpha;
+
+		if (last >= 4)
+		{
+			AlphaEstimator estimator(100, 1, 0);
+
+			radius = std::max(radius, estimator.Estimate(_surface, last));
+		}
+
+		// Every point of the surface is within 2 radius of a sample, so
+		// an empty circle of the parameter plane has a diameter of at
+		// most 4 radius / sqrt(lambda), lambda being the smallest
+		// eigenvalue of the first fundamental form around it.  Reach
+		// half as far again, and at most half the period.
+		const double reach = 6 * radius;
+
+		for (size_t i = first; i < last; i++)
+		{
+			const spPoint& p = points[i];
+
+			double u = p->GetU();
+			double v = p->GetV();
+
+			double e, f, g;
+			_surface->GetFirstFundamentalForm(u, v, e, f, g);
+
+			double mean = (e + g) / 2;
+			double diff = (e - g) / 2;
+			double lambda = mean - sqrt(diff * diff + f * f);
+
+			double reachU = periodU / 2;
+			double reachV = periodV / 2;
+
+			if (lambda > 0)
+			{
+				reachU = std::min(reachU, reach / sqrt(lambda));
+				reachV = std::min(reachV, reach / sqrt(lambda));
+			}
+
+			// The shifts, in periods, of the ghosts along each coordinate.
+			// The corners of the domain are also copied a whole period
+			// past the ghosts, so that the CDT covers the ghosts of the
+			// samples inserted later, as in a progressive sample.
+			const bool corner = ((u == umin) || (u == umax)) && ((v == vmin) || (v == vmax));
+
+			int shiftsU[4] = { 0 };
+			int shiftsV[4] = { 0 };
+			size_t nu = 1;
+			size_t nv = 1;
+
+			if (periodicU && (corner || (u - umin < reachU)))
+			{
+				shiftsU[nu++] = 1;
+			}
+
+			if (periodicU && (corner || (umax - u < reachU)))
+			{
+				shiftsU[nu++] = -1;
+			}
+
+			if (periodicU && corner)
+			{
+				shiftsU[nu++] = (u == umin) ? 2 : -2;
+			}
+
+			if (periodicV && (corner || (v - vmin < reachV)))
+			{
+				shiftsV[nv++] = 1;
+			}
+
+			if (periodicV && (corner || (vmax - v < reachV)))
+			{
+				shiftsV[nv++] = -1;
+			}
+
+			if (periodicV && corner)
+			{
+				shiftsV[nv++] = (v == vmin) ? 2 : -2;
+			}
+
+			if ((nu == 1) && (nv == 1))
+			{
+				continue;
+			}
+
+			SamplePoint::Point pos;
+
+			std::shared_ptr<SamplePoint> sp = std::dynamic_pointer_cast<SamplePoint>(p);
+
+			if (sp != nullptr)
+			{
+				pos = sp->_pos;
+			}
+			else
+			{
+				_surface->GetPoint(u, v, pos._x, pos._y, pos._z);
+			}
+
+			for (size_t a = 0; a < nu; a++)
+			{
+				for (size_t b = 0; b < nv; b++)
+				{
+					if ((a == 0) && (b == 0))
+					{
+						continue;
+					}
+
+					spPoint ghost = std::make_shared<SamplePoint>(
+						SamplePoint(u + shiftsU[a] * periodU, v + shiftsV[b] * periodV, pos)
+					);
+
+					_originals[ghost.get()] = p;
+					ghosts.push_back(ghost);
+				}
+			}
+		}
+
+		return;
+	}
+
+
+	/**
+	 * \fn size_t SeamWrapper::Stitch(size_t& numberOfTriangles, std::vector<size_t>& triangles, size_t& numberOfVertices, std::vector<spPoint>& vertices) const
+	 *
+	 * \brief Keeps the triangles whose centroid lies in the domain,
+	 * makes them use samples instead of ghosts, and removes the ghosts
+	 * from the vertices.
+	 *
+	 * \param numberOfTriangles A reference to the number of triangles.
+	 * \param triangles A reference to an array with the vertex indices
+	 * of all triangles.
+	 * \param numberOfVertices A reference to the number of vertices.
+	 * \param vertices A reference to an array with all vertices.
+	 *
+	 * \return The number of ghosts removed from the vertices.
+	 *
+	 */
+	size_t
+		SeamWrapper::Stitch(
+			size_t& numberOfTriangles,
+			std::vector<size_t>& triangles,
+			size_t& numberOfVertices,
+			std::vector<spPoint>& vertices
+		)
+		const
+	{
+		const bool periodicU = _surface->IsPeriodicInU();
+		const bool periodicV = _surface->IsPeriodicInV();
+
+		const double umin = _surface->GetUMin();
+		const double umax = _surface->GetUMax();
+		const double vmin = _surface->GetVMin();
+		const double vmax = _surface->GetVMax();
+
+		// The index of each vertex, by point.
+		std::unordered_map<const cdt::DtPoint*, size_t> index;
+
+		index.reserve(numberOfVertices);
+
+		for (size_t i = 0; i < numberOfVertices; i++)
+		{
+			index[vertices[i].get()] = i;
+		}
+
+		// The vertex each vertex stands for: the vertex of its sample
+		// for a ghost, and itself otherwise.
+		std::vector<size_t> target(numberOfVertices);
+
+		for (size_t i = 0; i < numberOfVertices; i++)
+		{
+			target[i] = i;
+
+			auto original = _originals.find(vertices[i].get());
+
+			if (original != _originals.end())
+			{
+				auto j = index.find(original->second.get());
+
+				if (j != index.end())
+				{
+					target[i] = j->second;
+				}
+			}
+		}
+
+		// Keep one copy of each triangle.
+		size_t kept = 0;
+
+		for (size_t t = 0; t < numberOfTriangles; t++)
+		{
+			size_t a = triangles[3 * t];
+			size_t b = triangles[3 * t + 1];
+			size_t c = triangles[3 * t + 2];
+
+			double u = (vertices[a]->GetU() + vertices[b]->GetU() + vertices[c]->GetU()) / 3;
+			double v = (vertices[a]->GetV() + vertices[b]->GetV() + vertices[c]->GetV()) / 3;
+
+			if ((periodicU && ((u < umin) || (u >= umax))) || (periodicV && ((v < vmin) || (v >= vmax))))
+			{
+				continue;
+			}
+
+			a = target[a];
+			b = target[b];
+			c = target[c];
+
+			if ((a == b) || (b == c) || (c == a))
+			{
+				continue;
+			}
+
+			triangles[3 * kept] = a;
+			triangles[3 * kept + 1] = b;
+			triangles[3 * kept + 2] = c;
+			kept++;
+		}
+
+		// Remove the ghosts, keeping the order of the other vertices.
+		std::vector<size_t> renumbered(numberOfVertices);
+
+		size_t numberOfKeptVertices = 0;
+
+		for (size_t i = 0; i < numberOfVertices; i++)
+		{
+			if (target[i] == i)
+			{
+				renumbered[i] = numberOfKeptVertices;
+				vertices[numberOfKeptVertices++] = vertices[i];
+			}
+		}
+
+		for (size_t k = 0; k < 3 * kept; k++)
+		{
+			triangles[k] = renumbered[triangles[k]];
+		}
+
+		size_t removed = numberOfVertices - numberOfKeptVertices;
+
+		numberOfTriangles = kept;
+		numberOfVertices = numberOfKeptVertices;
+
+		triangles.resize(3 * numberOfTriangles);
+		vertices.resize(numberOfVertices);
+
+		return removed;
+	}
+
+}
+
+/** @} */ //end of group class.
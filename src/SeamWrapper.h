@@ -0,0 +1,260 @@
+/**
+ * \file SeamWrapper.h
+ *
+ * \brief This file contains the definition of a class that makes the
+ * CDT of the samples of a periodic surface wrap around its seams.
+ *
+ * \author
+ * Adelino Afonso e Irene Ginani \n
+ * Universidade Federal do Rio Grande do Norte, \n
+ * Instituto Metr&oacute;pole Digital, \n
+ * Adelino Afonso at imd (dot) ufrn (dot) br, \n
+ * Irene Ginani at imd (dot) ufrn (dot) br
+ *
+ * \version 1.0
+ * \date October 2026
+ *
+ * \attention This program is distributed WITHOUT ANY WARRANTY, and it
+ *            may be freely redistributed under the condition that the
+ *            copyright notices  are not removed,  and no compensation
+ *            is received. Private, research, and institutional use is
+ *            free. Distribution of this  code as part of a commercial
+ *            system  is permissible ONLY  BY DIRECT  ARRANGEMENT WITH
+ *            THE AUTHOR.
+ */
+
+#pragma once
+
+#include "Surface.h"           // Surface
+#include "DtPoint.h"           // cdt::DtPoint
+
+#include <memory>              // std::shared_ptr
+#include <unordered_map>       // std::unordered_map
+#include <vector>              // std::vector
+
+
+/**
+ * \defgroup MAT309NameSpace Namespace MAT309.
+ * @{
+ */
+
+/**
+ * \namespace MAT309
+ *
+ * \brief Global namespace for MAT309 software.
+ *
+ */
+
+namespace MAT309
+{
+
+	/**
+	 * \class SeamWrapper
+	 *
+	 * \brief This class makes the CDT of the samples of a surface that
+	 * is periodic in u or v (see Surface::IsPeriodicInU()) wrap around
+	 * the seams of its domain, so that the output mesh has neither a
+	 * crack nor duplicate vertices along them.
+	 *
+	 * The samples near each side of a seam are copied past the other
+	 * side, shifted by the period, and the copies (ghosts) are
+	 * triangulated along with the samples.  Near the seam, the CDT of
+	 * the samples and ghosts is then the CDT of the samples repeated
+	 * periodically.  Once the triangles are collected, Stitch() keeps
+	 * those whose centroid lies in the domain, which is one copy of
+	 * each triangle, and makes them use the samples instead of the
+	 * ghosts.  The ghosts reach past the seam as far as an empty
+	 * circle of the samples can, which is estimated from the first
+	 * fundamental form at each sample and the sample spacing.
+	 *
+	 * The mapping from ghosts to samples is kept by point, so the
+	 * ghosts must reach the CDT unchanged: the vertices must not be
+	 * moved or replaced, as Lloyd iterations do.  The CDT must also be
+	 * invariant under the shift by the period, as it is with the
+	 * incircle test of the parameter plane.
+	 *
+	 */
+	class SeamWrapper
+	{
+	public:
+
+		// -----------------------------------------------------------
+		//
+		// Type definitions
+		//
+		// -----------------------------------------------------------
+
+		/**
+		 * \typedef spPoint
+		 *
+		 * \brief Alias for a shared pointer to DtPoint objects.
+		 *
+		 */
+		typedef cdt::DtPoint::spPoint spPoint;
+
+
+		/**
+		 * \typedef spSurface
+		 *
+		 * \brief Alias for a shared pointer to a surface.
+		 *
+		 */
+		typedef std::shared_ptr<Surface> spSurface;
+
+
+	private:
+
+		// -----------------------------------------------------------
+		//
+		// Private data members
+		//
+		// -----------------------------------------------------------
+
+		spSurface _surface;    ///< The surface the samples lie on.
+		double _alpha;         ///< The Poisson disk radius of the samples (the largest one, if it varies).
+
+		std::unordered_map<const cdt::DtPoint*, spPoint> _originals;   ///< The sample each ghost is a copy of.
+
+
+	public:
+
+		// -----------------------------------------------------------
+		//
+		// Public methods
+		//
+		// -----------------------------------------------------------
+
+		/**
+		 * \fn SeamWrapper(const spSurface& surface, double alpha)
+		 *
+		 * \brief Creates an instance of this class.
+		 *
+		 * \param surface The surface the samples lie on.
+		 * \param alpha The Poisson disk radius of the samples (the
+		 * largest one, if it varies).
+		 *
+		 */
+		SeamWrapper(
+			const spSurface& surface,
+			double alpha
+		)
+			:
+			_surface(surface),
+			_alpha(alpha)
+		{
+		}
+
+
+		/**
+		 * \fn bool IsPeriodic() const
+		 *
+		 * \brief Tells whether the surface has a seam to wrap around.
+		 *
+		 * \return True if the surface is periodic in u or v, and false
+		 * otherwise.
+		 *
+		 */
+		bool IsPeriodic() const
+		{
+			return _surface->IsPeriodicInU() || _surface->IsPeriodicInV();
+		}
+
+
+		/**
+		 * \fn size_t GetNumberOfGhosts() const
+		 *
+		 * \brief Returns the number of ghosts made so far.
+		 *
+		 * \return The number of ghosts made so far.
+		 *
+		 */
+		size_t GetNumberOfGhosts() const
+		{
+			return _originals.size();
+		}
+
+
+		/**
+		 * \fn size_t RemoveDuplicates(size_t& numberOfPoints, std::vector<spPoint>& points, std::vector<size_t>& ends) const
+		 *
+		 * \brief Removes the samples on the upper side of a seam that
+		 * have a sample at the same place on the lower side, such as
+		 * the corners of the domain, which the samplers always keep.
+		 * The order of the other samples is kept.
+		 *
+		 * \param numberOfPoints A reference to the number of samples.
+		 * \param points A reference to an array of samples.
+		 * \param ends A reference to an array with the indices past
+		 * the last sample of ranges of samples, such as the levels of
+		 * a progressive sample, which are moved back past the samples
+		 * removed from each range.
+		 *
+		 * \return The number of samples removed.
+		 *
+		 */
+		size_t
+			RemoveDuplicates(
+				size_t& numberOfPoints,
+				std::vector<spPoint>& points,
+				std::vector<size_t>& ends
+			)
+			const;
+
+
+		/**
+		 * \fn void AddGhosts(size_t first, size_t last, const std::vector<spPoint>& points, std::vector<spPoint>& ghosts)
+		 *
+		 * \brief Makes the ghosts of a range of samples, shifted by the
+		 * period past the far side of each seam.  The ghosts reach
+		 * farther for fewer samples, so the samples given so far, which
+		 * are those up to \c last, should all be sampled with a
+		 * similar spacing.
+		 *
+		 * \param first The index of the first sample of the range.
+		 * \param last The index past the last sample of the range.
+		 * \param points An array of samples.
+		 * \param ghosts A reference to an array to which the ghosts
+		 * are appended.
+		 *
+		 */
+		void
+			AddGhosts(
+				size_t first,
+				size_t last,
+				const std::vector<spPoint>& points,
+				std::vector<spPoint>& ghosts
+			);
+
+
+		/**
+		 * \fn size_t Stitch(size_t& numberOfTriangles, std::vector<size_t>& triangles, size_t& numberOfVertices, std::vector<spPoint>& vertices) const
+		 *
+		 * \brief Keeps the triangles of a CDT of samples and ghosts
+		 * whose centroid lies in the domain, makes them use samples
+		 * instead of ghosts, and removes the ghosts from the vertices.
+		 * Triangles left with a repeated vertex are removed too.
+		 *
+		 * \param numberOfTriangles A reference to the number of
+		 * triangles.
+		 * \param triangles A reference to an array with the vertex
+		 * indices of all triangles.
+		 * \param numberOfVertices A reference to the number of
+		 * vertices.
+		 * \param vertices A reference to an array with all vertices.
+		 *
+		 * \return The number of ghosts removed from the vertices.
+		 *
+		 */
+		size_t
+			Stitch(
+				size_t& numberOfTriangles,
+				std::vector<size_t>& triangles,
+				size_t& numberOfVertices,
+				std::vector<spPoint>& vertices
+			)
+			const;
+	};
+
+}
+
+/** @} */ //end of group class.
@@ -0,0 +1,450 @@
+/**
+ * \file StageTimer.h
+ *
+ * \brief This  file contains the  definition of  a class  that records
+ * the wall time, the CPU time, the peak memory use, and item counts of
+ * each stage of a program run, and reports them as a JSON line.
+ *
+ * \author
+ * Adelino Afonso e Irene Ginani \n
+ * Universidade Federal do Rio Grande do Norte, \n
+ * Instituto Metr&oacute;pole Digital, \n
+ * Adelino Afonso at imd (dot) ufrn (dot) br, \n
+ * Irene Ginani at imd (dot) ufrn (dot) br
+ *
+ * \version 1.0
+ * \date October 2026
+ *
+ * \attention This program is distributed WITHOUT ANY WARRANTY, and it
+ *            may be freely redistributed under the condition that the
+ *            copyright notices  are not removed,  and no compensation
+ *            is received. Private, research, and institutional use is
+ *            free. Distribution of this  code as part of a commercial
+ *            system  is permissible ONLY  BY DIRECT  ARRANGEMENT WITH
+ *            THE AUTHOR.
+ */
+
+#pragma once
+
+#include <chrono>              // std::chrono::steady_clock
+#include <string>              // std::string
+#include <vector>              // std::vector
+#include <utility>             // std::pair
+#include <ostream>             // std::ostream
+#include <cstdio>              // std::snprintf
+#include <cmath>               // std::isfinite
+#include <stdexcept>           // std::runtime_error
+
+#include <sys/resource.h>      // getrusage
+
+
+/**
+ * \defgroup MAT309NameSpace Namespace MAT309.
+ * @{
+ */
+
+/**
+ * \namespace MAT309
+ *
+ * \brief Global namespace for MAT309 software.
+ *
+ */
+
+namespace MAT309
+{
+
+	/**
+	 * \class StageTimer
+	 *
+	 * \brief This class records, for each  stage of a program run, the
+	 * elapsed wall time, the CPU time used by the process (all threads
+	 * included) or by the calling thread only, the peak resident set
+	 * size at the end of the stage, and any number of named item counts.
+	 *
+	 */
+	class StageTimer
+	{
+	public:
+
+		// -----------------------------------------------------------
+		//
+		// Type definitions
+		//
+		// -----------------------------------------------------------
+
+		/**
+		 * \typedef Clock
+		 *
+		 * \brief Alias for the clock used to measure wall time.
+		 *
+		 */
+		typedef std::chrono::steady_clock Clock;
+
+
+		/**
+		 * \struct Stage
+		 *
+		 * \brief This struct stores the measurements of a stage.
+		 *
+		 */
+		struct Stage
+		{
+			std::string _name;                                      ///< Name of the stage.
+			double _wallTime;                                       ///< Elapsed wall time in seconds.
+			double _cpuTime;                                        ///< CPU time in seconds.
+			long _peakRss;                                          ///< Peak resident set size in kilobytes.
+			std::vector< std::pair<std::string, size_t> > _counts;  ///< Named item counts.
+		};
+
+
+	private:
+
+		// -----------------------------------------------------------
+		//
+		// Private data members
+		//
+		// -----------------------------------------------------------
+
+		std::vector<Stage> _stages;   ///< The stages recorded so far.
+		std::vector< std::pair<std::string, std::string> > _labels;   ///< Named labels describing the run, each value written as JSON.
+		Clock::time_point _start;     ///< Wall time at the start of the current stage.
+		double _cpuStart;             ///< CPU time at the start of the current stage.
+		bool _running;                ///< A flag to indicate whether a stage is being timed.
+		bool _perThread;              ///< A flag to indicate whether only the CPU time of the calling thread is measured.
+
+
+	public:
+
+		// -----------------------------------------------------------
+		//
+		// Public methods
+		//
+		// -----------------------------------------------------------
+
+		/**
+		 * \fn StageTimer(bool perThread = false)
+		 *
+		 * \brief Creates an instance of this class.
+		 *
+		 * \param perThread A flag to indicate whether only the CPU time
+		 * of the calling thread is measured,  as when several runs share
+		 * the process.  Each stage must then be started and stopped by
+		 * the same thread.
+		 *
+		 */
+		StageTimer(bool perThread = false) : _cpuStart(0), _running(false), _perThread(perThread)
+		{
+		}
+
+
+		/**
+		 * \fn void Start(const std::string& name)
+		 *
+		 * \brief Starts timing a new stage.  If a stage is being timed,
+		 * it is stopped first.
+		 *
+		 * \param name The name of the stage.
+		 *
+		 */
+		void Start(const std::string& name)
+		{
+			if (_running)
+			{
+				Stop();
+			}
+
+			Stage stage;
+			stage._name = name;
+			stage._wallTime = 0;
+			stage._cpuTime = 0;
+			stage._peakRss = 0;
+
+			_stages.push_back(stage);
+
+			_running = true;
+			_cpuStart = GetCpuTime(_perThread);
+			_start = Clock::now();
+		}
+
+
+		/**
+		 * \fn void Stop()
+		 *
+		 * \brief Stops timing the current stage.
+		 *
+		 */
+		void Stop()
+		{
+			if (!_running)
+			{
+				return;
+			}
+
+			Clock::time_point end = Clock::now();
+
+			Stage& stage = _stages.back();
+			stage._wallTime = std::chrono::duration<double>(end - _start).count();
+			stage._cpuTime = GetCpuTime(_perThread) - _cpuStart;
+			stage._peakRss = GetPeakRss();
+
+			_running = false;
+		}
+
+
+		/**
+		 * \fn void AddCount(const std::string& name, size_t value)
+		 *
+		 * \brief Attaches  a named item  count to the last  stage that
+		 * was started.
+		 *
+		 * \param name The name of the count.
+		 * \param value The count.
+		 *
+		 */
+		void AddCount(const std::string& name, size_t value)
+		{
+			if (_stages.empty())
+			{
+				throw std::runtime_error("Attempt to add a count before any stage was started.");
+			}
+
+			_stages.back()._counts.push_back(std::make_pair(name, value));
+		}
+
+
+		/**
+		 * \fn void AddLabel(const std::string& name, const std::string& value)
+		 *
+		 * \brief Attaches a named  label to the run (e.g., the name of
+		 * the surface), so that reports of different runs can be told
+		 * apart.
+		 *
+		 * \param name The name of the label.
+		 * \param value The value of the label.
+		 *
+		 */
+		void AddLabel(const std::string& name, const std::string& value)
+		{
+			_labels.push_back(std::make_pair(name, Quote(value)));
+		}
+
+
+		/**
+		 * \fn void AddLabel(const std::string& name, double value)
+		 *
+		 * \brief Attaches a named numeric label to the run (e.g., the
+		 * radius of the samples), which is written as a JSON number.
+		 *
+		 * \param name The name of the label.
+		 * \param value The value of the label.
+		 *
+		 */
+		void AddLabel(const std::string& name, double value)
+		{
+			// JSON has no infinities nor NaNs.
+			if (!std::isfinite(value))
+			{
+				_labels.push_back(std::make_pair(name, std::string("null")));
+				return;
+			}
+
+			char number[32];
+			std::snprintf(number, sizeof(number), "%.17g", value);
+
+			_labels.push_back(std::make_pair(name, std::string(number)));
+		}
+
+
+		/**
+		 * \fn void Append(const StageTimer& timer)
+		 *
+		 * \brief Appends the stages recorded by another timer (e.g., by
+		 * another thread) to the stages of this timer.
+		 *
+		 * \param timer Another timer.
+		 *
+		 */
+		void Append(const StageTimer& timer)
+		{
+			_stages.insert(_stages.end(), timer._stages.begin(), timer._stages.end());
+		}
+
+
+		/**
+		 * \fn const std::vector<Stage>& GetStages() const
+		 *
+		 * \brief Returns the stages recorded so far.
+		 *
+		 * \return The stages recorded so far.
+		 *
+		 */
+		const std::vector<Stage>& GetStages() const
+		{
+			return _stages;
+		}
+
+
+		/**
+		 * \fn void WriteJson(std::ostream& os) const
+		 *
+		 * \brief Writes all labels and stages as a single JSON line.
+		 * Names and string labels are escaped as JSON strings.
+		 *
+		 * \param os An output stream.
+		 *
+		 */
+		void WriteJson(std::ostream& os) const
+		{
+			double wallTime = 0;
+			double cpuTime = 0;
+
+			os << "{";
+
+			for (size_t i = 0; i < _labels.size(); i++)
+			{
+				os << Quote(_labels[i].first) << ":" << _labels[i].second << ",";
+			}
+
+			os << "\"stages\":[";
+
+			for (size_t i = 0; i < _stages.size(); i++)
+			{
+				const Stage& stage = _stages[i];
+
+				char times[160];
+				std::snprintf(
+					times,
+					sizeof(times),
+					"\"wall_s\":%.6f,\"cpu_s\":%.6f,\"peak_rss_kb\":%ld",
+					stage._wallTime,
+					stage._cpuTime,
+					stage._peakRss
+				);
+
+				os << ((i == 0) ? "" : ",")
+				   << "{\"name\":" << Quote(stage._name) << ","
+				   << times;
+
+				for (size_t j = 0; j < stage._counts.size(); j++)
+				{
+					os << "," << Quote(stage._counts[j].first) << ":" << stage._counts[j].second;
+				}
+
+				os << "}";
+
+				wallTime += stage._wallTime;
+				cpuTime += stage._cpuTime;
+			}
+
+			char totals[160];
+			std::snprintf(
+				totals,
+				sizeof(totals),
+				"\"wall_s\":%.6f,\"cpu_s\":%.6f,\"peak_rss_kb\":%ld",
+				wallTime,
+				cpuTime,
+				GetPeakRss()
+			);
+
+			os << "]," << totals << "}" << std::endl;
+		}
+
+
+	private:
+
+		// -----------------------------------------------------------
+		//
+		// Private methods
+		//
+		// -----------------------------------------------------------
+
+		/**
+		 * \fn static double GetCpuTime(bool perThread)
+		 *
+		 * \brief Returns the user plus system CPU time used so far by
+		 * all threads of this process, or by the calling thread.
+		 *
+		 * \param perThread A flag to indicate whether only the CPU time
+		 * of the calling thread is returned.
+		 *
+		 * \return The CPU time in seconds.
+		 *
+		 */
+		static double GetCpuTime(bool perThread)
+		{
+			struct rusage usage;
+
+#ifdef RUSAGE_THREAD
+			getrusage(perThread ? RUSAGE_THREAD : RUSAGE_SELF, &usage);
+#else
+			(void) perThread;
+			getrusage(RUSAGE_SELF, &usage);
+#endif
+
+			return
+				double(usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) +
+				1e-6 * double(usage.ru_utime.tv_usec + usage.ru_stime.tv_usec);
+		}
+
+
+		/**
+		 * \fn static std::string Quote(const std::string& text)
+		 *
+		 * \brief Writes a text as a JSON string, between quotes, with
+		 * quotes, backslashes, and control characters escaped.
+		 *
+		 * \param text A text.
+		 *
+		 * \return The JSON string.
+		 *
+		 */
+		static std::string Quote(const std::string& text)
+		{
+			std::string quoted("\"");
+
+			for (char c : text)
+			{
+				if ((c == '"') || (c == '\\'))
+				{
+					quoted += '\\';
+					quoted += c;
+				}
+				else if (static_cast<unsigned char>(c) < 0x20)
+				{
+					char escape[8];
+					std::snprintf(escape, sizeof(escape), "\\u%04x", unsigned(c));
+					quoted += escape;
+				}
+				else
+				{
+					quoted += c;
+				}
+			}
+
+			quoted += '"';
+
+			return quoted;
+		}
+
+
+		/**
+		 * \fn static long GetPeakRss()
+		 *
+		 * \brief Returns the peak resident set size of this process so
+		 * far.
+		 *
+		 * \return The peak resident set size in kilobytes.
+		 *
+		 */
+		static long GetPeakRss()
+		{
+			struct rusage usage;
+			getrusage(RUSAGE_SELF, &usage);
+
+			return usage.ru_maxrss;
+		}
+	};
+
+}
+
+/** @} */ //end of group class.
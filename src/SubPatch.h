@@ -0,0 +1,326 @@
+/**
+ * \file SubPatch.h
+ *
+ * \brief This file contains the definition of  a class to represent the
+ * restriction of a parametric surface to a rectangle of its domain.
+ *
+ * \author
+ * Adelino Afonso e Irene Ginani \n
+ * Universidade Federal do Rio Grande do Norte, \n
+ * Instituto Metr&oacute;pole Digital, \n
+ * Adelino Afonso at imd (dot) ufrn (dot) br, \n
+ * Irene Ginani at imd (dot) ufrn (dot) br
+ *
+ * \version 1.0
+ * \date October 2026
+ *
+ * \attention This program is distributed WITHOUT ANY WARRANTY, and it
+ *            may be freely redistributed under the condition that the
+ *            copyright notices  are not removed,  and no compensation
+ *            is received. Private, research, and institutional use is
+ *            free. Distribution of this  code as part of a commercial
+ *            system  is permissible ONLY  BY DIRECT  ARRANGEMENT WITH
+ *            THE AUTHOR.
+ */
+
+#pragma once
+
+#include "Surface.h"       // Surface
+
+#include <memory>          // std::shared_ptr
+#include <stdexcept>       // std::runtime_error
+
+
+/**
+ * \defgroup MAT309NameSpace Namespace MAT309.
+ * @{
+ */
+
+/**
+ * \namespace MAT309
+ *
+ * \brief Global namespace for MAT309 software.
+ *
+ */
+
+namespace MAT309
+{
+
+	/**
+	 * \class SubPatch
+	 *
+	 * \brief This class represents the restriction of a surface to the
+	 * rectangle [umin,umax] x [vmin,vmax] of its domain.  Points and
+	 * derivatives are those of the original surface, so a patch can be
+	 * split into tiles that are sampled independently.
+	 *
+	 */
+	class SubPatch : public Surface
+	{
+	public:
+
+		// -----------------------------------------------------------
+		//
+		// Type definitions
+		//
+		// -----------------------------------------------------------
+
+		/**
+		 * \typedef spSurface
+		 *
+		 * \brief Alias for a shared pointer to Surface objects.
+		 *
+		 */
+		typedef std::shared_ptr<Surface> spSurface;
+
+
+	private:
+
+		// -----------------------------------------------------------
+		//
+		// Private data members
+		//
+		// -----------------------------------------------------------
+
+		spSurface _surface;   ///< The original surface.
+		double _umin;         ///< Lower bound for the first coordinate of a domain point.
+		double _umax;         ///< Upper bound for the first coordinate of a domain point.
+		double _vmin;         ///< Lower bound for the second coordinate of a domain point.
+		double _vmax;         ///< Upper bound for the second coordinate of a domain point.
+
+
+	public:
+
+		// -----------------------------------------------------------
+		//
+		// Public methods
+		//
+		// -----------------------------------------------------------
+
+		/**
+		 * \fn SubPatch(const spSurface& surface, double umin, double umax, double vmin, double vmax)
+		 *
+		 * \brief Creates an instance of this class.
+		 *
+		 * \param surface A pointer to the original surface.
+		 * \param umin Lower bound for the first coordinate.
+		 * \param umax Upper bound for the first coordinate.
+		 * \param vmin Lower bound for the second coordinate.
+		 * \param vmax Upper bound for the second coordinate.
+		 *
+		 */
+		SubPatch(
+			const spSurface& surface,
+			double umin,
+			double umax,
+			double vmin,
+			double vmax
+		)
+			:
+			_surface(surface),
+			_umin(umin),
+			_umax(umax),
+			_vmin(vmin),
+			_vmax(vmax)
+		{
+			if (
+				(umin < surface->GetUMin()) || (umax > surface->GetUMax()) || (umin >= umax) ||
+				(vmin < surface->GetVMin()) || (vmax > surface->GetVMax()) || (vmin >= vmax)
+			   )
+			{
+				throw std::runtime_error("The sub-patch domain is not a rectangle of the surface domain.");
+			}
+		}
+
+
+		/**
+		 * \fn double GetUMin() const
+		 *
+		 * \brief Returns the lower bound  for the first coordinate of
+		 * a domain point.
+		 *
+		 * \return  The lower  bound  for the  first  coordinate of  a
+		 * domain point.
+		 *
+		 */
+		double GetUMin() const
+		{
+			return _umin;
+		}
+
+
+		/**
+		 * \fn double GetUMax() const
+		 *
+		 * \brief Returns the upper bound  for the first coordinate of
+		 * a domain point.
+		 *
+		 * \return  The upper  bound  for the  first  coordinate of  a
+		 * domain point.
+		 *
+		 */
+		double GetUMax() const
+		{
+			return _umax;
+		}
+
+
+		/**
+		 * \fn double GetVMin() const
+		 *
+		 * \brief Returns the lower bound for the second coordinate of
+		 * a domain point.
+		 *
+		 * \return  The lower  bound for  the second  coordinate of  a
+		 * domain point.
+		 *
+		 */
+		double GetVMin() const
+		{
+			return _vmin;
+		}
+
+
+		/**
+		 * \fn double GetVMax() const
+		 *
+		 * \brief Returns the upper bound for the second coordinate of
+		 * a domain point.
+		 *
+		 * \return  The upper  bound for  the second  coordinate of  a
+		 * domain point.
+		 *
+		 */
+		double GetVMax() const
+		{
+			return _vmax;
+		}
+
+
+		/**
+		 * \fn void GetPoint(double u, double v, double& x, double& y, double& z) const
+		 *
+		 * \brief Computes a point on the surface at a given parameter
+		 * point.
+		 *
+		 * \param u First coordinate of a parameter point.
+		 * \param v Second coordinate of a parameter point.
+		 * \param x A  reference to the first coordinate  of the point
+		 * on the surface.
+		 * \param y A reference to  the second coordinate of the point
+		 * on the surface.
+		 * \param z A  reference to the third coordinate  of the point
+		 * on the surface.
+		 *
+		 */
+		void
+		    GetPoint(
+				double u,
+				double v,
+				double& x,
+				double& y,
+				double& z
+			)
+		    const
+		{
+			_surface->GetPoint(u, v, x, y, z);
+		}
+
+
+		/**
+		 * \fn void GetDu(double u, double v, double& x, double& y, double& z) const
+		 *
+		 * \brief  Computes the  first  derivative vector  at a  given
+		 * parameter point in direction u.
+		 *
+		 * \param u First coordinate of a parameter point.
+		 * \param v Second coordinate of a parameter point.
+		 * \param x A  reference to the first coordinate  of the first
+		 * derivative vector in direction \c u.
+		 * \param y A reference to  the second coordinate of the first
+		 * derivative vector in direction \c u.
+		 * \param z A  reference to the third coordinate  of the first
+		 * derivative vector in direction \c u.
+		 *
+		 */
+		void
+		    GetDu(
+				double u,
+				double v,
+				double& x,
+				double& y,
+				double& z
+			)
+		    const
+		{
+			_surface->GetDu(u, v, x, y, z);
+		}
+
+
+		/**
+		 * \fn void GetDv(double u, double v, double& x, double& y, double& z) const
+		 *
+		 * \brief  Computes the  first  derivative vector  at a  given
+		 * parameter point in direction v.
+		 *
+		 * \param u First coordinate of a parameter point.
+		 * \param v Second coordinate of a parameter point.
+		 * \param x A  reference to the first coordinate  of the first
+		 * derivative vector in direction \c v.
+		 * \param y A reference to  the second coordinate of the first
+		 * derivative vector in direction \c v.
+		 * \param z A  reference to the third coordinate  of the first
+		 * derivative vector in direction \c v.
+		 *
+		 */
+		void
+		    GetDv(
+				double u,
+				double v,
+				double& x,
+				double& y,
+				double& z
+			)
+		    const
+		{
+			_surface->GetDv(u, v, x, y, z);
+		}
+
+
+		/**
+		 * \fn void GetRow(double v, size_t count, const double* u, double* points, double* du, double* dv) const
+		 *
+		 * \brief Computes the points and the first derivative vectors
+		 * at a row of parameter points sharing their second coordinate,
+		 * as the original surface does.
+		 *
+		 * \param v Second coordinate of the parameter points.
+		 * \param count Number of parameter points.
+		 * \param u An array with the first coordinate of each
+		 * parameter point.
+		 * \param points An array receiving the three coordinates of
+		 * each point on the surface (may be null).
+		 * \param du An array receiving the three coordinates of each
+		 * first derivative vector in direction \c u (may be null).
+		 * \param dv An array receiving the three coordinates of each
+		 * first derivative vector in direction \c v (may be null).
+		 *
+		 */
+		void
+		    GetRow(
+				double v,
+				size_t count,
+				const double* u,
+				double* points,
+				double* du,
+				double* dv
+			)
+		    const
+		{
+			_surface->GetRow(v, count, u, points, du, dv);
+		}
+	};
+
+}
+
+/** @} */ //end of group class.
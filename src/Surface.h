@@ -25,6 +25,10 @@
 
 #pragma once
 
+#include <algorithm>   // std::min, std::max
+#include <cmath>       // sqrt
+#include <cstddef>     // size_t
+
 
 /**
  * \defgroup MAT309NameSpace Namespace MAT309.
@@ -133,6 +137,44 @@ namespace MAT309
 		virtual double GetVMax() const = 0;
 
 
+		/**
+		 * \fn virtual bool IsPeriodicInU() const
+		 *
+		 * \brief Tells whether the surface  closes up along the first
+		 * coordinate, that is, whether the sides u = GetUMin() and u =
+		 * GetUMax() of the domain are the same curve on the surface.  A
+		 * periodic surface can be evaluated at any value of u, with the
+		 * period GetUMax() - GetUMin().  By default, it is not.
+		 *
+		 * \return True if the surface is periodic in u, and false
+		 * otherwise.
+		 *
+		 */
+		virtual bool IsPeriodicInU() const
+		{
+			return false;
+		}
+
+
+		/**
+		 * \fn virtual bool IsPeriodicInV() const
+		 *
+		 * \brief Tells whether the surface closes up along the second
+		 * coordinate, that is, whether the sides v = GetVMin() and v =
+		 * GetVMax() of the domain are the same curve on the surface.  A
+		 * periodic surface can be evaluated at any value of v, with the
+		 * period GetVMax() - GetVMin().  By default, it is not.
+		 *
+		 * \return True if the surface is periodic in v, and false
+		 * otherwise.
+		 *
+		 */
+		virtual bool IsPeriodicInV() const
+		{
+			return false;
+		}
+
+
 		/**
 		 * \fn virtual void GetPoint(double u, double v, double& x, double& y, double& z) const = 0
 		 *
@@ -214,6 +256,233 @@ namespace MAT309
 			)
 		    const = 0 ;
 
+
+		/**
+		 * \fn virtual void GetRow(double v, size_t count, const double* u, double* points, double* du, double* dv) const
+		 *
+		 * \brief Computes the points and the first derivative vectors
+		 * at a row of parameter points sharing their second coordinate,
+		 * as in a grid of the domain.  By default, each parameter point
+		 * is evaluated on its own.  Surfaces that can share work along
+		 * a row may override this method.
+		 *
+		 * \param v Second coordinate of the parameter points.
+		 * \param count Number of parameter points.
+		 * \param u An array with the first coordinate of each
+		 * parameter point.
+		 * \param points An array receiving the three coordinates of
+		 * each point on the surface (may be null).
+		 * \param du An array receiving the three coordinates of each
+		 * first derivative vector in direction \c u (may be null).
+		 * \param dv An array receiving the three coordinates of each
+		 * first derivative vector in direction \c v (may be null).
+		 *
+		 */
+		virtual void
+		    GetRow(
+				double v,
+				size_t count,
+				const double* u,
+				double* points,
+				double* du,
+				double* dv
+			)
+		    const
+		{
+			for (size_t i = 0; i < count; i++)
+			{
+				if (points != nullptr)
+				{
+					GetPoint(u[i], v, points[3 * i], points[3 * i + 1], points[3 * i + 2]);
+				}
+
+				if (du != nullptr)
+				{
+					GetDu(u[i], v, du[3 * i], du[3 * i + 1], du[3 * i + 2]);
+				}
+
+				if (dv != nullptr)
+				{
+					GetDv(u[i], v, dv[3 * i], dv[3 * i + 1], dv[3 * i + 2]);
+				}
+			}
+		}
+
+
+		/**
+		 * \fn virtual void GetFirstFundamentalForm(double u, double v, double& e, double& f, double& g) const
+		 *
+		 * \brief Computes the coefficients  of the first fundamental
+		 * form  at  a given  parameter  point,  that is,  the  metric
+		 * tensor [e f; f g] measuring lengths on the surface in terms
+		 * of parameter displacements.   By default,  they are the dot
+		 * products of the first derivative vectors.
+		 *
+		 * \param u First coordinate of a parameter point.
+		 * \param v Second coordinate of a parameter point.
+		 * \param e A reference to the dot product of the derivative in
+		 * direction \c u with itself.
+		 * \param f A reference to the dot product of the derivatives in
+		 * directions \c u and \c v.
+		 * \param g A reference to the dot product of the derivative in
+		 * direction \c v with itself.
+		 *
+		 */
+		virtual void
+		    GetFirstFundamentalForm(
+				double u,
+				double v,
+				double& e,
+				double& f,
+				double& g
+			)
+		    const
+		{
+			double xu, yu, zu;
+			double xv, yv, zv;
+
+			GetDu(u, v, xu, yu, zu);
+			GetDv(u, v, xv, yv, zv);
+
+			e = xu * xu + yu * yu + zu * zu;
+			f = xu * xv + yu * yv + zu * zv;
+			g = xv * xv + yv * yv + zv * zv;
+		}
+
+
+		/**
+		 * \fn virtual void GetSecondFundamentalForm(double u, double v, double& l, double& m, double& n) const
+		 *
+		 * \brief Computes the coefficients of the second fundamental
+		 * form at a given parameter point,  that is, the components of
+		 * the second derivatives along the unit normal (Du x Dv) / |Du
+		 * x Dv|.  By default, the second derivatives are estimated by
+		 * central differences of the first derivatives (one-sided at
+		 * the border of the domain).  Surfaces with closed-form second
+		 * derivatives may override this method.
+		 *
+		 * \param u First coordinate of a parameter point.
+		 * \param v Second coordinate of a parameter point.
+		 * \param l A reference to the normal component of the second
+		 * derivative in direction \c u.
+		 * \param m A reference to the normal component of the mixed
+		 * second derivative.
+		 * \param n A reference to the normal component of the second
+		 * derivative in direction \c v.
+		 *
+		 */
+		virtual void
+		    GetSecondFundamentalForm(
+				double u,
+				double v,
+				double& l,
+				double& m,
+				double& n
+			)
+		    const
+		{
+			double xu, yu, zu;
+			double xv, yv, zv;
+
+			GetDu(u, v, xu, yu, zu);
+			GetDv(u, v, xv, yv, zv);
+
+			double nx = yu * zv - zu * yv;
+			double ny = zu * xv - xu * zv;
+			double nz = xu * yv - yu * xv;
+
+			double length = sqrt(nx * nx + ny * ny + nz * nz);
+
+			if (length == 0)
+			{
+				l = m = n = 0;
+				return;
+			}
+
+			nx /= length;
+			ny /= length;
+			nz /= length;
+
+			// Step a small fraction of the domain,  staying inside it.
+			double hu = 1e-5 * (GetUMax() - GetUMin());
+			double hv = 1e-5 * (GetVMax() - GetVMin());
+
+			double u0 = std::max(GetUMin(), u - hu);
+			double u1 = std::min(GetUMax(), u + hu);
+			double v0 = std::max(GetVMin(), v - hv);
+			double v1 = std::min(GetVMax(), v + hv);
+
+			double ax, ay, az;
+			double bx, by, bz;
+
+			// Duu and Duv from the change of Du along u and v.
+			GetDu(u1, v, ax, ay, az);
+			GetDu(u0, v, bx, by, bz);
+
+			l = ((ax - bx) * nx + (ay - by) * ny + (az - bz) * nz) / (u1 - u0);
+
+			GetDu(u, v1, ax, ay, az);
+			GetDu(u, v0, bx, by, bz);
+
+			m = ((ax - bx) * nx + (ay - by) * ny + (az - bz) * nz) / (v1 - v0);
+
+			// Dvv from the change of Dv along v.
+			GetDv(u, v1, ax, ay, az);
+			GetDv(u, v0, bx, by, bz);
+
+			n = ((ax - bx) * nx + (ay - by) * ny + (az - bz) * nz) / (v1 - v0);
+		}
+
+
+		/**
+		 * \fn void GetPrincipalCurvatures(double u, double v, double& k1, double& k2) const
+		 *
+		 * \brief Computes the principal curvatures at a given
+		 * parameter point from the first and second fundamental forms.
+		 * At a singular point of the parametrization (where Du and Dv
+		 * are parallel), both curvatures are reported as zero.
+		 *
+		 * \param u First coordinate of a parameter point.
+		 * \param v Second coordinate of a parameter point.
+		 * \param k1 A reference to the principal curvature of largest
+		 * absolute value.
+		 * \param k2 A reference to the other principal curvature.
+		 *
+		 */
+		void
+		    GetPrincipalCurvatures(
+				double u,
+				double v,
+				double& k1,
+				double& k2
+			)
+		    const
+		{
+			double e, f, g;
+			double l, m, n;
+
+			GetFirstFundamentalForm(u, v, e, f, g);
+			GetSecondFundamentalForm(u, v, l, m, n);
+
+			double det = e * g - f * f;
+
+			if (det <= 0)
+			{
+				k1 = k2 = 0;
+				return;
+			}
+
+			// The principal curvatures are the roots of k^2 - 2 H k + K,
+			// H and K being the mean and Gaussian curvatures.
+			double h = (e * n - 2 * f * m + g * l) / (2 * det);
+			double k = (l * n - m * m) / det;
+
+			double root = sqrt(std::max(0.0, h * h - k));
+
+			k1 = (h >= 0) ? h + root : h - root;
+			k2 = (h >= 0) ? h - root : h + root;
+		}
+
 	};
 
 }
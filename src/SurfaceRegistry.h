@@ -0,0 +1,246 @@
+/**
+ * \file SurfaceRegistry.h
+ *
+ * \brief This  file contains the definition of  a class that maps the
+ * names of surfaces to functions creating them, so that the surface to
+ * be sampled can be chosen at run time.
+ *
+ * \author
+ * Adelino Afonso e Irene Ginani \n
+ * Universidade Federal do Rio Grande do Norte, \n
+ * Instituto Metr&oacute;pole Digital, \n
+ * Adelino Afonso at imd (dot) ufrn (dot) br, \n
+ * Irene Ginani at imd (dot) ufrn (dot) br
+ *
+ * \version 1.0
+ * \date October 2026
+ *
+ * \attention This program is distributed WITHOUT ANY WARRANTY, and it
+ *            may be freely redistributed under the condition that the
+ *            copyright notices  are not removed,  and no compensation
+ *            is received. Private, research, and institutional use is
+ *            free. Distribution of this  code as part of a commercial
+ *            system  is permissible ONLY  BY DIRECT  ARRANGEMENT WITH
+ *            THE AUTHOR.
+ */
+
+#pragma once
+
+#include "Surface.h"           // Surface
+#include "MyCylinder.h"        // MyCylinder
+#include "Esfera.h"            // Esfera
+#include "Cone.h"              // Cone
+#include "NurbsSurface.h"      // NurbsSurface
+#include "HeightfieldSurface.h" // HeightfieldSurface
+
+#include <map>                 // std::map
+#include <memory>              // std::shared_ptr
+#include <string>              // std::string
+#include <vector>              // std::vector
+#include <functional>          // std::function
+#include <stdexcept>           // std::runtime_error
+
+
+/**
+ * \defgroup MAT309NameSpace Namespace MAT309.
+ * @{
+ */
+
+/**
+ * \namespace MAT309
+ *
+ * \brief Global namespace for MAT309 software.
+ *
+ */
+
+namespace MAT309
+{
+
+	/**
+	 * \class SurfaceRegistry
+	 *
+	 * \brief This class maps surface names to factory functions.  The
+	 * surfaces of this project  are registered when the registry is
+	 * created.  To make a new surface  available to the driver, include
+	 * its header below and register it in the constructor.
+	 *
+	 * Surfaces read from a file, such as NURBS patches and terrains,
+	 * are registered with a loader, and named by the name of the
+	 * loader, a colon, and the name of the file, as in
+	 * "nurbs:patch.txt".
+	 *
+	 */
+	class SurfaceRegistry
+	{
+	public:
+
+		// -----------------------------------------------------------
+		//
+		// Type definitions
+		//
+		// -----------------------------------------------------------
+
+		/**
+		 * \typedef spSurface
+		 *
+		 * \brief Alias for a shared pointer to Surface objects.
+		 *
+		 */
+		typedef std::shared_ptr<Surface> spSurface;
+
+
+		/**
+		 * \typedef Factory
+		 *
+		 * \brief Alias for a function creating a surface.
+		 *
+		 */
+		typedef std::function<spSurface ()> Factory;
+
+
+		/**
+		 * \typedef Loader
+		 *
+		 * \brief Alias for a function reading a surface from a file.
+		 *
+		 */
+		typedef std::function<spSurface (const std::string& filename)> Loader;
+
+
+	private:
+
+		// -----------------------------------------------------------
+		//
+		// Private data members
+		//
+		// -----------------------------------------------------------
+
+		std::map<std::string, Factory> _factories;   ///< The factory of each surface, by name.
+		std::map<std::string, Loader> _loaders;      ///< The loader of each kind of surface read from a file, by name.
+
+
+	public:
+
+		// -----------------------------------------------------------
+		//
+		// Public methods
+		//
+		// -----------------------------------------------------------
+
+		/**
+		 * \fn SurfaceRegistry()
+		 *
+		 * \brief  Creates an  instance  of this  class  and registers
+		 * the surfaces of this project.
+		 *
+		 */
+		SurfaceRegistry()
+		{
+			Register("cylinder", [] { return std::make_shared<MyCylinder>(); });
+			Register("esfera", [] { return std::make_shared<Esfera>(); });
+			Register("cone", [] { return std::make_shared<Cone>(); });
+			Register("toro", [] { return NurbsSurface::MakeTorus(5, 2); });
+			RegisterLoader("nurbs", [](const std::string& filename) { return NurbsSurface::Load(filename); });
+			RegisterLoader("heightfield", [](const std::string& filename) { return HeightfieldSurface::Load(filename); });
+		}
+
+
+		/**
+		 * \fn void Register(const std::string& name, Factory factory)
+		 *
+		 * \brief Registers a surface under  a given name.  A surface
+		 * registered earlier under the same name is replaced.
+		 *
+		 * \param name The name of the surface.
+		 * \param factory A function creating the surface.
+		 *
+		 */
+		void Register(const std::string& name, Factory factory)
+		{
+			_factories[name] = factory;
+		}
+
+
+		/**
+		 * \fn void RegisterLoader(const std::string& name, Loader loader)
+		 *
+		 * \brief Registers a kind of surface read from a file under a
+		 * given name.  A loader registered earlier under the same name
+		 * is replaced.
+		 *
+		 * \param name The name of the kind of surface.
+		 * \param loader A function reading the surface from a file.
+		 *
+		 */
+		void RegisterLoader(const std::string& name, Loader loader)
+		{
+			_loaders[name] = loader;
+		}
+
+
+		/**
+		 * \fn spSurface Create(const std::string& name) const
+		 *
+		 * \brief Creates the surface registered under a given name, or
+		 * reads it from a file if the name is the name of a loader, a
+		 * colon, and the name of the file.
+		 *
+		 * \param name The name of the surface.
+		 *
+		 * \return A pointer to a new instance of the surface.
+		 *
+		 */
+		spSurface Create(const std::string& name) const
+		{
+			std::map<std::string, Factory>::const_iterator it = _factories.find(name);
+
+			if (it != _factories.end())
+			{
+				return it->second();
+			}
+
+			std::string::size_type colon = name.find(':');
+
+			if (colon != std::string::npos)
+			{
+				std::map<std::string, Loader>::const_iterator loader = _loaders.find(name.substr(0, colon));
+
+				if (loader != _loaders.end())
+				{
+					return loader->second(name.substr(colon + 1));
+				}
+			}
+
+			throw std::runtime_error("Unknown surface \"" + name + "\" (available: " + GetNames() + ").");
+		}
+
+
+		/**
+		 * \fn std::string GetNames() const
+		 *
+		 * \brief Returns the names of all registered surfaces.
+		 *
+		 * \return A comma-separated list of surface names.
+		 *
+		 */
+		std::string GetNames() const
+		{
+			std::string names;
+
+			for (std::map<std::string, Factory>::const_iterator it = _factories.begin(); it != _factories.end(); ++it)
+			{
+				names += (names.empty() ? "" : ", ") + it->first;
+			}
+
+			for (std::map<std::string, Loader>::const_iterator it = _loaders.begin(); it != _loaders.end(); ++it)
+			{
+				names += (names.empty() ? "" : ", ") + it->first + ":file";
+			}
+
+			return names;
+		}
+	};
+
+}
+
+/** @} */ //end of group class.
@@ -0,0 +1,314 @@
+/**
+ * \file TileSampler.cpp
+ *
+ * \brief Implementation of the class TileSampler, which samples a
+ * surface by laying copies of a periodic Poisson disk tile over its
+ * parameter domain.
+ *
+ * \author
+ * Adelino Afonso e Irene Ginani \n
+ * Universidade Federal do Rio Grande do Norte, \n
+ * Instituto Metr&oacute;pole Digital, \n
+ * Adelino Afonso at imd (dot) ufrn (dot) br, \n
+ * Irene Ginani at imd (dot) ufrn (dot) br
+ *
+ * \version 1.0
+ * \date October 2026
+ *
+ * \attention This program is distributed WITHOUT ANY WARRANTY, and it
+ *            may be freely redistributed under the condition that the
+ *            copyright notices  are not removed,  and no compensation
+ *            is received. Private, research, and institutional use is
+ *            free. Distribution of this  code as part of a commercial
+ *            system  is permissible ONLY  BY DIRECT  ARRANGEMENT WITH
+ *            THE AUTHOR.
+ */
+
+#include "TileSampler.h"         // TileSampler
+#include "SamplePoint.h"         // SamplePoint
+#include "KdTree.h"              // KdTree
+
+#include <algorithm>             // std::min, std::max, std::upper_bound
+#include <cmath>                 // sqrt, ceil, floor
+#include <stdexcept>             // std::runtime_error
+
+
+/**
+ * \defgroup MAT309NameSpace Namespace MAT309.
+ * @{
+ */
+
+/**
+ * \namespace MAT309
+ *
+ * \brief Global namespace for MAT309 software.
+ */
+
+namespace MAT309
+{
+
+	/**
+	 * \fn size_t TileSampler::Sample(const spSurface& surface, size_t& numberOfPoints, std::vector<spPoint>& points) const
+	 *
+	 * \brief Samples a surface.
+	 *
+	 * \param surface A pointer to the surface to be sampled.
+	 * \param numberOfPoints A reference to the number of sample points.
+	 * \param points A reference to an array of sample points.
+	 *
+	 * \return The number of tile points that were checked against the
+	 * other samples.
+	 *
+	 */
+	size_t
+		TileSampler::Sample(
+			const spSurface& surface,
+			size_t& numberOfPoints,
+			std::vector<spPoint>& points
+		)
+		const
+	{
+		if (_tile.GetSize() == 0)
+		{
+			throw std::runtime_error("The Poisson tile is empty.");
+		}
+
+		const double umin = surface->GetUMin();
+		const double umax = surface->GetUMax();
+		const double vmin = surface->GetVMin();
+		const double vmax = surface->GetVMax();
+
+		// Survey the first fundamental form on a grid of the domain.
+		const size_t n = 64;
+
+		const double du = (umax - umin) / n;
+		const double dv = (vmax - vmin) / n;
+
+		std::vector<double> e((n + 1) * (n + 1));
+		std::vector<double> f((n + 1) * (n + 1));
+		std::vector<double> g((n + 1) * (n + 1));
+
+		std::vector<double> mu(n + 1, 0);
+		std::vector<double> mv(n + 1, 0);
+
+		// The grid is evaluated a row of constant v at a time, which
+		// surfaces such as NURBS patches evaluate faster than point by
+		// point.
+		std::vector<double> us(n + 1);
+		std::vector<double> xu(3 * (n + 1));
+		std::vector<double> xv(3 * (n + 1));
+
+		for (size_t i = 0; i <= n; i++)
+		{
+			us[i] = umin + i * du;
+		}
+
+		for (size_t j = 0; j <= n; j++)
+		{
+			surface->GetRow(vmin + j * dv, n + 1, &us[0], nullptr, &xu[0], &xv[0]);
+
+			for (size_t i = 0; i <= n; i++)
+			{
+				size_t k = i * (n + 1) + j;
+
+				const double* a = &xu[3 * i];
+				const double* b = &xv[3 * i];
+
+				e[k] = a[0] * a[0] + a[1] * a[1] + a[2] * a[2];
+				f[k] = a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+				g[k] = b[0] * b[0] + b[1] * b[1] + b[2] * b[2];
+
+				mu[i] = std::max(mu[i], sqrt(std::max(0.0, e[k])));
+				mv[j] = std::max(mv[j], sqrt(std::max(0.0, g[k])));
+			}
+		}
+
+		// Lengths along each parameter, up to each grid line.
+		std::vector<double> lu(n + 1, 0);
+		std::vector<double> lv(n + 1, 0);
+
+		for (size_t i = 0; i < n; i++)
+		{
+			lu[i + 1] = lu[i] + (mu[i] + mu[i + 1]) / 2 * du;
+			lv[i + 1] = lv[i] + (mv[i] + mv[i + 1]) / 2 * dv;
+		}
+
+		if ((lu[n] <= 0) || (lv[n] <= 0))
+		{
+			throw std::runtime_error("The surface has no area to sample.");
+		}
+
+		// Find the cells where the map from the tile to the surface
+		// shrinks some direction: there, with the lengths growing
+		// linearly along each cell, a unit step of the tile covers
+		// sqrt(lambda) on the surface, lambda being the smallest
+		// eigenvalue of the first fundamental form scaled by the
+		// derivatives of the parameters with respect to the lengths.
+		std::vector<bool> shrinks(n * n, false);
+
+		for (size_t i = 0; i < n; i++)
+		{
+			double a = du / std::max(lu[i + 1] - lu[i], 1e-300);
+
+			for (size_t j = 0; j < n; j++)
+			{
+				double b = dv / std::max(lv[j + 1] - lv[j], 1e-300);
+
+				for (size_t c = 0; (c < 4) && !shrinks[i * n + j]; c++)
+				{
+					size_t k = (i + c / 2) * (n + 1) + (j + c % 2);
+
+					double ee = e[k] * a * a;
+					double ff = f[k] * a * b;
+					double gg = g[k] * b * b;
+
+					double mean = (ee + gg) / 2;
+					double diff = (ee - gg) / 2;
+
+					shrinks[i * n + j] = (mean - sqrt(diff * diff + ff * ff)) < 1 - 1e-9;
+				}
+			}
+		}
+
+		// The parameter at a given length, inverting the lengths up to
+		// the grid lines linearly.
+		auto Parameter = [](const std::vector<double>& lengths, double start, double step, double length)
+		{
+			size_t i = size_t(std::upper_bound(lengths.begin(), lengths.end(), length) - lengths.begin());
+
+			i = std::min(std::max(i, size_t(1)), lengths.size() - 1) - 1;
+
+			double w = (lengths[i + 1] > lengths[i]) ? (length - lengths[i]) / (lengths[i + 1] - lengths[i]) : 0;
+
+			return start + (i + std::min(std::max(w, 0.0), 1.0)) * step;
+		};
+
+		points.clear();
+
+		KdTree<3> tree;
+
+		const double spacing = 2 * _alpha;
+		const double spacing2 = spacing * spacing;
+
+		auto accept = [&](double u, double v, const SamplePoint::Point& pos)
+		{
+			double x[3] = { pos._x, pos._y, pos._z };
+
+			tree.Insert(x);
+
+			points.push_back(std::make_shared<SamplePoint>(SamplePoint(u, v, pos)));
+		};
+
+		// The corners of the domain are always samples.
+		double corners[4][2] = {
+			{ umin, vmin },
+			{ umax, vmin },
+			{ umin, vmax },
+			{ umax, vmax }
+		};
+
+		SamplePoint::Point cornerPositions[4];
+
+		for (int c = 0; c < 4; c++)
+		{
+			surface->GetPoint(corners[c][0], corners[c][1], cornerPositions[c]._x, cornerPositions[c]._y, cornerPositions[c]._z);
+
+			accept(corners[c][0], corners[c][1], cornerPositions[c]);
+		}
+
+		// Lay the tiles, scaled so that their spacing becomes 2 alpha,
+		// and cut them at the sides of the domain.  Samples in cells
+		// that shrink the tile, or next to a seam, are set aside to be
+		// checked after all others are accepted, so they are checked
+		// against all of them.
+		const double scale = spacing / _tile.GetSpacing();
+
+		const size_t tilesU = size_t(ceil(lu[n] / scale));
+		const size_t tilesV = size_t(ceil(lv[n] / scale));
+
+		std::vector<double> deferred;
+
+		for (size_t ti = 0; ti < tilesU; ti++)
+		{
+			for (size_t tj = 0; tj < tilesV; tj++)
+			{
+				for (size_t p = 0; p < _tile.GetSize(); p++)
+				{
+					double s, t;
+					_tile.GetPoint(p, s, t);
+
+					double ls = (ti + s) * scale;
+					double lt = (tj + t) * scale;
+
+					if ((ls > lu[n]) || (lt > lv[n]))
+					{
+						continue;
+					}
+
+					double u = Parameter(lu, umin, du, ls);
+					double v = Parameter(lv, vmin, dv, lt);
+
+					size_t ci = std::min(size_t((u - umin) / du), n - 1);
+					size_t cj = std::min(size_t((v - vmin) / dv), n - 1);
+
+					// Along a periodic coordinate, the samples within
+					// the spacing of the upper side may be close to
+					// those past the lower side.
+					bool seam = (surface->IsPeriodicInU() && (ls > lu[n] - spacing)) ||
+								(surface->IsPeriodicInV() && (lt > lv[n] - spacing));
+
+					if (shrinks[ci * n + cj] || seam)
+					{
+						deferred.push_back(u);
+						deferred.push_back(v);
+						continue;
+					}
+
+					SamplePoint::Point pos;
+					surface->GetPoint(u, v, pos._x, pos._y, pos._z);
+
+					// The corners are not tile points.
+					bool conflicted = false;
+
+					for (int c = 0; (c < 4) && !conflicted; c++)
+					{
+						double dx = pos._x - cornerPositions[c]._x;
+						double dy = pos._y - cornerPositions[c]._y;
+						double dz = pos._z - cornerPositions[c]._z;
+
+						conflicted = (dx * dx + dy * dy + dz * dz) < spacing2;
+					}
+
+					if (!conflicted)
+					{
+						accept(u, v, pos);
+					}
+				}
+			}
+		}
+
+		std::vector<size_t> found;
+
+		for (size_t k = 0; k < deferred.size(); k += 2)
+		{
+			SamplePoint::Point pos;
+			surface->GetPoint(deferred[k], deferred[k + 1], pos._x, pos._y, pos._z);
+
+			double x[3] = { pos._x, pos._y, pos._z };
+
+			tree.FindInRadius(x, spacing, found);
+
+			if (found.empty())
+			{
+				accept(deferred[k], deferred[k + 1], pos);
+			}
+		}
+
+		numberOfPoints = points.size();
+
+		return deferred.size() / 2;
+	}
+
+}
+
+/** @} */ //end of group class.
@@ -0,0 +1,169 @@
+/**
+ * \file TileSampler.h
+ *
+ * \brief This file contains the definition of a class that samples a
+ * surface by laying copies of a periodic Poisson disk tile over its
+ * parameter domain.
+ *
+ * \author
+ * Adelino Afonso e Irene Ginani \n
+ * Universidade Federal do Rio Grande do Norte, \n
+ * Instituto Metr&oacute;pole Digital, \n
+ * Adelino Afonso at imd (dot) ufrn (dot) br, \n
+ * Irene Ginani at imd (dot) ufrn (dot) br
+ *
+ * \version 1.0
+ * \date October 2026
+ *
+ * \attention This program is distributed WITHOUT ANY WARRANTY, and it
+ *            may be freely redistributed under the condition that the
+ *            copyright notices  are not removed,  and no compensation
+ *            is received. Private, research, and institutional use is
+ *            free. Distribution of this  code as part of a commercial
+ *            system  is permissible ONLY  BY DIRECT  ARRANGEMENT WITH
+ *            THE AUTHOR.
+ */
+
+#pragma once
+
+#include "Surface.h"           // Surface
+#include "DtPoint.h"           // cdt::DtPoint
+#include "PoissonTile.h"       // PoissonTile
+
+#include <memory>              // std::shared_ptr
+#include <vector>              // std::vector
+
+
+/**
+ * \defgroup MAT309NameSpace Namespace MAT309.
+ * @{
+ */
+
+/**
+ * \namespace MAT309
+ *
+ * \brief Global namespace for MAT309 software.
+ *
+ */
+
+namespace MAT309
+{
+
+	/**
+	 * \class TileSampler
+	 *
+	 * \brief This class samples a surface with Poisson disk radius
+	 * alpha by laying copies of a periodic Poisson disk tile over the
+	 * parameter domain, for previews that need samples at once.
+	 *
+	 * The tiles are laid in tile coordinates (s, t), which are mapped
+	 * to the domain one parameter at a time: s grows with the length
+	 * along u measured by the largest sqrt(E) over v, and t with the
+	 * length along v measured by the largest sqrt(G) over u, both
+	 * scaled so that the spacing of the tile becomes 2 alpha.  Hence
+	 * the samples are never farther apart on the surface than in the
+	 * tile, and are only closer where the metric at them is smaller
+	 * than the largest one, or sheared.  Those samples are checked
+	 * against the others with a kd-tree and dropped if closer than 2
+	 * alpha; all other samples are accepted without any distance test.
+	 * On a surface whose parametrization is an isometry up to scaling
+	 * of each parameter, such as the cylinder, no sample is checked.
+	 * Along a periodic coordinate, the samples next to the upper side
+	 * are checked too.  The four corners of the domain are always
+	 * samples.
+	 *
+	 */
+	class TileSampler
+	{
+	public:
+
+		// -----------------------------------------------------------
+		//
+		// Type definitions
+		//
+		// -----------------------------------------------------------
+
+		/**
+		 * \typedef spPoint
+		 *
+		 * \brief Alias for a shared pointer to DtPoint objects.
+		 *
+		 */
+		typedef cdt::DtPoint::spPoint spPoint;
+
+
+		/**
+		 * \typedef spSurface
+		 *
+		 * \brief Alias for a shared pointer to a surface.
+		 *
+		 */
+		typedef std::shared_ptr<Surface> spSurface;
+
+
+	private:
+
+		// -----------------------------------------------------------
+		//
+		// Private data members
+		//
+		// -----------------------------------------------------------
+
+		PoissonTile _tile;    ///< The tile laid over the domain.
+		double _alpha;        ///< The Poisson disk radius.
+
+
+	public:
+
+		// -----------------------------------------------------------
+		//
+		// Public methods
+		//
+		// -----------------------------------------------------------
+
+		/**
+		 * \fn TileSampler(const PoissonTile& tile, double alpha)
+		 *
+		 * \brief Creates an instance of this class.
+		 *
+		 * \param tile The tile laid over the domain.
+		 * \param alpha The Poisson disk radius.
+		 *
+		 */
+		TileSampler(
+			const PoissonTile& tile,
+			double alpha
+		)
+			:
+			_tile(tile),
+			_alpha(alpha)
+		{
+		}
+
+
+		/**
+		 * \fn size_t Sample(const spSurface& surface, size_t& numberOfPoints, std::vector<spPoint>& points) const
+		 *
+		 * \brief Samples a surface.
+		 *
+		 * \param surface A pointer to the surface to be sampled.
+		 * \param numberOfPoints A reference to the number of sample
+		 * points.
+		 * \param points A reference to an array of sample points.
+		 *
+		 * \return The number of tile points that were checked against
+		 * the other samples.
+		 *
+		 */
+		size_t
+			Sample(
+				const spSurface& surface,
+				size_t& numberOfPoints,
+				std::vector<spPoint>& points
+			)
+			const;
+	};
+
+}
+
+/** @} */ //end of group class.
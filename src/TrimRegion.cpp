@@ -0,0 +1,469 @@
+/**
+ * \file TrimRegion.cpp
+ *
+ * \brief Implementation of the class TrimRegion, which holds the
+ * trimming curves of a surface patch and tells which points of its
+ * parameter domain are kept.
+ *
+ * \author
+ * Adelino Afonso e Irene Ginani \n
+ * Universidade Federal do Rio Grande do Norte, \n
+ * Instituto Metr&oacute;pole Digital, \n
+ * Adelino Afonso at imd (dot) ufrn (dot) br, \n
+ * Irene Ginani at imd (dot) ufrn (dot) br
+ *
+ * \version 1.0
+ * \date October 2026
+ *
+ * \attention This program is distributed WITHOUT ANY WARRANTY, and it
+ *            may be freely redistributed under the condition that the
+ *            copyright notices  are not removed,  and no compensation
+ *            is received. Private, research, and institutional use is
+ *            free. Distribution of this  code as part of a commercial
+ *            system  is permissible ONLY  BY DIRECT  ARRANGEMENT WITH
+ *            THE AUTHOR.
+ */
+
+#include "TrimRegion.h"          // TrimRegion
+#include "BoundarySampler.h"     // BoundarySampler
+
+#include <algorithm>             // std::min, std::max, std::sort
+#include <cmath>                 // floor, std::isfinite
+#include <fstream>               // std::ifstream
+#include <stdexcept>             // std::runtime_error
+#include <utility>               // std::pair
+
+
+/**
+ * \defgroup MAT309NameSpace Namespace MAT309.
+ * @{
+ */
+
+/**
+ * \namespace MAT309
+ *
+ * \brief Global namespace for MAT309 software.
+ */
+
+namespace MAT309
+{
+
+	/**
+	 * \fn void TrimRegion::Load(const std::string& filename)
+	 *
+	 * \brief Reads the trimming polygons from a text file, and
+	 * rasterizes them.
+	 *
+	 * \param filename The name of the file.
+	 *
+	 */
+	void
+		TrimRegion::Load(
+			const std::string& filename
+		)
+	{
+		std::ifstream in(filename);
+
+		if (!in.is_open())
+		{
+			throw std::runtime_error("Trimming file cannot be opened.");
+		}
+
+		_vertices.clear();
+		_polygonEnds.clear();
+		_edges.clear();
+
+		size_t numberOfPolygons = 0;
+
+		if (!(in >> numberOfPolygons) || (numberOfPolygons == 0))
+		{
+			throw std::runtime_error("The trimming file must start with the number of polygons.");
+		}
+
+		for (size_t p = 0; p < numberOfPolygons; p++)
+		{
+			size_t numberOfVertices = 0;
+
+			if (!(in >> numberOfVertices) || (numberOfVertices < 3))
+			{
+				throw std::runtime_error("A trimming polygon must have at least 3 vertices.");
+			}
+
+			size_t first = _vertices.size() / 2;
+
+			for (size_t i = 0; i < numberOfVertices; i++)
+			{
+				double u, v;
+
+				if (!(in >> u >> v) || !std::isfinite(u) || !std::isfinite(v))
+				{
+					throw std::runtime_error("The trimming file is truncated, or has an invalid coordinate.");
+				}
+
+				_vertices.push_back(u);
+				_vertices.push_back(v);
+			}
+
+			size_t last = _vertices.size() / 2;
+
+			for (size_t i = first; i < last; i++)
+			{
+				_edges.push_back(i);
+				_edges.push_back((i + 1 < last) ? i + 1 : first);
+			}
+
+			_polygonEnds.push_back(last);
+		}
+
+		Rasterize();
+
+		return;
+	}
+
+
+	/**
+	 * \fn bool TrimRegion::IsKept(double u, double v) const
+	 *
+	 * \brief Tells whether a point of the domain is kept.
+	 *
+	 * \param u The first parameter coordinate of the point.
+	 * \param v The second parameter coordinate of the point.
+	 *
+	 * \return True if the point is kept, and false if it is trimmed
+	 * away.
+	 *
+	 */
+	bool
+		TrimRegion::IsKept(
+			double u,
+			double v
+		)
+		const
+	{
+		if (_size == 0)
+		{
+			return false;
+		}
+
+		double s = (u - _umin) / _du;
+		double t = (v - _vmin) / _dv;
+
+		// Outside the bounding box, a point is outside all polygons.
+		if ((s < 0) || (t < 0) || (s > _size) || (t > _size))
+		{
+			return false;
+		}
+
+		size_t i = std::min(size_t(s), _size - 1);
+		size_t j = std::min(size_t(t), _size - 1);
+		size_t k = j * _size + i;
+
+		bool kept = (_kept[k] != 0);
+
+		// Each edge the way to the center of the cell crosses flips
+		// the classification.
+		double cu = _umin + (i + 0.5) * _du;
+		double cv = _vmin + (j + 0.5) * _dv;
+
+		for (size_t e = _cellStarts[k]; e < _cellStarts[k + 1]; e++)
+		{
+			if (Crosses(u, v, cu, cv, _cellEdges[e]))
+			{
+				kept = !kept;
+			}
+		}
+
+		return kept;
+	}
+
+
+	/**
+	 * \fn void TrimRegion::Draw(double a, double b, double c, double& u, double& v) const
+	 *
+	 * \brief Maps three numbers drawn uniformly from [0,1) to a point
+	 * drawn uniformly from the cells that are not wholly trimmed away.
+	 *
+	 * \param a A number in [0,1) choosing the cell.
+	 * \param b A number in [0,1) choosing u within the cell.
+	 * \param c A number in [0,1) choosing v within the cell.
+	 * \param u A reference to the first parameter coordinate of the
+	 * point.
+	 * \param v A reference to the second parameter coordinate of the
+	 * point.
+	 *
+	 */
+	void
+		TrimRegion::Draw(
+			double a,
+			double b,
+			double c,
+			double& u,
+			double& v
+		)
+		const
+	{
+		if (_openCells.empty())
+		{
+			throw std::runtime_error("The trimming polygons keep no part of the domain.");
+		}
+
+		size_t k = _openCells[std::min(size_t(a * _openCells.size()), _openCells.size() - 1)];
+
+		u = _umin + ((k % _size) + b) * _du;
+		v = _vmin + ((k / _size) + c) * _dv;
+
+		return;
+	}
+
+
+	/**
+	 * \fn void TrimRegion::SampleBoundary(const spSurface& surface, double spacing, std::vector<spPoint>& points, std::vector<size_t>& segments) const
+	 *
+	 * \brief Samples the trimming polygons, splitting each edge into
+	 * pieces no longer than a given length on the surface.
+	 *
+	 * \param surface A pointer to the surface to be sampled.
+	 * \param spacing The largest length of a piece on the surface.
+	 * \param points A reference to an array of samples.
+	 * \param segments A reference to an array with the indices of the
+	 * two samples of each segment.
+	 *
+	 */
+	void
+		TrimRegion::SampleBoundary(
+			const spSurface& surface,
+			double spacing,
+			std::vector<spPoint>& points,
+			std::vector<size_t>& segments
+		)
+		const
+	{
+		for (size_t i = 0; i < _vertices.size(); i += 2)
+		{
+			if ((_vertices[i] < surface->GetUMin()) || (_vertices[i] > surface->GetUMax()) ||
+				(_vertices[i + 1] < surface->GetVMin()) || (_vertices[i + 1] > surface->GetVMax()))
+			{
+				throw std::runtime_error("The trimming polygons must lie in the domain of the surface.");
+			}
+		}
+
+		BoundarySampler sampler(surface, spacing);
+
+		size_t first = 0;
+
+		for (size_t p = 0; p < _polygonEnds.size(); p++)
+		{
+			std::vector<double> corners(_vertices.begin() + 2 * first, _vertices.begin() + 2 * _polygonEnds[p]);
+
+			sampler.SampleLoop(corners, points, segments);
+
+			first = _polygonEnds[p];
+		}
+
+		return;
+	}
+
+
+	/**
+	 * \fn void TrimRegion::Rasterize()
+	 *
+	 * \brief Builds the grid of cells over the bounding box of the
+	 * polygons.
+	 *
+	 */
+	void
+		TrimRegion::Rasterize()
+	{
+		double umax = _vertices[0];
+		double vmax = _vertices[1];
+
+		_umin = umax;
+		_vmin = vmax;
+
+		for (size_t i = 0; i < _vertices.size(); i += 2)
+		{
+			_umin = std::min(_umin, _vertices[i]);
+			_vmin = std::min(_vmin, _vertices[i + 1]);
+			umax = std::max(umax, _vertices[i]);
+			vmax = std::max(vmax, _vertices[i + 1]);
+		}
+
+		if ((umax <= _umin) || (vmax <= _vmin))
+		{
+			throw std::runtime_error("The trimming polygons have no area.");
+		}
+
+		_size = 256;
+		_du = (umax - _umin) / _size;
+		_dv = (vmax - _vmin) / _size;
+
+		const size_t numberOfCells = _size * _size;
+
+		auto Cell = [&](double x, double start, double step)
+		{
+			double s = floor((x - start) / step);
+
+			return size_t(std::min(std::max(s, 0.0), double(_size - 1)));
+		};
+
+		// The cells each edge touches: those of its bounding box that
+		// its line does not leave wholly on one side.
+		std::vector< std::pair<size_t, size_t> > touches;
+
+		const size_t numberOfEdges = _edges.size() / 2;
+
+		for (size_t e = 0; e < numberOfEdges; e++)
+		{
+			double au = _vertices[2 * _edges[2 * e]];
+			double av = _vertices[2 * _edges[2 * e] + 1];
+			double bu = _vertices[2 * _edges[2 * e + 1]];
+			double bv = _vertices[2 * _edges[2 * e + 1] + 1];
+
+			size_t i0 = Cell(std::min(au, bu), _umin, _du);
+			size_t i1 = Cell(std::max(au, bu), _umin, _du);
+			size_t j0 = Cell(std::min(av, bv), _vmin, _dv);
+			size_t j1 = Cell(std::max(av, bv), _vmin, _dv);
+
+			for (size_t j = j0; j <= j1; j++)
+			{
+				for (size_t i = i0; i <= i1; i++)
+				{
+					int below = 0;
+					int above = 0;
+
+					for (int c = 0; c < 4; c++)
+					{
+						double pu = _umin + (i + c % 2) * _du;
+						double pv = _vmin + (j + c / 2) * _dv;
+
+						double side = (bu - au) * (pv - av) - (bv - av) * (pu - au);
+
+						below += (side < 0) ? 1 : 0;
+						above += (side > 0) ? 1 : 0;
+					}
+
+					if ((below < 4) && (above < 4))
+					{
+						touches.push_back(std::make_pair(j * _size + i, e));
+					}
+				}
+			}
+		}
+
+		std::sort(touches.begin(), touches.end());
+
+		_cellStarts.assign(numberOfCells + 1, 0);
+		_cellEdges.resize(touches.size());
+
+		for (size_t t = 0; t < touches.size(); t++)
+		{
+			_cellStarts[touches[t].first + 1]++;
+			_cellEdges[t] = touches[t].second;
+		}
+
+		for (size_t k = 0; k < numberOfCells; k++)
+		{
+			_cellStarts[k + 1] += _cellStarts[k];
+		}
+
+		// Classify the centers of the cells row by row, by the parity
+		// of the edges crossing the row to their left.
+		_kept.assign(numberOfCells, 0);
+
+		std::vector<double> crossings;
+
+		for (size_t j = 0; j < _size; j++)
+		{
+			double cv = _vmin + (j + 0.5) * _dv;
+
+			crossings.clear();
+
+			for (size_t e = 0; e < numberOfEdges; e++)
+			{
+				double au = _vertices[2 * _edges[2 * e]];
+				double av = _vertices[2 * _edges[2 * e] + 1];
+				double bu = _vertices[2 * _edges[2 * e + 1]];
+				double bv = _vertices[2 * _edges[2 * e + 1] + 1];
+
+				if ((av > cv) != (bv > cv))
+				{
+					crossings.push_back(au + (cv - av) * (bu - au) / (bv - av));
+				}
+			}
+
+			std::sort(crossings.begin(), crossings.end());
+
+			size_t left = 0;
+
+			for (size_t i = 0; i < _size; i++)
+			{
+				double cu = _umin + (i + 0.5) * _du;
+
+				while ((left < crossings.size()) && (crossings[left] < cu))
+				{
+					left++;
+				}
+
+				_kept[j * _size + i] = (left % 2 == 1) ? 1 : 0;
+			}
+		}
+
+		// Darts are only thrown in the cells that are kept, or partly.
+		_openCells.clear();
+
+		for (size_t k = 0; k < numberOfCells; k++)
+		{
+			if ((_kept[k] != 0) || (_cellStarts[k + 1] > _cellStarts[k]))
+			{
+				_openCells.push_back(k);
+			}
+		}
+
+		return;
+	}
+
+
+	/**
+	 * \fn bool TrimRegion::Crosses(double au, double av, double bu, double bv, size_t e) const
+	 *
+	 * \brief Tells whether a segment crosses an edge of the polygons at
+	 * a point interior to both.
+	 *
+	 * \param au The first coordinate of one end of the segment.
+	 * \param av The second coordinate of one end of the segment.
+	 * \param bu The first coordinate of the other end of the segment.
+	 * \param bv The second coordinate of the other end of the segment.
+	 * \param e The index of the edge.
+	 *
+	 * \return True if the segment crosses the edge, and false otherwise.
+	 *
+	 */
+	bool
+		TrimRegion::Crosses(
+			double au,
+			double av,
+			double bu,
+			double bv,
+			size_t e
+		)
+		const
+	{
+		double pu = _vertices[2 * _edges[2 * e]];
+		double pv = _vertices[2 * _edges[2 * e] + 1];
+		double qu = _vertices[2 * _edges[2 * e + 1]];
+		double qv = _vertices[2 * _edges[2 * e + 1] + 1];
+
+		// The side of each end of one segment of the line through the
+		// other.
+		double p = (bu - au) * (pv - av) - (bv - av) * (pu - au);
+		double q = (bu - au) * (qv - av) - (bv - av) * (qu - au);
+		double a = (qu - pu) * (av - pv) - (qv - pv) * (au - pu);
+		double b = (qu - pu) * (bv - pv) - (qv - pv) * (bu - pu);
+
+		return (((p < 0) && (q > 0)) || ((p > 0) && (q < 0))) &&
+			   (((a < 0) && (b > 0)) || ((a > 0) && (b < 0)));
+	}
+
+}
+
+/** @} */ //end of group class.
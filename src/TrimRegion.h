@@ -0,0 +1,305 @@
+/**
+ * \file TrimRegion.h
+ *
+ * \brief This file contains the definition of a class that holds the
+ * trimming curves of a surface patch and tells which points of its
+ * parameter domain are kept.
+ *
+ * \author
+ * Adelino Afonso e Irene Ginani \n
+ * Universidade Federal do Rio Grande do Norte, \n
+ * Instituto Metr&oacute;pole Digital, \n
+ * Adelino Afonso at imd (dot) ufrn (dot) br, \n
+ * Irene Ginani at imd (dot) ufrn (dot) br
+ *
+ * \version 1.0
+ * \date October 2026
+ *
+ * \attention This program is distributed WITHOUT ANY WARRANTY, and it
+ *            may be freely redistributed under the condition that the
+ *            copyright notices  are not removed,  and no compensation
+ *            is received. Private, research, and institutional use is
+ *            free. Distribution of this  code as part of a commercial
+ *            system  is permissible ONLY  BY DIRECT  ARRANGEMENT WITH
+ *            THE AUTHOR.
+ */
+
+#pragma once
+
+#include "Surface.h"           // Surface
+#include "DtPoint.h"           // cdt::DtPoint
+
+#include <memory>              // std::shared_ptr
+#include <string>              // std::string
+#include <vector>              // std::vector
+
+
+/**
+ * \defgroup MAT309NameSpace Namespace MAT309.
+ * @{
+ */
+
+/**
+ * \namespace MAT309
+ *
+ * \brief Global namespace for MAT309 software.
+ *
+ */
+
+namespace MAT309
+{
+
+	/**
+	 * \class TrimRegion
+	 *
+	 * \brief This class holds the trimming curves of a surface patch,
+	 * which are closed polygons of its parameter domain, and tells
+	 * whether a point of the domain is kept.  A point is kept if it
+	 * lies inside an odd number of polygons, as the regions of a CDT
+	 * of the polygons are classified by cdt::RegionVisitor: the outer
+	 * polygon bounds the patch, and the polygons inside it bound holes.
+	 *
+	 * The bounding box of the polygons is rasterized into a grid of
+	 * cells.  The cells no polygon edge touches are wholly kept or
+	 * wholly trimmed away, as their centers are, so a point in them is
+	 * classified by a lookup.  A point in any other cell is classified
+	 * exactly, by counting the edges of that cell the segment from the
+	 * point to the center of the cell crosses.
+	 *
+	 * The polygons are read from a text file holding their number,
+	 * and then, for each polygon, its number of vertices followed by
+	 * the u and v coordinates of each vertex.
+	 *
+	 */
+	class TrimRegion
+	{
+	public:
+
+		// -----------------------------------------------------------
+		//
+		// Type definitions
+		//
+		// -----------------------------------------------------------
+
+		/**
+		 * \typedef spPoint
+		 *
+		 * \brief Alias for a shared pointer to DtPoint objects.
+		 *
+		 */
+		typedef cdt::DtPoint::spPoint spPoint;
+
+
+		/**
+		 * \typedef spSurface
+		 *
+		 * \brief Alias for a shared pointer to a surface.
+		 *
+		 */
+		typedef std::shared_ptr<Surface> spSurface;
+
+
+	private:
+
+		// -----------------------------------------------------------
+		//
+		// Private data members
+		//
+		// -----------------------------------------------------------
+
+		std::vector<double> _vertices;          ///< The two coordinates of each vertex of the polygons.
+		std::vector<size_t> _polygonEnds;       ///< The index past the last vertex of each polygon.
+		std::vector<size_t> _edges;             ///< The indices of the two vertices of each edge of the polygons.
+
+		size_t _size;                           ///< The number of cells along each side of the grid.
+		double _umin;                           ///< The lower bound of the grid along u.
+		double _vmin;                           ///< The lower bound of the grid along v.
+		double _du;                             ///< The width of a cell.
+		double _dv;                             ///< The height of a cell.
+
+		std::vector<unsigned char> _kept;       ///< Whether the center of each cell is kept.
+		std::vector<size_t> _cellStarts;        ///< The index of the first edge of each cell in _cellEdges.
+		std::vector<size_t> _cellEdges;         ///< The edges touching each cell, cell after cell.
+		std::vector<size_t> _openCells;         ///< The cells that are not wholly trimmed away.
+
+
+	public:
+
+		// -----------------------------------------------------------
+		//
+		// Public methods
+		//
+		// -----------------------------------------------------------
+
+		/**
+		 * \fn TrimRegion()
+		 *
+		 * \brief Creates an instance of this class with no polygon,
+		 * which keeps no point.
+		 *
+		 */
+		TrimRegion()
+			:
+			_size(0),
+			_umin(0),
+			_vmin(0),
+			_du(0),
+			_dv(0)
+		{
+		}
+
+
+		/**
+		 * \fn size_t GetNumberOfPolygons() const
+		 *
+		 * \brief Returns the number of trimming polygons.
+		 *
+		 * \return The number of trimming polygons.
+		 *
+		 */
+		size_t GetNumberOfPolygons() const
+		{
+			return _polygonEnds.size();
+		}
+
+
+		/**
+		 * \fn void Load(const std::string& filename)
+		 *
+		 * \brief Reads the trimming polygons from a text file, and
+		 * rasterizes them.
+		 *
+		 * \param filename The name of the file.
+		 *
+		 */
+		void
+			Load(
+				const std::string& filename
+			);
+
+
+		/**
+		 * \fn bool IsKept(double u, double v) const
+		 *
+		 * \brief Tells whether a point of the domain is kept.
+		 *
+		 * \param u The first parameter coordinate of the point.
+		 * \param v The second parameter coordinate of the point.
+		 *
+		 * \return True if the point is kept, and false if it is
+		 * trimmed away.
+		 *
+		 */
+		bool
+			IsKept(
+				double u,
+				double v
+			)
+			const;
+
+
+		/**
+		 * \fn void Draw(double a, double b, double c, double& u, double& v) const
+		 *
+		 * \brief Maps three numbers drawn uniformly from [0,1) to a
+		 * point drawn uniformly from the cells that are not wholly
+		 * trimmed away, so that darts are only thrown where they may be
+		 * kept.
+		 *
+		 * \param a A number in [0,1) choosing the cell.
+		 * \param b A number in [0,1) choosing u within the cell.
+		 * \param c A number in [0,1) choosing v within the cell.
+		 * \param u A reference to the first parameter coordinate of the
+		 * point.
+		 * \param v A reference to the second parameter coordinate of
+		 * the point.
+		 *
+		 */
+		void
+			Draw(
+				double a,
+				double b,
+				double c,
+				double& u,
+				double& v
+			)
+			const;
+
+
+		/**
+		 * \fn void SampleBoundary(const spSurface& surface, double spacing, std::vector<spPoint>& points, std::vector<size_t>& segments) const
+		 *
+		 * \brief Samples the trimming polygons, splitting each edge into
+		 * pieces no longer than a given length on the surface.  The
+		 * samples are appended to an array of samples, and the pieces
+		 * to an array of segments, as the CDT of a set of points and
+		 * segments takes them.
+		 *
+		 * \param surface A pointer to the surface to be sampled.
+		 * \param spacing The largest length of a piece on the surface.
+		 * \param points A reference to an array of samples.
+		 * \param segments A reference to an array with the indices of
+		 * the two samples of each segment.
+		 *
+		 */
+		void
+			SampleBoundary(
+				const spSurface& surface,
+				double spacing,
+				std::vector<spPoint>& points,
+				std::vector<size_t>& segments
+			)
+			const;
+
+
+	private:
+
+		// -----------------------------------------------------------
+		//
+		// Private methods
+		//
+		// -----------------------------------------------------------
+
+		/**
+		 * \fn void Rasterize()
+		 *
+		 * \brief Builds the grid of cells over the bounding box of the
+		 * polygons.
+		 *
+		 */
+		void
+			Rasterize();
+
+
+		/**
+		 * \fn bool Crosses(double au, double av, double bu, double bv, size_t e) const
+		 *
+		 * \brief Tells whether a segment crosses an edge of the
+		 * polygons at a point interior to both.
+		 *
+		 * \param au The first coordinate of one end of the segment.
+		 * \param av The second coordinate of one end of the segment.
+		 * \param bu The first coordinate of the other end of the
+		 * segment.
+		 * \param bv The second coordinate of the other end of the
+		 * segment.
+		 * \param e The index of the edge.
+		 *
+		 * \return True if the segment crosses the edge, and false
+		 * otherwise.
+		 *
+		 */
+		bool
+			Crosses(
+				double au,
+				double av,
+				double bu,
+				double bv,
+				size_t e
+			)
+			const;
+	};
+
+}
+
+/** @} */ //end of group class.
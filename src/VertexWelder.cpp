@@ -0,0 +1,272 @@
+/**
+ * \file VertexWelder.cpp
+ *
+ * \brief Implementation of the class VertexWelder, which welds the
+ * vertices of an output mesh that lie at the same place on the surface.
+ *
+ * \author
+ * Adelino Afonso e Irene Ginani \n
+ * Universidade Federal do Rio Grande do Norte, \n
+ * Instituto Metr&oacute;pole Digital, \n
+ * Adelino Afonso at imd (dot) ufrn (dot) br, \n
+ * Irene Ginani at imd (dot) ufrn (dot) br
+ *
+ * \version 1.0
+ * \date October 2026
+ *
+ * \attention This program is distributed WITHOUT ANY WARRANTY, and it
+ *            may be freely redistributed under the condition that the
+ *            copyright notices  are not removed,  and no compensation
+ *            is received. Private, research, and institutional use is
+ *            free. Distribution of this  code as part of a commercial
+ *            system  is permissible ONLY  BY DIRECT  ARRANGEMENT WITH
+ *            THE AUTHOR.
+ */
+
+#include "VertexWelder.h"        // VertexWelder
+#include "SamplePoint.h"         // SamplePoint
+#include "Parallel.h"            // ParallelFor
+
+#include <algorithm>             // std::sort
+#include <cmath>                 // floor
+#include <cstdint>               // int64_t, uint64_t
+#include <stdexcept>             // std::runtime_error
+#include <unordered_map>         // std::unordered_map
+#include <utility>               // std::pair
+
+
+/**
+ * \defgroup MAT309NameSpace Namespace MAT309.
+ * @{
+ */
+
+/**
+ * \namespace MAT309
+ *
+ * \brief Global namespace for MAT309 software.
+ */
+
+namespace MAT309
+{
+
+	/**
+	 * \fn size_t VertexWelder::Weld(size_t& numberOfTriangles, std::vector<size_t>& triangles, size_t& numberOfVertices, std::vector<spPoint>& vertices) const
+	 *
+	 * \brief Welds the vertices of a triangulation that are within the
+	 * tolerance of each other, and removes the triangles left with a
+	 * repeated vertex.
+	 *
+	 * \param numberOfTriangles A reference to the number of triangles.
+	 * \param triangles A reference to an array with the vertex indices
+	 * of all triangles.
+	 * \param numberOfVertices A reference to the number of vertices.
+	 * \param vertices A reference to an array with all vertices.
+	 *
+	 * \return The number of vertices removed.
+	 *
+	 */
+	size_t
+		VertexWelder::Weld(
+			size_t& numberOfTriangles,
+			std::vector<size_t>& triangles,
+			size_t& numberOfVertices,
+			std::vector<spPoint>& vertices
+		)
+		const
+	{
+		if (_tolerance <= 0)
+		{
+			throw std::runtime_error("The welding tolerance must be positive.");
+		}
+
+		const double tolerance2 = _tolerance * _tolerance;
+
+		// The points of the vertices on the surface, and their cells.
+		std::vector<double> x(3 * numberOfVertices);
+		std::vector<int64_t> cells(3 * numberOfVertices);
+		std::vector<uint64_t> keys(numberOfVertices);
+
+		auto Key = [](int64_t i, int64_t j, int64_t k)
+		{
+			return (uint64_t(i) * 73856093u) ^ (uint64_t(j) * 19349663u) ^ (uint64_t(k) * 83492791u);
+		};
+
+		ParallelFor(
+			0,
+			numberOfVertices,
+			_numberOfThreads,
+			[&](size_t first, size_t last)
+			{
+				for (size_t i = first; i < last; i++)
+				{
+					std::shared_ptr<SamplePoint> sp = std::dynamic_pointer_cast<SamplePoint>(vertices[i]);
+
+					if (sp != nullptr)
+					{
+						x[3 * i] = sp->_pos._x;
+						x[3 * i + 1] = sp->_pos._y;
+						x[3 * i + 2] = sp->_pos._z;
+					}
+					else
+					{
+						_surface->GetPoint(vertices[i]->GetU(), vertices[i]->GetV(), x[3 * i], x[3 * i + 1], x[3 * i + 2]);
+					}
+
+					for (size_t d = 0; d < 3; d++)
+					{
+						cells[3 * i + d] = int64_t(floor(x[3 * i + d] / _tolerance));
+					}
+
+					keys[i] = Key(cells[3 * i], cells[3 * i + 1], cells[3 * i + 2]);
+				}
+			}
+		);
+
+		// The vertices sorted by key, and the range of each key.  Cells
+		// sharing a key are told apart by the distance test.
+		std::vector<size_t> order(numberOfVertices);
+
+		for (size_t i = 0; i < numberOfVertices; i++)
+		{
+			order[i] = i;
+		}
+
+		std::sort(
+			order.begin(),
+			order.end(),
+			[&](size_t a, size_t b)
+			{
+				return (keys[a] < keys[b]) || ((keys[a] == keys[b]) && (a < b));
+			}
+		);
+
+		std::unordered_map< uint64_t, std::pair<size_t, size_t> > ranges;
+
+		ranges.reserve(numberOfVertices);
+
+		for (size_t k = 0; k < numberOfVertices; )
+		{
+			size_t end = k + 1;
+
+			while ((end < numberOfVertices) && (keys[order[end]] == keys[order[k]]))
+			{
+				end++;
+			}
+
+			ranges[keys[order[k]]] = std::make_pair(k, end);
+			k = end;
+		}
+
+		// The first vertex within the tolerance of each vertex, which
+		// may be the vertex itself.
+		std::vector<size_t> target(numberOfVertices);
+
+		ParallelFor(
+			0,
+			numberOfVertices,
+			_numberOfThreads,
+			[&](size_t first, size_t last)
+			{
+				for (size_t i = first; i < last; i++)
+				{
+					target[i] = i;
+
+					for (int64_t di = -1; di <= 1; di++)
+					{
+						for (int64_t dj = -1; dj <= 1; dj++)
+						{
+							for (int64_t dk = -1; dk <= 1; dk++)
+							{
+								auto range = ranges.find(Key(cells[3 * i] + di, cells[3 * i + 1] + dj, cells[3 * i + 2] + dk));
+
+								if (range == ranges.end())
+								{
+									continue;
+								}
+
+								for (size_t k = range->second.first; k < range->second.second; k++)
+								{
+									size_t j = order[k];
+
+									if (j >= target[i])
+									{
+										break;
+									}
+
+									double dx = x[3 * j] - x[3 * i];
+									double dy = x[3 * j + 1] - x[3 * i + 1];
+									double dz = x[3 * j + 2] - x[3 * i + 2];
+
+									if ((dx * dx + dy * dy + dz * dz) <= tolerance2)
+									{
+										target[i] = j;
+										break;
+									}
+								}
+							}
+						}
+					}
+				}
+			}
+		);
+
+		// Weld each vertex to the vertex its target is welded to, which
+		// comes before it.
+		for (size_t i = 0; i < numberOfVertices; i++)
+		{
+			target[i] = target[target[i]];
+		}
+
+		// Make the triangles use the welded vertices.
+		size_t kept = 0;
+
+		for (size_t t = 0; t < numberOfTriangles; t++)
+		{
+			size_t a = target[triangles[3 * t]];
+			size_t b = target[triangles[3 * t + 1]];
+			size_t c = target[triangles[3 * t + 2]];
+
+			if ((a == b) || (b == c) || (c == a))
+			{
+				continue;
+			}
+
+			triangles[3 * kept] = a;
+			triangles[3 * kept + 1] = b;
+			triangles[3 * kept + 2] = c;
+			kept++;
+		}
+
+		// Remove the welded vertices, keeping the order of the others.
+		std::vector<size_t> renumbered(numberOfVertices);
+
+		size_t numberOfKeptVertices = 0;
+
+		for (size_t i = 0; i < numberOfVertices; i++)
+		{
+			if (target[i] == i)
+			{
+				renumbered[i] = numberOfKeptVertices;
+				vertices[numberOfKeptVertices++] = vertices[i];
+			}
+		}
+
+		for (size_t k = 0; k < 3 * kept; k++)
+		{
+			triangles[k] = renumbered[triangles[k]];
+		}
+
+		size_t removed = numberOfVertices - numberOfKeptVertices;
+
+		numberOfTriangles = kept;
+		numberOfVertices = numberOfKeptVertices;
+
+		triangles.resize(3 * numberOfTriangles);
+		vertices.resize(numberOfVertices);
+
+		return removed;
+	}
+
+}
+
+/** @} */ //end of group class.
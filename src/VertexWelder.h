@@ -0,0 +1,173 @@
+/**
+ * \file VertexWelder.h
+ *
+ * \brief This file contains the definition of a class that welds the
+ * vertices of an output mesh that lie at the same place on the surface.
+ *
+ * \author
+ * Adelino Afonso e Irene Ginani \n
+ * Universidade Federal do Rio Grande do Norte, \n
+ * Instituto Metr&oacute;pole Digital, \n
+ * Adelino Afonso at imd (dot) ufrn (dot) br, \n
+ * Irene Ginani at imd (dot) ufrn (dot) br
+ *
+ * \version 1.0
+ * \date October 2026
+ *
+ * \attention This program is distributed WITHOUT ANY WARRANTY, and it
+ *            may be freely redistributed under the condition that the
+ *            copyright notices  are not removed,  and no compensation
+ *            is received. Private, research, and institutional use is
+ *            free. Distribution of this  code as part of a commercial
+ *            system  is permissible ONLY  BY DIRECT  ARRANGEMENT WITH
+ *            THE AUTHOR.
+ */
+
+#pragma once
+
+#include "Surface.h"           // Surface
+#include "DtPoint.h"           // cdt::DtPoint
+
+#include <memory>              // std::shared_ptr
+#include <vector>              // std::vector
+
+
+/**
+ * \defgroup MAT309NameSpace Namespace MAT309.
+ * @{
+ */
+
+/**
+ * \namespace MAT309
+ *
+ * \brief Global namespace for MAT309 software.
+ *
+ */
+
+namespace MAT309
+{
+
+	/**
+	 * \class VertexWelder
+	 *
+	 * \brief This class welds the vertices of a triangulation of samples
+	 * of a surface whose points on the surface are within a tolerance
+	 * of each other, such as the vertices on both sides of a seam the
+	 * CDT did not wrap around, or the samples at a pole.
+	 *
+	 * The points are hashed into cubic cells as large as the tolerance,
+	 * so the vertices within the tolerance of a vertex lie in the 27
+	 * cells around its own.  Each vertex is welded to the first vertex
+	 * within the tolerance, in the order of the vertices, which is
+	 * welded in turn, so the result does not depend on the number of
+	 * threads.  The points and the searches are computed in parallel.
+	 * The triangles are then made to use the welded vertices, and those
+	 * left with a repeated vertex are removed.
+	 *
+	 */
+	class VertexWelder
+	{
+	public:
+
+		// -----------------------------------------------------------
+		//
+		// Type definitions
+		//
+		// -----------------------------------------------------------
+
+		/**
+		 * \typedef spPoint
+		 *
+		 * \brief Alias for a shared pointer to DtPoint objects.
+		 *
+		 */
+		typedef cdt::DtPoint::spPoint spPoint;
+
+
+		/**
+		 * \typedef spSurface
+		 *
+		 * \brief Alias for a shared pointer to a surface.
+		 *
+		 */
+		typedef std::shared_ptr<Surface> spSurface;
+
+
+	private:
+
+		// -----------------------------------------------------------
+		//
+		// Private data members
+		//
+		// -----------------------------------------------------------
+
+		spSurface _surface;        ///< The surface the vertices lie on.
+		double _tolerance;         ///< The distance within which vertices are welded.
+		size_t _numberOfThreads;   ///< Number of threads (0 means one per hardware thread).
+
+
+	public:
+
+		// -----------------------------------------------------------
+		//
+		// Public methods
+		//
+		// -----------------------------------------------------------
+
+		/**
+		 * \fn VertexWelder(const spSurface& surface, double tolerance, size_t numberOfThreads = 0)
+		 *
+		 * \brief Creates an instance of this class.
+		 *
+		 * \param surface The surface the vertices lie on.
+		 * \param tolerance The distance within which vertices are
+		 * welded.
+		 * \param numberOfThreads The number of threads (0 means one per
+		 * hardware thread).
+		 *
+		 */
+		VertexWelder(
+			const spSurface& surface,
+			double tolerance,
+			size_t numberOfThreads = 0
+		)
+			:
+			_surface(surface),
+			_tolerance(tolerance),
+			_numberOfThreads(numberOfThreads)
+		{
+		}
+
+
+		/**
+		 * \fn size_t Weld(size_t& numberOfTriangles, std::vector<size_t>& triangles, size_t& numberOfVertices, std::vector<spPoint>& vertices) const
+		 *
+		 * \brief Welds the vertices of a triangulation that are within
+		 * the tolerance of each other, keeping the first of them, and
+		 * removes the triangles left with a repeated vertex.  The order
+		 * of the remaining vertices and triangles is kept.
+		 *
+		 * \param numberOfTriangles A reference to the number of
+		 * triangles.
+		 * \param triangles A reference to an array with the vertex
+		 * indices of all triangles.
+		 * \param numberOfVertices A reference to the number of
+		 * vertices.
+		 * \param vertices A reference to an array with all vertices.
+		 *
+		 * \return The number of vertices removed.
+		 *
+		 */
+		size_t
+			Weld(
+				size_t& numberOfTriangles,
+				std::vector<size_t>& triangles,
+				size_t& numberOfVertices,
+				std::vector<spPoint>& vertices
+			)
+			const;
+	};
+
+}
+
+/** @} */ //end of group class.
@@ -24,10 +24,9 @@
 
 // -------------------------------------------------------------------
 //
-// POR FAVOR, NÃO EDITE ESTE  ARQUIVO, exceto na parte indicada abaixo
-// na qual eu defino a superfície que será amostrada. Você pode trocá-
-// por outra. Para tal, não esqueça  de incluir o arquivo que define a
-// outra superfície.
+// POR FAVOR, NÃO EDITE ESTE  ARQUIVO. A superfície que será amostrada
+// é escolhida na linha de comando (--surface). Para amostrar uma outra
+// superfície, registre-a em SurfaceRegistry.h.
 //
 // -------------------------------------------------------------------
 
@@ -40,44 +39,58 @@
 #include <typeinfo>                 // std::bad_cast
 #include <vector>                   // std::vector
 #include <memory>                   // std::shared_ptr
-#include <exception>                // std::exception
+#include <exception>                // std::exception, std::exception_ptr
+#include <stdexcept>                // std::runtime_error
+#include <thread>                   // std::thread
 
 
 #include "Cdt.h"                    // cdt::CDT
 #include "DtPoint.h"                // cdt::DtPoint
 #include "FaceVisitor.h"            // cdt::FaceVisitor
+#include "TriangulationVisitor.h"   // cdt::TriangulationVisitor
 
 #include "SamplePoint.h"            // MAT309::SamplePoint
 #include "PDSampler.h"              // MAT309::PDSampler
+#include "OffWriter.h"              // MAT309::OffWriter
+#include "OffReader.h"              // MAT309::OffReader, MAT309::OffMesh
+#include "StageTimer.h"             // MAT309::StageTimer
+#include "SurfaceRegistry.h"        // MAT309::SurfaceRegistry
+#include "DriverOptions.h"          // MAT309::DriverOptions
+#include "RunBuffers.h"             // MAT309::RunBuffers
+#include "BatchMesher.h"            // MAT309::BatchMesher
+#include "LloydRelaxer.h"           // MAT309::LloydRelaxer
+#include "SampleEliminator.h"       // MAT309::SampleEliminator
+#include "AlphaEstimator.h"         // MAT309::AlphaEstimator
+#include "PoissonTile.h"            // MAT309::PoissonTile
+#include "TileSampler.h"            // MAT309::TileSampler
+#include "SeamWrapper.h"            // MAT309::SeamWrapper
+#include "VertexWelder.h"           // MAT309::VertexWelder
+#include "TrimRegion.h"             // MAT309::TrimRegion
+#include "BoundedQueue.h"           // MAT309::BoundedQueue
 
 using MAT309::cdt::CDT;
 using MAT309::cdt::DtPoint;
 using MAT309::cdt::FaceVisitor;
+using MAT309::cdt::TriangulationVisitor;
 using MAT309::SamplePoint;
 using MAT309::PDSampler;
-
-
-/********************************************************************/
-
-// -------------------------------------------------------------------
-// Se  você quiser  testar  seu  código com  uma  superfície que  você
-// definiu, comente  o "include" abaixo  e o adicione o  "include" que
-// contém o arquivo  no qual a sua superfície  está definida. Descubra
-// como definir a sua superfície examinando o código de MyCylinder.h.
-// -------------------------------------------------------------------
-
-#include "MyCylinder.h"             // MAT309::MyCylinder
-//#include "Esfera.h"				// MAT309::Esfera	
-//#include "Cone.h"					// MAT309::Cone
-// -------------------------------------------------------------------
-// Opte por inserir um "using" para a sua classe de superfície.
-// -------------------------------------------------------------------
-
-//using MAT309::Cone;
-//using MAT309::Esfera;
-using MAT309::MyCylinder;
-
-/********************************************************************/
+using MAT309::OffWriter;
+using MAT309::OffReader;
+using MAT309::OffMesh;
+using MAT309::StageTimer;
+using MAT309::SurfaceRegistry;
+using MAT309::DriverOptions;
+using MAT309::RunBuffers;
+using MAT309::BatchMesher;
+using MAT309::LloydRelaxer;
+using MAT309::SampleEliminator;
+using MAT309::AlphaEstimator;
+using MAT309::PoissonTile;
+using MAT309::TileSampler;
+using MAT309::SeamWrapper;
+using MAT309::VertexWelder;
+using MAT309::TrimRegion;
+using MAT309::BoundedQueue;
 
 
 /**
@@ -99,15 +112,66 @@ typedef SamplePoint::spSamplePoint spSamplePoint;
 
 
 /**
- * \fn void WritePatchTriangulation(const std::string& filename, size_t numberOfTriangles, const std::vector<size_t>& triangles, size_t numberOfVertices, const std::vector<spPoint>& vertices)
+ * \fn int Run(const DriverOptions& options, const SurfaceRegistry& registry, RunBuffers& buffers)
  *
- * \brief Write the surface patch triangulation to an OFF file.
+ * \brief Samples a surface, computes the CDT of the samples, and
+ * writes the triangulation to a file.
+ *
+ * \param options The settings of the run.
+ * \param registry The registry of surfaces.
+ * \param buffers The arrays reused across runs.
+ *
+ * \return EXIT_SUCCESS or EXIT_FAILURE.
+ */
+int Run(
+	const DriverOptions& options,
+	const SurfaceRegistry& registry,
+	RunBuffers& buffers
+);
+
+
+/**
+ * \fn CDT* SampleAndTriangulate(const PDSampler::spSurface& surface, size_t batchSize, const CDT::MetricField& metric, CDT::BoundaryMode boundary, PDSampler& sampler, size_t& numberOfPoints, std::vector<spPoint>& points)
+ *
+ * \brief Samples a surface on a separate thread, while the calling
+ * thread inserts the accepted points into a CDT in batches.
+ *
+ * \param surface A pointer to the surface to be sampled.
+ * \param batchSize Number of sample points per batch.
+ * \param metric The metric of the incircle test of the CDT.
+ * \param boundary How the CDT handles the outside of the convex hull.
+ * \param sampler The sampler.
+ * \param numberOfPoints A reference to the number of sample points.
+ * \param points A reference to an array of sample points, left empty:
+ * the points are only kept as vertices of the CDT.
+ *
+ * \return A pointer to the CDT of the sample points.
+ */
+CDT* SampleAndTriangulate(
+	const PDSampler::spSurface& surface,
+	size_t batchSize,
+	const CDT::MetricField& metric,
+	CDT::BoundaryMode boundary,
+	PDSampler& sampler,
+	size_t& numberOfPoints,
+	std::vector<spPoint>& points
+);
+
+
+/**
+ * \fn void WritePatchTriangulation(const std::string& filename, size_t numberOfTriangles, const std::vector<size_t>& triangles, size_t numberOfVertices, const std::vector<spPoint>& vertices, bool withParameters)
+ *
+ * \brief Write the surface patch triangulation to an OFF file.  Only
+ * the formatting of the records overlaps with the disk I/O; the mesh
+ * is extracted in full before it is written.
  *
  * \param filename The name of a file to be written to.
  * \param numberOfTriangles Total number of triangles of the CDT.
  * \param triangles An array with vertex indices of all triangles.
  * \param numberOfVertices Total number of vertices of the CDT.
  * \param vertices An array to store all vertices of the CDT.
+ * \param withParameters A flag to indicate whether an STOFF file,
+ * with the parameter coordinates of the vertices, is written.
  *
  */
 void WritePatchTriangulation(
@@ -115,7 +179,93 @@ void WritePatchTriangulation(
 	size_t numberOfTriangles,
 	const std::vector<size_t>& triangles,
 	size_t numberOfVertices,
-	const std::vector<spPoint>& vertices
+	const std::vector<spPoint>& vertices,
+	bool withParameters
+);
+
+
+/**
+ * \fn void StreamPatchTriangulation(CDT& cdt, const std::string& filename, bool withParameters, size_t& numberOfTriangles, size_t& numberOfVertices)
+ *
+ * \brief Write the triangulation of a CDT to an OFF file as the face
+ * visitor enumerates it, without storing the mesh first.
+ *
+ * \param cdt The CDT to be written.
+ * \param filename The name of a file to be written to.
+ * \param withParameters A flag to indicate whether an STOFF file,
+ * with the parameter coordinates of the vertices, is written.
+ * \param numberOfTriangles Total number of triangles written.
+ * \param numberOfVertices Total number of vertices written.
+ *
+ */
+void StreamPatchTriangulation(
+	CDT& cdt,
+	const std::string& filename,
+	bool withParameters,
+	size_t& numberOfTriangles,
+	size_t& numberOfVertices
+);
+
+
+/**
+ * \fn void WriteVertexRecord(OffWriter& ou, const spPoint& vertex, bool withParameters)
+ *
+ * \brief Write the record of a vertex to an OFF file.
+ *
+ * \param ou The writer of the OFF file.
+ * \param vertex The vertex.
+ * \param withParameters A flag to indicate whether the parameter
+ * coordinates of the vertex are written too.
+ *
+ */
+void WriteVertexRecord(
+	OffWriter& ou,
+	const spPoint& vertex,
+	bool withParameters
+);
+
+
+/**
+ * \fn size_t WriteLevelOfDetail(CDT& cdt, const SeamWrapper* seams, const std::string& filename, bool withParameters, RunBuffers& buffers)
+ *
+ * \brief Write the triangulation of a coarser level of detail to an
+ * OFF file.
+ *
+ * \param cdt The CDT of the samples of the level.
+ * \param seams The wrapper of the seams the CDT wraps around, or a
+ * null pointer if it does not.
+ * \param filename The name of a file to be written to.
+ * \param withParameters A flag to indicate whether an STOFF file,
+ * with the parameter coordinates of the vertices, is written.
+ * \param buffers The arrays reused across runs.
+ *
+ * \return The number of triangles written.
+ *
+ */
+size_t WriteLevelOfDetail(
+	CDT& cdt,
+	const SeamWrapper* seams,
+	const std::string& filename,
+	bool withParameters,
+	RunBuffers& buffers
+);
+
+
+/**
+ * \fn void WriteSamplePoints(const std::string& filename, size_t numberOfPoints, const std::vector<spPoint>& points)
+ *
+ * \brief Write a set of sample points to an STOFF file, so that it can
+ * be loaded again with the option --load-samples.
+ *
+ * \param filename The name of a file to be written to.
+ * \param numberOfPoints Total number of sample points.
+ * \param points An array with the sample points.
+ *
+ */
+void WriteSamplePoints(
+	const std::string& filename,
+	size_t numberOfPoints,
+	const std::vector<spPoint>& points
 );
 
 
@@ -136,56 +286,155 @@ void WritePatchTriangulation(
 int main(int argc, char* argv[])
 {
 	// Check command-line arguments.
-	if (argc != 2)
+	std::vector<DriverOptions> runs;
+	bool batch;
+
+	try
+	{
+		DriverOptions::ParseCommandLine(argc, argv, runs, batch);
+	}
+	catch (const std::exception& xpt)
 	{
-		std::cerr << "Usage: "
+		std::cerr << std::endl
+				<< "ERROR: "
+				<< xpt.what()
 				<< std::endl
-				<< "\t\t CDT arg1"
 				<< std::endl
-				<< "\t\t arg1: name of the output file describing the triangulation of the sample points."
+				<< "Usage: "
 				<< std::endl
+				<< DriverOptions::GetUsage()
 				<< std::endl;
 		return EXIT_FAILURE;
 	}
 
-	// Sample the surface.
-	std::cout	<< std::endl
-				<< "Sampling a surface using Poisson Disk Sampling..."
-				<< std::endl;
-	std::cout.flush();
+	SurfaceRegistry registry;
+
+	// Mesh the patches of a batch file concurrently.
+	if (batch)
+	{
+		BatchMesher mesher(registry, runs[0]._numberOfThreads);
+		return mesher.Run(runs);
+	}
+
+	RunBuffers buffers;
+
+	int status = EXIT_SUCCESS;
+
+	for (size_t i = 0; i < runs.size(); i++)
+	{
+		if (runs.size() > 1)
+		{
+			std::cout	<< std::endl
+						<< "Run "
+						<< (i + 1)
+						<< " of "
+						<< runs.size()
+						<< ": "
+						<< runs[i]._output
+						<< std::endl;
+		}
+
+		if (Run(runs[i], registry, buffers) != EXIT_SUCCESS)
+		{
+			status = EXIT_FAILURE;
+		}
+	}
 
-	size_t numberOfPoints;               // The number of sample points
-	std::vector<spPoint> points;         // The information associated with the points (e.g., coordinates)
+	return status;
+}
 
 
+/**
+ * \fn int Run(const DriverOptions& options, const SurfaceRegistry& registry, RunBuffers& buffers)
+ *
+ * \brief Samples a surface, computes the CDT of the samples, and
+ * writes the triangulation to a file.
+ *
+ * \param options The settings of the run.
+ * \param registry The registry of surfaces.
+ * \param buffers The arrays reused across runs.
+ *
+ * \return EXIT_SUCCESS or EXIT_FAILURE.
+ */
+int Run(
+	const DriverOptions& options,
+	const SurfaceRegistry& registry,
+	RunBuffers& buffers
+)
+{
+	// Time each stage of the run.
+	StageTimer timer;
 
-	/****************************************************************/
+	// Unless told otherwise, sample with the given Poisson disk radius.
+	double alpha = options._alpha;
 
-	// ---------------------------------------------------------------
-	// Se você  quiser testar seu  código com uma superfície  que você
-	// definiu, comente a definição que cria um share pointer para uma
-	// instância de MyCylinder e defina  o apontador mySurface como um
-	// shared pointer para uma instância da classe de sua superfície.
-	// ---------------------------------------------------------------
-	
-	// This  is   the  surface   you  will   sample  using   your  PDS
-	// algorithm. You can replace this  surface with other surface you
-	// define.
-	//std::shared_ptr<Cone> mySurface = std::make_shared<Cone>();
-	//std::shared_ptr<Esfera> mySurface = std::make_shared<Esfera>();
-	std::shared_ptr<MyCylinder> mySurface = std::make_shared<MyCylinder>();
+	if ((options._targetPoints > 0) && options._loadSamples.empty())
+	{
+		std::cout	<< std::endl
+					<< "Estimating the Poisson disk radius..."
+					<< std::endl;
+		std::cout.flush();
+
+		timer.Start("alpha");
+
+		try
+		{
+			AlphaEstimator estimator(
+									 options._maxTrials,
+									 options._seed,
+									 options._trialPoints,
+									 64,
+									 options._numberOfThreads
+									);
 
-	// Define the sampler.
-	PDSampler sampler;
+			alpha = estimator.Estimate(registry.Create(options._surface), options._targetPoints);
+		}
+		catch (const std::exception& xpt)
+		{
+		    std::cerr << std::endl
+		              << "ERROR: "
+			          << xpt.what()
+					  << std::endl
+			          << std::endl;
+		    return EXIT_FAILURE;
+		}
+
+		timer.Stop();
+	}
+
+	timer.AddLabel("output", options._output);
+	timer.AddLabel("surface", options._surface);
+	timer.AddLabel("alpha", alpha);
+	timer.AddLabel("target_points", options._targetPoints);
+	timer.AddLabel("max_error", options._maxError);
+	timer.AddLabel("points", options._numberOfSamples);
+	timer.AddLabel("levels", options._levels);
+	timer.AddLabel("tile", options._tile);
+	timer.AddLabel("max_trials", options._maxTrials);
+	timer.AddLabel("seed", options._seed);
+	timer.AddLabel("metric", options._metric);
+	timer.AddLabel("boundary", options._boundary);
+
+	// Sample the surface, or reuse the sample points of a previous run.
+	// Unless told otherwise, the CDT is computed while sampling goes on.
+	// Sample elimination only knows its samples at the end, so the CDT
+	// is then computed after sampling.
+	// So does a progressive sample, whose coarser levels are written
+	// from the CDT as it grows, and a tiled sample, which is too quick
+	// to hide the CDT behind.
+	// On a periodic surface, the CDT wraps around the seams, so it is
+	// computed after sampling too, along with the ghosts of the samples
+	// near the seams.  Lloyd iterations and refinement replace or add
+	// vertices the ghosts cannot follow, so the seams are left open
+	// with them.  So are they with the ghost vertex, whose hull
+	// triangles are not those of the periodic CDT, and with the surface
+	// metric, whose incircle tests disagree between the copies of a
+	// triangle where the metric degenerates, as at the poles.
+	SeamWrapper::spSurface seamSurface;
 
-	// Sample the surface.
 	try
 	{
-		sampler.sample(
-					   mySurface,
-					   numberOfPoints,
-					   points
-					  );
+		seamSurface = registry.Create(options._surface);
 	}
 	catch (const std::exception& xpt)
 	{
@@ -197,18 +446,152 @@ int main(int argc, char* argv[])
 	    return EXIT_FAILURE;
 	}
 
-	// Compute the CDT of the given set of points and segments.
-	std::cout << "Compute the Constrained Delaunay Triangulation (CDT)... "
-		<< std::endl;
+	SeamWrapper seams(seamSurface, alpha);
+
+	// A trimmed patch is bounded by the segments of its trimming
+	// curves, and a boundary-first patch by those of the sides of its
+	// domain, which are handed to the CDT along with the samples, so it
+	// is computed after sampling too, and does not wrap.
+	bool trimmed = !options._trim.empty();
+	bool bounded = trimmed || (options._patchBoundary == "sampled");
+	bool wrap = seams.IsPeriodic() && !bounded && (options._boundary != "ghost") && (options._metric == "uv") &&
+				(options._lloyd == 0) && (options._minAngle == 0) && (options._maxArea == 0);
+	bool eliminate = options._loadSamples.empty() && (options._numberOfSamples > 0);
+	bool progressive = options._loadSamples.empty() && !eliminate && (options._levels > 1);
+	bool tiled = options._loadSamples.empty() && !eliminate && !progressive && !options._tile.empty();
+	// A streaming sampler hands its points to the CDT without keeping
+	// them, so they cannot be saved.
+	bool stream = options._loadSamples.empty() && options._saveSamples.empty() && !eliminate && !progressive && !tiled && !wrap && !bounded &&
+				  (options._streamBatch > 0);
+
+	std::cout	<< std::endl
+				<< (stream ?
+					"Sampling a surface using Poisson Disk Sampling and computing the CDT of the samples..." :
+					(eliminate ?
+					"Sampling a surface using weighted sample elimination..." :
+					(tiled ?
+					"Sampling a surface using a Poisson disk tile..." :
+					"Sampling a surface using Poisson Disk Sampling...")))
+				<< std::endl;
 	std::cout.flush();
 
+	size_t numberOfPoints;                          // The number of sample points
+	std::vector<spPoint>& points = buffers._points; // The information associated with the points (e.g., coordinates)
+
+	size_t distanceTests = 0;                       // The number of tile points checked against the others
+
 	CDT* myCdt = nullptr;
+
+	// Unless told otherwise, the CDT is Delaunay in the parameter plane.
+	// Under the surface metric, it is Delaunay as measured on the surface.
+	CDT::MetricField metric;
+
+	if (options._metric == "surface")
+	{
+		PDSampler::spSurface surface = registry.Create(options._surface);
+
+		metric = [surface](double u, double v, double& e, double& f, double& g)
+		{
+			surface->GetFirstFundamentalForm(u, v, e, f, g);
+		};
+	}
+
+	// Unless told otherwise, the CDT is built inside an enclosing
+	// triangle.
+	CDT::BoundaryMode boundary = (options._boundary == "ghost") ?
+		CDT::BoundaryMode::GhostVertex :
+		CDT::BoundaryMode::EnclosingTriangle;
+
+	timer.Start(stream ? "sample_cdt" : (options._loadSamples.empty() ? "sampling" : "load_samples"));
+
 	try
 	{
-	  myCdt = new CDT(
-					  numberOfPoints,
-					  points
-					 );
+		if (eliminate)
+		{
+			SampleEliminator eliminator(options._seed, 5, options._numberOfThreads);
+
+			eliminator.Sample(
+							  registry.Create(options._surface),
+							  options._numberOfSamples,
+							  numberOfPoints,
+							  points
+							 );
+		}
+		else if (tiled)
+		{
+			// The tile is generated once, and then reused by every run
+			// that names the same file.
+			PoissonTile tile;
+
+			if (std::ifstream(options._tile).good())
+			{
+				tile.Load(options._tile);
+			}
+			else
+			{
+				tile.Generate(1024, options._seed);
+				tile.Save(options._tile);
+			}
+
+			TileSampler sampler(tile, alpha);
+
+			distanceTests = sampler.Sample(
+										   registry.Create(options._surface),
+										   numberOfPoints,
+										   points
+										  );
+		}
+		else if (options._loadSamples.empty())
+		{
+			PDSampler& sampler = buffers._sampler;
+
+			sampler.setAlpha(alpha);
+			sampler.setMT(options._maxTrials);
+			sampler.setSeed(options._seed);
+			sampler.setMaxError(options._maxError);
+			sampler.setMinAlpha(options._minAlpha);
+			sampler.setLevels(options._levels);
+
+			std::shared_ptr<TrimRegion> trim;
+
+			if (trimmed)
+			{
+				trim = std::make_shared<TrimRegion>();
+				trim->Load(options._trim);
+			}
+
+			sampler.setTrim(trim);
+			sampler.setBoundaryFirst(options._patchBoundary == "sampled");
+
+			if (stream)
+			{
+				myCdt = SampleAndTriangulate(
+					registry.Create(options._surface),
+					options._streamBatch,
+					metric,
+					boundary,
+					sampler,
+					numberOfPoints,
+					points
+				);
+			}
+			else
+			{
+				sampler.sample(
+							   registry.Create(options._surface),
+							   numberOfPoints,
+							   points
+							  );
+			}
+		}
+		else
+		{
+			OffMesh samples;
+			OffReader reader(options._numberOfThreads);
+
+			reader.Read(options._loadSamples, samples);
+			reader.GetSamplePoints(samples, numberOfPoints, points);
+		}
 	}
 	catch (const std::exception& xpt)
 	{
@@ -220,77 +603,712 @@ int main(int argc, char* argv[])
 	    return EXIT_FAILURE;
 	}
 
-	// Obtain all edges and vertices of the CDT.
-	std::cout << "Collecting all edges and vertices of the CDT..."
-			  << std::endl;
-	std::cout.flush();
+	timer.Stop();
+	timer.AddCount("points", numberOfPoints);
 
-	size_t numberOfVertices;
-	std::vector<spPoint> vertices;
+	if (tiled)
+	{
+		timer.AddCount("distance_tests", distanceTests);
+	}
 
-	size_t numberOfEdges;
-	std::vector<size_t> edges;
+	// The segments of the trimming curves, or of the sides of the
+	// domain, as indices of their samples.
+	const std::vector<size_t>& segments = buffers._sampler.getSegments();
 
-	size_t  numberOfTriangles;
-	std::vector<size_t> triangles;
+	if (bounded)
+	{
+		timer.AddCount("segments", segments.size() / 2);
+	}
 
-	// Won't use this variable, but we must declare it!
-	std::vector<FaceVisitor::EdgeType> edgeType;
+	// The indices past the last sample of each level of a progressive
+	// sample.
+	std::vector<size_t> levelEnds;
 
-	FaceVisitor visitor;
-	visitor.Visit(
-		*myCdt,
-		numberOfTriangles,
-		triangles,
-		numberOfEdges,
-		edges,
-		edgeType,
-		numberOfVertices,
-		vertices
-	);
+	if (progressive)
+	{
+		levelEnds = buffers._sampler.getLevelEnds();
+	}
+
+	// Drop the samples repeated on both sides of a seam, and make the
+	// ghosts of the samples the CDT starts with.
+	std::vector<spPoint> ghosts;
+
+	if (wrap)
+	{
+		timer.Start("wrap");
+
+		size_t numberOfDuplicates = seams.RemoveDuplicates(numberOfPoints, points, levelEnds);
+
+		try
+		{
+			seams.AddGhosts(
+							0,
+							progressive ? levelEnds.front() : numberOfPoints,
+							points,
+							ghosts
+						   );
+		}
+		catch (const std::exception& xpt)
+		{
+		    std::cerr << std::endl
+		              << "ERROR: "
+			          << xpt.what()
+					  << std::endl
+			          << std::endl;
+		    return EXIT_FAILURE;
+		}
+
+		timer.Stop();
+		timer.AddCount("duplicates", numberOfDuplicates);
+		timer.AddCount("ghosts", ghosts.size());
+	}
+
+	if (!options._saveSamples.empty())
+	{
+		std::cout << "Writing sample points to an STOFF file..."
+			<< std::endl;
+		std::cout.flush();
+
+		timer.Start("save_samples");
+
+		try
+		{
+			WriteSamplePoints(options._saveSamples, numberOfPoints, points);
+		}
+		catch (const std::exception& xpt)
+		{
+		    std::cerr << std::endl
+		              << "ERROR: "
+			          << xpt.what()
+					  << std::endl
+			          << std::endl;
+			delete myCdt;
+		    return EXIT_FAILURE;
+		}
+
+		timer.Stop();
+	}
+
+	// Compute the CDT of the given set of points and segments.
+	if (myCdt == nullptr)
+	{
+		std::cout << "Compute the Constrained Delaunay Triangulation (CDT)... "
+			<< std::endl;
+		std::cout.flush();
+
+		timer.Start("cdt");
+
+		try
+		{
+		  // A progressive sample starts with its coarsest level.
+		  size_t numberOfCdtPoints = progressive ? levelEnds.front() : numberOfPoints;
+
+		  if (bounded)
+		  {
+			  myCdt = new CDT(numberOfCdtPoints, segments.size() / 2, points, segments, boundary);
+		  }
+		  else if (ghosts.empty())
+		  {
+			  myCdt = new CDT(numberOfCdtPoints, points, metric, boundary);
+		  }
+		  else
+		  {
+			  std::vector<spPoint> wrapped(points.begin(), points.begin() + numberOfCdtPoints);
+			  wrapped.insert(wrapped.end(), ghosts.begin(), ghosts.end());
+
+			  myCdt = new CDT(wrapped.size(), wrapped, metric, boundary);
+		  }
+		}
+		catch (const std::exception& xpt)
+		{
+		    std::cerr << std::endl
+		              << "ERROR: "
+			          << xpt.what()
+					  << std::endl
+			          << std::endl;
+		    return EXIT_FAILURE;
+		}
+
+		timer.Stop();
+	}
+
+	// Write each coarser level of a progressive sample, and then insert
+	// the samples of the next level into the same CDT.
+	if (progressive)
+	{
+		std::cout << "Writing the coarser levels of detail..."
+			<< std::endl;
+		std::cout.flush();
+
+		timer.Start("lod");
+
+		// DriverOptions::Check() has already made sure the extension is .vtk.
+		std::string baseName = options._output.substr(0, options._output.size() - 4);
+
+		size_t numberOfLevelTriangles = 0;
+
+		try
+		{
+			for (size_t level = 0; level + 1 < levelEnds.size(); level++)
+			{
+				numberOfLevelTriangles += WriteLevelOfDetail(
+					*myCdt,
+					wrap ? &seams : nullptr,
+					baseName + "_lod" + std::to_string(level) + ".off",
+					options._format == "stoff",
+					buffers
+				);
+
+				for (size_t i = levelEnds[level]; i < levelEnds[level + 1]; i++)
+				{
+					myCdt->Insert(points[i]);
+				}
+
+				if (wrap)
+				{
+					ghosts.clear();
+					seams.AddGhosts(levelEnds[level], levelEnds[level + 1], points, ghosts);
+
+					for (size_t i = 0; i < ghosts.size(); i++)
+					{
+						myCdt->Insert(ghosts[i]);
+					}
+				}
+			}
+		}
+		catch (const std::exception& xpt)
+		{
+		    std::cerr << std::endl
+		              << "ERROR: "
+			          << xpt.what()
+					  << std::endl
+			          << std::endl;
+			delete myCdt;
+		    return EXIT_FAILURE;
+		}
+
+		timer.Stop();
+		timer.AddCount("levels", levelEnds.size());
+		timer.AddCount("triangles", numberOfLevelTriangles);
+	}
+
+	// Even out the samples on the surface with Lloyd iterations, which
+	// move the vertices of the CDT in place.
+	if (options._lloyd > 0)
+	{
+		std::cout << "Relaxing the sample points..."
+			<< std::endl;
+		std::cout.flush();
+
+		timer.Start("lloyd");
+
+		size_t numberOfMoves;
+
+		try
+		{
+			LloydRelaxer relaxer(registry.Create(options._surface), options._numberOfThreads);
+
+			numberOfMoves = relaxer.Relax(*myCdt, options._lloyd);
+		}
+		catch (const std::exception& xpt)
+		{
+		    std::cerr << std::endl
+		              << "ERROR: "
+			          << xpt.what()
+					  << std::endl
+			          << std::endl;
+			delete myCdt;
+		    return EXIT_FAILURE;
+		}
+
+		timer.Stop();
+		timer.AddCount("lloyd_moves", numberOfMoves);
+	}
+
+	// Refine the CDT.  Steiner points are lifted onto the surface, so
+	// they can be written like the sample points.
+	if ((options._minAngle > 0) || (options._maxArea > 0))
+	{
+		std::cout << "Refining the CDT..."
+			<< std::endl;
+		std::cout.flush();
+
+		timer.Start("refine");
+
+		size_t numberOfSteinerPoints;
+
+		try
+		{
+			PDSampler::spSurface surface = registry.Create(options._surface);
+
+			numberOfSteinerPoints = myCdt->Refine(
+				options._minAngle,
+				options._maxArea,
+				0,
+				[&surface](double u, double v) -> spPoint
+				{
+					SamplePoint::Point pos;
+					surface->GetPoint(u, v, pos._x, pos._y, pos._z);
+
+					return std::make_shared<SamplePoint>(SamplePoint(u, v, pos));
+				}
+			);
+		}
+		catch (const std::exception& xpt)
+		{
+		    std::cerr << std::endl
+		              << "ERROR: "
+			          << xpt.what()
+					  << std::endl
+			          << std::endl;
+			delete myCdt;
+		    return EXIT_FAILURE;
+		}
 
-	// Write the patch triangulation to an OFF output file.
-	std::cout	<< "Writing patch triangulation to an OFF file..."
+		timer.Stop();
+		timer.AddCount("steiner_points", numberOfSteinerPoints);
+	}
+
+	// DriverOptions::Check() has already made sure the extension is .vtk.
+	std::string offFileName = options._output.substr(0, options._output.size() - 3) + "off";
+
+	// Unless stitching or welding renumbers the vertices afterwards,
+	// the triangulation goes straight from the visitor to the file.
+	if (!bounded && !wrap && (options._weld == 0))
+	{
+		std::cout << "Writing the triangulation of the CDT to an OFF file..."
+				  << std::endl;
+		std::cout.flush();
+
+		timer.Start("visitor");
+		timer.AddCount("cdt_vertices", myCdt->GetNumberOfVertices());
+		timer.AddCount("cdt_edges", myCdt->GetNumberOfEdges());
+		timer.AddCount("cdt_faces", myCdt->GetNumberOfFaces());
+		timer.AddCount("cdt_flips", myCdt->GetNumberOfSwaps());
+
+		size_t numberOfTriangles;
+		size_t numberOfVertices;
+
+		try
+		{
+			StreamPatchTriangulation(
+				*myCdt,
+				offFileName,
+				options._format == "stoff",
+				numberOfTriangles,
+				numberOfVertices
+			);
+		}
+		catch (const std::exception& xpt)
+		{
+		    std::cerr << std::endl
+		              << "ERROR: "
+			          << xpt.what()
+					  << std::endl
+			          << std::endl;
+			delete myCdt;
+		    return EXIT_FAILURE;
+		}
+
+		timer.Stop();
+		timer.AddCount("triangles", numberOfTriangles);
+		timer.AddCount("vertices", numberOfVertices);
+	}
+	else
+	{
+		// Obtain all edges and vertices of the CDT.
+		std::cout << "Collecting all edges and vertices of the CDT..."
+				  << std::endl;
+		std::cout.flush();
+
+		size_t numberOfVertices;
+		std::vector<spPoint>& vertices = buffers._vertices;
+
+		size_t numberOfEdges;
+		std::vector<size_t>& edges = buffers._edges;
+
+		size_t  numberOfTriangles;
+		std::vector<size_t>& triangles = buffers._triangles;
+
+		// Won't use this variable, but we must declare it!
+		std::vector<FaceVisitor::EdgeType>& edgeType = buffers._edgeType;
+
+		timer.Start("visitor");
+
+		// The size of the final triangulation goes with the stage
+		// that always follows it, whichever stages built it.
+		timer.AddCount("cdt_vertices", myCdt->GetNumberOfVertices());
+		timer.AddCount("cdt_edges", myCdt->GetNumberOfEdges());
+		timer.AddCount("cdt_faces", myCdt->GetNumberOfFaces());
+		timer.AddCount("cdt_flips", myCdt->GetNumberOfSwaps());
+
+		// Of a bounded patch, only the regions its segments keep are
+		// collected.
+		if (bounded)
+		{
+			std::vector<TriangulationVisitor::EdgeType> boundedEdgeType;
+
+			TriangulationVisitor visitor;
+			visitor.Visit(
+				*myCdt,
+				numberOfTriangles,
+				triangles,
+				numberOfEdges,
+				edges,
+				boundedEdgeType,
+				numberOfVertices,
+				vertices
+			);
+		}
+		else
+		{
+			FaceVisitor visitor;
+			visitor.Visit(
+				*myCdt,
+				numberOfTriangles,
+				triangles,
+				numberOfEdges,
+				edges,
+				edgeType,
+				numberOfVertices,
+				vertices
+			);
+		}
+
+		timer.Stop();
+		timer.AddCount("triangles", numberOfTriangles);
+		timer.AddCount("vertices", numberOfVertices);
+
+		// Keep one copy of each triangle across the seams, made of samples.
+		if (wrap)
+		{
+			std::cout << "Stitching the triangulation along the seams..."
 				<< std::endl;
-	std::cout.flush();
+			std::cout.flush();
 
-	std::string fn(argv[1]);
+			timer.Start("stitch");
 
-	WritePatchTriangulation(
-		fn,
-		numberOfTriangles,
-		triangles,
-		numberOfVertices,
-		vertices
-	);
+			size_t numberOfGhosts = seams.Stitch(numberOfTriangles, triangles, numberOfVertices, vertices);
+
+			timer.Stop();
+			timer.AddCount("ghosts", numberOfGhosts);
+			timer.AddCount("triangles", numberOfTriangles);
+		}
+
+		// Weld the vertices that lie at the same place on the surface, such
+		// as those on both sides of a seam the CDT did not wrap around.
+		if (options._weld > 0)
+		{
+			std::cout << "Welding the vertices of the triangulation..."
+				<< std::endl;
+			std::cout.flush();
+
+			timer.Start("weld");
+
+			size_t numberOfWelded = 0;
+
+			try
+			{
+				VertexWelder welder(
+									registry.Create(options._surface),
+									options._weld,
+									options._numberOfThreads
+								   );
+
+				numberOfWelded = welder.Weld(numberOfTriangles, triangles, numberOfVertices, vertices);
+			}
+			catch (const std::exception& xpt)
+			{
+			    std::cerr << std::endl
+			              << "ERROR: "
+				          << xpt.what()
+						  << std::endl
+				          << std::endl;
+				delete myCdt;
+			    return EXIT_FAILURE;
+			}
+
+			timer.Stop();
+			timer.AddCount("welded", numberOfWelded);
+			timer.AddCount("triangles", numberOfTriangles);
+		}
+
+		// Write the patch triangulation to an OFF output file.
+		std::cout	<< "Writing patch triangulation to an OFF file..."
+					<< std::endl;
+		std::cout.flush();
+
+		timer.Start("write");
+
+		try
+		{
+			WritePatchTriangulation(
+				offFileName,
+				numberOfTriangles,
+				triangles,
+				numberOfVertices,
+				vertices,
+				options._format == "stoff"
+			);
+		}
+		catch (const std::exception& xpt)
+		{
+		    std::cerr << std::endl
+		              << "ERROR: "
+			          << xpt.what()
+					  << std::endl
+			          << std::endl;
+			delete myCdt;
+		    return EXIT_FAILURE;
+		}
+
+		timer.Stop();
+		timer.AddCount("triangles", numberOfTriangles);
+	}
+
+	// Compare the patch triangulation against a golden mesh.
+	int status = EXIT_SUCCESS;
+
+	if (!options._golden.empty())
+	{
+		std::cout	<< "Comparing patch triangulation against "
+					<< options._golden
+					<< "..."
+					<< std::endl;
+		std::cout.flush();
+
+		timer.Start("compare");
+
+		try
+		{
+			OffMesh result;
+			OffMesh reference;
+			OffReader reader(options._numberOfThreads);
+
+			reader.Read(offFileName, result);
+			reader.Read(options._golden, reference);
+
+			double maxDeviation;
+			size_t numberOfMismatchedTriangles;
+
+			bool match = reader.Compare(
+				result,
+				reference,
+				1e-9,
+				maxDeviation,
+				numberOfMismatchedTriangles
+			);
+
+			std::cout	<< "\t vertices: "
+						<< result._numberOfVertices
+						<< " (golden: "
+						<< reference._numberOfVertices
+						<< ")"
+						<< std::endl
+						<< "\t triangles: "
+						<< result._numberOfTriangles
+						<< " (golden: "
+						<< reference._numberOfTriangles
+						<< "), mismatched: "
+						<< numberOfMismatchedTriangles
+						<< std::endl
+						<< "\t maximum vertex deviation: "
+						<< maxDeviation
+						<< std::endl
+						<< (match ? "\t MATCH" : "\t MISMATCH")
+						<< std::endl;
+			std::cout.flush();
+
+			if (!match)
+			{
+				status = EXIT_FAILURE;
+			}
+		}
+		catch (const std::exception& xpt)
+		{
+			std::cerr << std::endl
+				<< "ERROR: "
+				<< xpt.what()
+				<< std::endl
+				<< std::endl;
+			status = EXIT_FAILURE;
+		}
+
+		timer.Stop();
+	}
 
 	// Release memory
 	std::cout	<< "Releasing memory..."
 				<< std::endl;
 	std::cout.flush();
 
+	timer.Start("teardown");
+
 	delete myCdt;
 
+	// The arrays keep their capacity for the next run.
+	buffers._vertices.clear();
+	buffers._triangles.clear();
+	buffers._edges.clear();
+	buffers._edgeType.clear();
+	points.clear();
+
+	timer.Stop();
+
+	// Report the measurements of each stage.
+	if (!options._report.empty())
+	{
+		if (options._report == "-")
+		{
+			timer.WriteJson(std::cout);
+		}
+		else
+		{
+			std::ofstream os(options._report.c_str(), std::ios::app);
+
+			if (!os.is_open())
+			{
+				std::cerr << std::endl
+					<< "ERROR: report file cannot be opened."
+					<< std::endl
+					<< std::endl;
+				return EXIT_FAILURE;
+			}
+
+			timer.WriteJson(os);
+		}
+	}
+
 	std::cout	<< "Finished."
 				<< std::endl
 				<< std::endl
 				<< std::endl;
 	std::cout.flush();
 
-	return EXIT_SUCCESS;
+	return status;
 }
 
 
 /**
- * \fn void WritePatchTriangulation(const std::string& filename, size_t numberOfTriangles, const std::vector<size_t>& triangles, size_t numberOfVertices, const std::vector<spPoint>& vertices)
+ * \fn CDT* SampleAndTriangulate(const PDSampler::spSurface& surface, size_t batchSize, const CDT::MetricField& metric, CDT::BoundaryMode boundary, PDSampler& sampler, size_t& numberOfPoints, std::vector<spPoint>& points)
+ *
+ * \brief Samples a surface on a separate thread, while the calling
+ * thread inserts the accepted points into a CDT in batches.  The queue
+ * between the two threads holds a few batches, so the sampler does not
+ * run far ahead of the triangulation.
+ *
+ * \param surface A pointer to the surface to be sampled.
+ * \param batchSize Number of sample points per batch.
+ * \param metric The metric of the incircle test of the CDT.
+ * \param boundary How the CDT handles the outside of the convex hull.
+ * \param sampler The sampler.
+ * \param numberOfPoints A reference to the number of sample points.
+ * \param points A reference to an array of sample points, left empty:
+ * the points are only kept as vertices of the CDT.
+ *
+ * \return A pointer to the CDT of the sample points.
+ */
+CDT* SampleAndTriangulate(
+	const PDSampler::spSurface& surface,
+	size_t batchSize,
+	const CDT::MetricField& metric,
+	CDT::BoundaryMode boundary,
+	PDSampler& sampler,
+	size_t& numberOfPoints,
+	std::vector<spPoint>& points
+)
+{
+	// The enclosing triangle, if any, is sized from the surface domain,
+	// as the sample points are not known yet.
+	std::unique_ptr<CDT> myCdt(
+		new CDT(
+			surface->GetUMin(),
+			surface->GetUMax(),
+			surface->GetVMin(),
+			surface->GetVMax(),
+			boundary
+		)
+	);
+
+	myCdt->SetMetric(metric);
+
+	BoundedQueue< std::vector<spPoint> > queue(4);
+	std::exception_ptr error;
+
+	std::thread producer(
+		[&]
+		{
+			try
+			{
+				sampler.sample(
+					surface,
+					numberOfPoints,
+					points,
+					batchSize,
+					[&queue](std::vector<spPoint>& batch)
+					{
+						std::vector<spPoint> item;
+						item.swap(batch);
+						queue.Push(std::move(item));
+					}
+				);
+			}
+			catch (...)
+			{
+				error = std::current_exception();
+			}
+
+			queue.Close();
+		}
+	);
+
+	try
+	{
+		std::vector<spPoint> batch;
+
+		while (queue.Pop(batch))
+		{
+			myCdt->InsertPoints(batch.size(), batch);
+		}
+	}
+	catch (...)
+	{
+		// Let the sampler finish without waiting for room in the queue.
+		queue.Close();
+		producer.join();
+		throw;
+	}
+
+	producer.join();
+
+	if (error)
+	{
+		std::rethrow_exception(error);
+	}
+
+	myCdt->Finish();
+
+	return myCdt.release();
+}
+
+
+/**
+ * \fn void WritePatchTriangulation(const std::string& filename, size_t numberOfTriangles, const std::vector<size_t>& triangles, size_t numberOfVertices, const std::vector<spPoint>& vertices, bool withParameters)
  *
  * \brief Write the NURBS surface patch triangulation to an OFF file.
+ * The records are formatted here while a background thread writes
+ * the previous chunk, so only formatting overlaps with the disk I/O.
+ * The triangulation is extracted in full beforehand: the OFF header
+ * needs the final counts, and stitching and welding renumber the
+ * vertices after the visitor runs.
  *
  * \param filename The name of a file to be written to.
  * \param numberOfTriangles Total number of triangles of the CDT.
  * \param triangles An array with vertex indices of all triangles.
  * \param numberOfVertices Total number of vertices of the CDT.
  * \param vertices An  array to store all vertices of the CDT.
+ * \param withParameters A flag to indicate whether an STOFF file,
+ * with the parameter coordinates of the vertices, is written.
  *
  */
 void WritePatchTriangulation(
@@ -298,87 +1316,252 @@ void WritePatchTriangulation(
 	size_t numberOfTriangles,
 	const std::vector<size_t>& triangles,
 	size_t numberOfVertices,
-	const std::vector<spPoint>& vertices
+	const std::vector<spPoint>& vertices,
+	bool withParameters
 )
 {
-	// Change the file extension.
-	std::string offFileName(filename);
-	std::string extension("vtk");
+	// The vertex  and triangle records  are formatted here  while a
+	// background thread writes the previously formatted chunk.  If a
+	// record fails, the writer joins its thread as the exception
+	// unwinds.
+	OffWriter ou;
 
-	if (
-		(extension.size() <= offFileName.size())
-		&&
-		std::equal(extension.rbegin(), extension.rend(), offFileName.rbegin())
-	   )
+	ou.Open(filename, numberOfVertices, numberOfTriangles, withParameters);
+
+	// Print out the vertex coordinates.
+	for (size_t i = 0; i < numberOfVertices; i++)
 	{
-		offFileName.replace(offFileName.end() - 3, offFileName.end(), "off");
+		WriteVertexRecord(ou, vertices[i], withParameters);
 	}
-	else
+
+	// Print out the face information.
+	for (size_t i = 0; i < numberOfTriangles; i++)
 	{
-		std::cerr << std::endl
-			<< "ERROR: output filename does not have extension .vtk"
-			<< std::endl
-			<< std::endl;
-		exit(EXIT_FAILURE);
+		ou.WriteTriangle(
+			triangles[3 * i],
+			triangles[3 * i + 1],
+			triangles[3 * i + 2]
+		);
 	}
 
-	std::ofstream ou(offFileName.c_str());
+	// Close file
+	ou.Close();
+
+	return;
+}
 
-	if (!ou.is_open())
+
+/**
+ * \fn void StreamPatchTriangulation(CDT& cdt, const std::string& filename, bool withParameters, size_t& numberOfTriangles, size_t& numberOfVertices)
+ *
+ * \brief Write the triangulation of a CDT to an OFF file as the face
+ * visitor enumerates it.  The header counts are taken from the CDT up
+ * front, so neither the vertices nor the triangles are stored first.
+ *
+ * \param cdt The CDT to be written.
+ * \param filename The name of a file to be written to.
+ * \param withParameters A flag to indicate whether an STOFF file,
+ * with the parameter coordinates of the vertices, is written.
+ * \param numberOfTriangles Total number of triangles written.
+ * \param numberOfVertices Total number of vertices written.
+ *
+ */
+void StreamPatchTriangulation(
+	CDT& cdt,
+	const std::string& filename,
+	bool withParameters,
+	size_t& numberOfTriangles,
+	size_t& numberOfVertices
+)
+{
+	// Every vertex of a finished CDT is incident to a bounded face.
+	numberOfVertices = cdt.GetNumberOfVertices();
+	numberOfTriangles = 0;
+
+	for (CDT::FaceIterator fit = cdt.FacesBegin(); fit != cdt.FacesEnd(); ++fit)
 	{
-		std::cerr << std::endl
-			<< "ERROR: output file cannot be created."
-			<< std::endl
-			<< std::endl;
-		exit(EXIT_FAILURE);
+		if ((*fit)->IsBounded())
+		{
+			++numberOfTriangles;
+		}
 	}
 
-	// Print out the edge and vertex information to an OFF file.
-	ou << std::setprecision(18) << std::fixed;
+	OffWriter ou;
 
-	// Print out the file header.
-	ou << "OFF"
-		<< std::endl
-		<< numberOfVertices
-		<< '\t'
-		<< numberOfTriangles
-		<< "\t0"
-		<< std::endl;
+	ou.Open(filename, numberOfVertices, numberOfTriangles, withParameters);
 
-	// Print out the vertex coordinates.
-	for (size_t i = 0; i < numberOfVertices; i++)
-	{
-		spSamplePoint p = std::dynamic_pointer_cast<SamplePoint>(vertices[i]);
+	size_t vertexCount = 0;
+	size_t triangleCount = 0;
 
-		if (p == nullptr)
+	FaceVisitor visitor;
+	visitor.Visit(
+		cdt,
+		[&](const spPoint& vertex)
 		{
-			std::cerr << "Failed to dynamically cast a shared pointer"
-				<< std::endl;
-			exit(EXIT_FAILURE);
+			WriteVertexRecord(ou, vertex, withParameters);
+			++vertexCount;
+		},
+		[&](size_t a, size_t b, size_t c)
+		{
+			if (vertexCount != numberOfVertices)
+			{
+				throw std::runtime_error("The vertices of the CDT do not match the OFF header.");
+			}
+
+			ou.WriteTriangle(a, b, c);
+			++triangleCount;
 		}
+	);
 
-		ou << p->GetPosition()._x
-			<< '\t'
-			<< p->GetPosition()._y
-			<< '\t'
-			<< p->GetPosition()._z
-			<< std::endl;
+	if ((vertexCount != numberOfVertices) || (triangleCount != numberOfTriangles))
+	{
+		throw std::runtime_error("The triangulation does not match the OFF header.");
 	}
 
-	// Print out the face information.
-	for (size_t i = 0; i < numberOfTriangles; i++)
+	ou.Close();
+
+	return;
+}
+
+
+/**
+ * \fn void WriteVertexRecord(OffWriter& ou, const spPoint& vertex, bool withParameters)
+ *
+ * \brief Write the record of a vertex to an OFF file.
+ *
+ * \param ou The writer of the OFF file.
+ * \param vertex The vertex.
+ * \param withParameters A flag to indicate whether the parameter
+ * coordinates of the vertex are written too.
+ *
+ */
+void WriteVertexRecord(
+	OffWriter& ou,
+	const spPoint& vertex,
+	bool withParameters
+)
+{
+	spSamplePoint p = std::dynamic_pointer_cast<SamplePoint>(vertex);
+
+	if (p == nullptr)
 	{
-		ou << "3 "
-			<< triangles[3 * i]
-			<< '\t'
-			<< triangles[3 * i + 1]
-			<< '\t'
-			<< triangles[3 * i + 2]
-			<< std::endl;
+		throw std::runtime_error("Failed to dynamically cast a shared pointer.");
 	}
 
-	// Close file
-	ou.close();
+	if (withParameters)
+	{
+		ou.WriteVertex(
+			p->GetPosition()._x,
+			p->GetPosition()._y,
+			p->GetPosition()._z,
+			p->GetU(),
+			p->GetV()
+		);
+	}
+	else
+	{
+		ou.WriteVertex(
+			p->GetPosition()._x,
+			p->GetPosition()._y,
+			p->GetPosition()._z
+		);
+	}
+
+	return;
+}
+
+
+/**
+ * \fn size_t WriteLevelOfDetail(CDT& cdt, const SeamWrapper* seams, const std::string& filename, bool withParameters, RunBuffers& buffers)
+ *
+ * \brief Write the triangulation of a coarser level of detail to an
+ * OFF file.
+ *
+ * \param cdt The CDT of the samples of the level.
+ * \param seams The wrapper of the seams the CDT wraps around, or a
+ * null pointer if it does not.
+ * \param filename The name of a file to be written to.
+ * \param withParameters A flag to indicate whether an STOFF file,
+ * with the parameter coordinates of the vertices, is written.
+ * \param buffers The arrays reused across runs.
+ *
+ * \return The number of triangles written.
+ *
+ */
+size_t WriteLevelOfDetail(
+	CDT& cdt,
+	const SeamWrapper* seams,
+	const std::string& filename,
+	bool withParameters,
+	RunBuffers& buffers
+)
+{
+	size_t numberOfVertices;
+	size_t numberOfEdges;
+	size_t numberOfTriangles;
+
+	// Without seams to stitch, the numbering of the visitor is final.
+	if (seams == nullptr)
+	{
+		StreamPatchTriangulation(cdt, filename, withParameters, numberOfTriangles, numberOfVertices);
+
+		return numberOfTriangles;
+	}
+
+	FaceVisitor visitor;
+	visitor.Visit(
+		cdt,
+		numberOfTriangles,
+		buffers._triangles,
+		numberOfEdges,
+		buffers._edges,
+		buffers._edgeType,
+		numberOfVertices,
+		buffers._vertices
+	);
+
+	seams->Stitch(numberOfTriangles, buffers._triangles, numberOfVertices, buffers._vertices);
+
+	WritePatchTriangulation(
+		filename,
+		numberOfTriangles,
+		buffers._triangles,
+		numberOfVertices,
+		buffers._vertices,
+		withParameters
+	);
+
+	return numberOfTriangles;
+}
+
+
+/**
+ * \fn void WriteSamplePoints(const std::string& filename, size_t numberOfPoints, const std::vector<spPoint>& points)
+ *
+ * \brief Write a set of sample points to an STOFF file. The parameter
+ * coordinates of each point are stored as its texture coordinates.
+ *
+ * \param filename The name of a file to be written to.
+ * \param numberOfPoints Total number of sample points.
+ * \param points An array with the sample points.
+ *
+ */
+void WriteSamplePoints(
+	const std::string& filename,
+	size_t numberOfPoints,
+	const std::vector<spPoint>& points
+)
+{
+	OffWriter ou;
+
+	ou.Open(filename, numberOfPoints, 0, true);
+
+	for (size_t i = 0; i < numberOfPoints; i++)
+	{
+		WriteVertexRecord(ou, points[i], true);
+	}
+
+	ou.Close();
 
 	return;
 }